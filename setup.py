@@ -30,7 +30,9 @@ ext_modules = [
             'src/graph/CSVReader.cpp',
             'src/graph/GraphBase.cpp',
             'src/graph/LinkStreamBase.cpp',
-            'src/tinterval/TimeIntervalSet.cpp'
+            'src/tinterval/TimeIntervalSet.cpp',
+            'src/tinterval/FlatTimeIntervalSet.cpp',
+            'src/tinterval/CompressedTimeIntervalSet.cpp'
         ],
         include_dirs=[
             "src/matrix",
@@ -43,6 +45,9 @@ ext_modules = [
             get_pybind_include(),
             get_pybind_include(user=True)
         ],
+        # gzip, xz and zstd decompression of the edge files, zlib, liblzma and libzstd are
+        # pulled in by Boost.Iostreams
+        libraries=['boost_iostreams'],
         language='c++17',
     ),
 ]
@@ -109,7 +114,7 @@ setup(
     description='pybstream',
     long_description='',
     ext_modules=ext_modules,
-    install_requires=['pybind11>=2.2'],
+    install_requires=['pybind11>=2.2', 'numpy', 'scipy'],
     cmdclass={'build_ext': BuildExt},
     test_suite="tests",
     zip_safe=False,
@@ -0,0 +1,263 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       aggregation.hpp
+/// @brief      Aggregation of link streams into sequences of weighted graphs
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_AGGREGATION_HPP
+#define BSTREAM_AGGREGATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include <Eigen/SparseCore>
+
+#include "GraphType.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @brief Default limit on the number of buckets of an aggregation.
+     */
+    const std::size_t default_max_buckets = std::size_t(1) << 24;
+
+    /**
+     * @brief Sparse 3-D tensor (bucket, source, target) -> weight stored as sorted coordinates.
+     *
+     * The bucket k spans [origin + k delta, origin + (k+1) delta). The entries are sorted by bucket
+     * then by (source, target), buckets lists the occupied buckets in increasing order, bucket_offsets[i] is the index of the
+     * first entry of the bucket buckets[i] and bucket_offsets[buckets.size()] the number of entries.
+     */
+    struct AggregatedLinkStream
+    {
+        time_t origin = 0;
+        time_t delta = 1;
+        std::size_t num_buckets = 0;
+        std::size_t num_vertices = 0;
+        std::vector<std::size_t> buckets;
+        std::vector<std::size_t> bucket_offsets;
+        std::vector<std::size_t> bucket;
+        std::vector<std::size_t> source;
+        std::vector<std::size_t> target;
+        std::vector<double> weight;
+    };
+
+    /**
+     * @brief Weighted adjacency matrices of the occupied buckets of an aggregation.
+     *
+     * The buckets are those of AggregatedLinkStream, matrices[i] is the adjacency matrix of the bucket
+     * buckets[i], the empty buckets have no matrix.
+     */
+    struct AggregatedSnapshots
+    {
+        time_t origin = 0;
+        time_t delta = 1;
+        std::size_t num_buckets = 0;
+        std::vector<std::size_t> buckets;
+        std::vector<Eigen::SparseMatrix<double>> matrices;
+    };
+
+    /**
+     * @brief Aggregate a link stream into buckets of duration delta.
+     *
+     * The buckets start at the lower bound of the first interval and end with the upper bound of the
+     * last one, whatever the definition interval. The weight of an edge in a bucket is the time during
+     * which the edge is active inside the bucket. The edges are swept in parallel, each producing at
+     * most one entry per bucket in the buffer of its thread, and the entries are then sorted with a
+     * counting sort over the occupied buckets only. Each bucket is finally sorted by (source, target),
+     * so that the tensor does not depend on the number of threads or on their scheduling.
+     *
+     * @param g link stream
+     * @param delta duration of a bucket
+     * @param max_buckets largest accepted number of buckets
+     * @return the aggregated link stream as a sparse tensor
+     */
+    template<typename DirectedS>
+    AggregatedLinkStream aggregate_tensor(LinkStreamBase<DirectedS> &g, time_t delta,
+                                          std::size_t max_buckets = default_max_buckets)
+    {
+        if (delta <= 0)
+            throw LinkStreamBaseException("The aggregation period must be positive");
+
+        AggregatedLinkStream res;
+        res.origin = g.definition().first;
+        res.delta = delta;
+        res.num_vertices = static_cast<std::size_t>(g.num_vertices());
+        res.bucket_offsets.push_back(0);
+
+        std::vector<typename LinkStreamBase<DirectedS>::edge_t> edges;
+        edges.reserve(static_cast<std::size_t>(g.num_edges()));
+        for (auto it = g.edges().first; it != g.edges().second; ++it)
+            edges.push_back(*it);
+        auto m = edges.size();
+
+        ///< single read of the intervals of every edge, with the bounds of the stream
+        std::vector<std::vector<std::pair<time_t, time_t>>> contacts(m);
+        std::vector<std::pair<time_t, time_t>> bounds(num_threads(), std::make_pair(
+                std::numeric_limits<time_t>::max(), std::numeric_limits<time_t>::min()));
+        parallel_for_threads(0, m, [&](std::size_t i, unsigned tid) {
+            auto tis = g.edge_tinterval_set(edges[i]);
+            for (auto ti = tis.begin(); ti != tis.end(); ++ti)
+                contacts[i].emplace_back(ti->lower(), ti->upper());
+            if (!contacts[i].empty()) {
+                bounds[tid].first = std::min(bounds[tid].first, contacts[i].front().first);
+                bounds[tid].second = std::max(bounds[tid].second, contacts[i].back().second);
+            }
+        });
+        time_t first = std::numeric_limits<time_t>::max(), last = std::numeric_limits<time_t>::min();
+        for (auto &b : bounds) {
+            first = std::min(first, b.first);
+            last = std::max(last, b.second);
+        }
+        if (first >= last)
+            return res;
+
+        ///< the unsigned difference of the bounds cannot overflow
+        auto offset = [first](time_t t) {
+            return static_cast<std::uint64_t>(t) - static_cast<std::uint64_t>(first);
+        };
+        auto udelta = static_cast<std::uint64_t>(delta);
+        auto num_buckets = (offset(last) - 1) / udelta + 1;
+        if (num_buckets > max_buckets)
+            throw LinkStreamBaseException("The aggregation period gives " + std::to_string(num_buckets) +
+                                          " buckets, more than the limit of " + std::to_string(max_buckets));
+        res.origin = first;
+        res.num_buckets = static_cast<std::size_t>(num_buckets);
+
+        ///< entries of the edges, in the buffer of the thread that swept them
+        struct entry
+        {
+            std::size_t bucket, source, target;
+            double weight;
+        };
+        std::vector<std::vector<entry>> buffers(num_threads());
+        parallel_for_threads(0, m, [&](std::size_t i, unsigned tid) {
+            auto endpoints = g.edge_endpoint(edges[i]);
+            auto &buffer = buffers[tid];
+            std::size_t current = res.num_buckets;
+            for (auto &c : contacts[i]) {
+                auto lower_bucket = static_cast<std::size_t>(offset(c.first) / udelta);
+                auto upper_bucket = static_cast<std::size_t>((offset(c.second) - 1) / udelta);
+                for (auto k = lower_bucket; k <= upper_bucket; ++k) {
+                    time_t lo = std::max(c.first, first + static_cast<time_t>(k) * delta);
+                    time_t hi = std::min(c.second, first + static_cast<time_t>(k + 1) * delta);
+                    ///< intervals of an edge are sorted, so a shared bucket is always the last one
+                    if (k == current) {
+                        buffer.back().weight += static_cast<double>(hi - lo);
+                    } else {
+                        buffer.push_back(entry{k, endpoints.first, endpoints.second, static_cast<double>(hi - lo)});
+                        current = k;
+                    }
+                }
+            }
+            std::vector<std::pair<time_t, time_t>>().swap(contacts[i]);
+        });
+
+        ///< occupied buckets as a bitmap, the rank of a bucket counts the bits before it
+        std::vector<std::uint64_t> occupied((res.num_buckets + 63) / 64, 0);
+        for (auto &buffer : buffers)
+            for (auto &e : buffer)
+                occupied[e.bucket / 64] |= std::uint64_t(1) << (e.bucket % 64);
+        std::vector<std::size_t> rank_base(occupied.size() + 1, 0);
+        for (std::size_t w = 0; w < occupied.size(); ++w) {
+            rank_base[w + 1] = rank_base[w] + static_cast<std::size_t>(__builtin_popcountll(occupied[w]));
+            for (auto bits = occupied[w]; bits != 0; bits &= bits - 1)
+                res.buckets.push_back(w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits)));
+        }
+        auto rank = [&occupied, &rank_base](std::size_t k) {
+            auto below = occupied[k / 64] & ((std::uint64_t(1) << (k % 64)) - 1);
+            return rank_base[k / 64] + static_cast<std::size_t>(__builtin_popcountll(below));
+        };
+
+        ///< counting sort of the entries by occupied bucket
+        res.bucket_offsets.assign(res.buckets.size() + 1, 0);
+        for (auto &buffer : buffers)
+            for (auto &e : buffer)
+                ++res.bucket_offsets[rank(e.bucket) + 1];
+        for (std::size_t i = 0; i < res.buckets.size(); ++i)
+            res.bucket_offsets[i + 1] += res.bucket_offsets[i];
+
+        std::vector<entry> sorted(res.bucket_offsets.back());
+        std::vector<std::size_t> position(res.bucket_offsets.begin(), res.bucket_offsets.end() - 1);
+        for (auto &buffer : buffers) {
+            for (auto &e : buffer)
+                sorted[position[rank(e.bucket)]++] = e;
+            std::vector<entry>().swap(buffer);
+        }
+
+        ///< the order inside a bucket depends on the threads, sort it by (source, target)
+        auto n = sorted.size();
+        res.bucket.resize(n);
+        res.source.resize(n);
+        res.target.resize(n);
+        res.weight.resize(n);
+        parallel_for(0, res.buckets.size(), [&](std::size_t b) {
+            auto begin = sorted.begin() + static_cast<std::ptrdiff_t>(res.bucket_offsets[b]);
+            auto end = sorted.begin() + static_cast<std::ptrdiff_t>(res.bucket_offsets[b + 1]);
+            std::sort(begin, end, [](const entry &x, const entry &y) {
+                return x.source < y.source || (x.source == y.source && x.target < y.target);
+            });
+            for (auto p = res.bucket_offsets[b]; p < res.bucket_offsets[b + 1]; ++p) {
+                res.bucket[p] = sorted[p].bucket;
+                res.source[p] = sorted[p].source;
+                res.target[p] = sorted[p].target;
+                res.weight[p] = sorted[p].weight;
+            }
+        }, 64);
+        return res;
+    }
+
+    /**
+     * @brief Aggregate a link stream into one weighted adjacency matrix per occupied bucket of
+     * duration delta.
+     *
+     * The buckets are those of aggregate_tensor, the empty buckets get no matrix so that the memory
+     * only grows with the occupied buckets. The matrices of undirected link streams are symmetric.
+     * They are built in parallel, one occupied bucket per task.
+     *
+     * @param g link stream
+     * @param delta duration of a bucket
+     * @param max_buckets largest accepted number of buckets
+     * @return the num_vertices x num_vertices sparse matrices of the occupied buckets with their ids
+     */
+    template<typename DirectedS>
+    AggregatedSnapshots aggregate(LinkStreamBase<DirectedS> &g, time_t delta,
+                                  std::size_t max_buckets = default_max_buckets)
+    {
+        auto tensor = aggregate_tensor(g, delta, max_buckets);
+        auto n = static_cast<Eigen::Index>(tensor.num_vertices);
+        AggregatedSnapshots res;
+        res.origin = tensor.origin;
+        res.delta = tensor.delta;
+        res.num_buckets = tensor.num_buckets;
+        res.buckets = tensor.buckets;
+        res.matrices.assign(tensor.buckets.size(), Eigen::SparseMatrix<double>(n, n));
+        bool symmetric = !g.is_directed();
+
+        parallel_for(0, tensor.buckets.size(), [&](std::size_t b) {
+            std::vector<Eigen::Triplet<double>> triplets;
+            triplets.reserve((symmetric ? 2 : 1) * (tensor.bucket_offsets[b + 1] - tensor.bucket_offsets[b]));
+            for (auto i = tensor.bucket_offsets[b]; i < tensor.bucket_offsets[b + 1]; ++i) {
+                auto s = static_cast<Eigen::Index>(tensor.source[i]);
+                auto t = static_cast<Eigen::Index>(tensor.target[i]);
+                triplets.emplace_back(s, t, tensor.weight[i]);
+                if (symmetric && s != t)
+                    triplets.emplace_back(t, s, tensor.weight[i]);
+            }
+            res.matrices[b].setFromTriplets(triplets.begin(), triplets.end());
+        }, 1);
+        return res;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_AGGREGATION_HPP
@@ -12,80 +12,324 @@
 #ifndef BSTREAM_BIPARTITE_HPP
 #define BSTREAM_BIPARTITE_HPP
 
+#include <algorithm>
 #include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "GraphType.hpp"
+#include "FlatTimeIntervalSet.hpp"
+#include "CSR.hpp"
+#include "parallel.hpp"
 
 namespace boost::bstream
 {
+    enum class projection_weight
+    {
+        co_presence, shared_neighbors, jaccard, overlap
+    };
 
-    void projected_graph(vertex_group group, Bipartite &g, Graph &gproj)
+    /**
+     * @brief Weight and thresholds of weighted_projected_graph
+     */
+    struct projection_options
     {
-        Bipartite gprime(g);
-        gprime.clear_edges();
-        vertex_group group_to_del;
-
-        // remove nodes that don't belong to the group
-        if(vertex_group::top == group)
-            group_to_del = vertex_group::bottom ;
-        else
-            group_to_del = vertex_group::top ;
-
-        gprime.clear_vertex_w_group(group_to_del);
-
-        gproj.copy_graph(gprime);
-        for(auto i = g.vertices().first; i != g.vertices().second; ++i){
-            for(auto j = g.vertices().first; j != g.vertices().second; ++j){
-                for(auto k = g.vertices().first; k != g.vertices().second; ++k){
-                    if(g.has_edge(*i, *k) && g.has_edge(*j, *k) && *i != *k && *j != *k && *i != *j){
-                        gproj.add_edge(g.label(*i), g.label(*j));
-                    }
-                }
+        projection_weight weight = projection_weight::co_presence;
+        time_t min_overlap = 0; ///< pairs co-present less than min_overlap are never emitted
+        std::size_t top_k = 0;  ///< keep the k heaviest edges of every vertex, 0 to keep them all
+    };
+
+    namespace detail
+    {
+        inline vertex_group opposite_group(vertex_group group)
+        {
+            if (group == vertex_group::top)
+                return vertex_group::bottom;
+            else if (group == vertex_group::bottom)
+                return vertex_group::top;
+            throw BipartiteBaseException("Unkown group");
+        }
+
+        /**
+         * @brief Add the vertices of one group of g to gproj, in the order of their group id.
+         * @return the vertex of gproj of each vertex of g, indexed by the vertex_t of g, n for the
+         * vertices of the other group
+         */
+        template<typename Bip, typename Proj>
+        std::vector<std::size_t> project_vertices(vertex_group group, Bip &g, Proj &gproj)
+        {
+            auto n = static_cast<std::size_t>(g.num_vertices());
+            std::vector<std::size_t> proj(n, n);
+            for (auto v : g.group_vertices(group))
+                proj[v] = gproj.add_vertex(g.label(v));
+            return proj;
+        }
+
+        /**
+         * @brief Number of projected edges to reserve, from the degrees of the other group.
+         *
+         * The number of projected edges is bounded by the sum of d(d-1)/2 over the other group, which
+         * a single hub makes quadratic. The reservation is capped by the sum of the degrees so that the
+         * scratch table stays linear in the size of g, the table grows beyond it when needed.
+         */
+        template<typename Bip>
+        std::size_t projected_edges_reserve(vertex_group other, Bip &g, std::size_t num_projected)
+        {
+            std::size_t pairs = 0, degrees = 0;
+            for (auto w : g.group_vertices(other)) {
+                auto d = static_cast<std::size_t>(g.degree(w));
+                pairs += d * (d - (d > 0)) / 2;
+                degrees += d;
             }
+            return std::min({pairs, degrees, num_projected * (num_projected - (num_projected > 0)) / 2});
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Projection of a bipartite graph onto one of its groups.
+     *
+     * Two vertices of the group are linked in gproj if they have a common neighbor in g. The vertices
+     * of the group are added in one pass and the edges are generated from the pairs of neighbors of
+     * every vertex of the other group, g is only read.
+     *
+     * @param group group of the vertices kept in the projection
+     * @param g bipartite graph
+     * @param gproj empty graph receiving the projection
+     */
+    inline void projected_graph(vertex_group group, Bipartite &g, Graph &gproj)
+    {
+        auto other = detail::opposite_group(group);
+        auto proj = detail::project_vertices(group, g, gproj);
+        auto n = proj.size();
+        auto num_projected = static_cast<std::size_t>(gproj.num_vertices());
+
+        std::unordered_set<std::size_t> pairs;
+        pairs.reserve(detail::projected_edges_reserve(other, g, num_projected));
+        std::vector<std::size_t> members;
+        for (auto w : g.group_vertices(other)) {
+            members.clear();
+            for (auto u = g.neighbors(w).first; u != g.neighbors(w).second; ++u)
+                if (proj[*u] != n)
+                    members.push_back(proj[*u]);
+            std::sort(members.begin(), members.end());
+            for (std::size_t i = 0; i < members.size(); ++i)
+                for (std::size_t j = i + 1; j < members.size(); ++j)
+                    if (members[i] != members[j])
+                        pairs.insert(members[i] * num_projected + members[j]);
         }
+
+        ///< insert the edges in a deterministic order
+        std::vector<std::size_t> keys(pairs.begin(), pairs.end());
+        std::sort(keys.begin(), keys.end());
+        for (auto key : keys)
+            gproj.add_edge(key / num_projected, key % num_projected);
     }
 
-    void projected_graph(vertex_group group, BiLinkStream &g, LinkStream &gproj)
+    /**
+     * @brief Projection of a bipartite link stream onto one of its groups.
+     *
+     * Two vertices of the group are linked in gproj while they are both linked to a common neighbor
+     * in g. The time intervals of a projected edge are the union over the common neighbors w of the
+     * intersections of the intervals of (u, w) and (v, w). g is only read, the intervals are
+     * accumulated in a hash map reserved for at most the number of edges of g.
+     *
+     * @param group group of the vertices kept in the projection
+     * @param g bipartite link stream
+     * @param gproj empty link stream receiving the projection
+     */
+    inline void projected_graph(vertex_group group, BiLinkStream &g, LinkStream &gproj)
     {
-        BiLinkStream gprime(g);
-        gprime.clear_edges();
-        vertex_group group_to_del;
+        auto other = detail::opposite_group(group);
 
         // set the definition interval of gproj
         time_t tb, te;
-
         std::tie(tb, te) = g.definition();
         gproj.set_definition(tb, te);
 
-        // remove nodes that don't belong to the group
-        if(group == vertex_group::top) {
-            group_to_del = vertex_group::bottom;
-        }else if(group == vertex_group::bottom){
-            group_to_del = vertex_group::top ;
-        }else {
-            throw std::runtime_error("Unkown group");
+        auto proj = detail::project_vertices(group, g, gproj);
+        auto n = proj.size();
+        auto num_projected = static_cast<std::size_t>(gproj.num_vertices());
+
+        std::unordered_map<std::size_t, FlatTimeIntervalSet> pairs;
+        pairs.reserve(detail::projected_edges_reserve(other, g, num_projected));
+        std::vector<std::pair<std::size_t, FlatTimeIntervalSet>> members;
+        for (auto w : g.group_vertices(other)) {
+            members.clear();
+            for (auto u = g.neighbors(w).first; u != g.neighbors(w).second; ++u) {
+                if (proj[*u] == n)
+                    continue;
+                auto tis = g.edge_tinterval_set(w, *u);
+                members.emplace_back(proj[*u], FlatTimeIntervalSet(tis));
+            }
+            std::sort(members.begin(), members.end(),
+                      [](const auto &a, const auto &b) { return a.first < b.first; });
+            for (std::size_t i = 0; i < members.size(); ++i) {
+                for (std::size_t j = i + 1; j < members.size(); ++j) {
+                    if (members[i].first == members[j].first)
+                        continue;
+                    auto common = members[i].second.intersection(members[j].second);
+                    if (common.empty())
+                        continue;
+                    auto key = members[i].first * num_projected + members[j].first;
+                    auto it = pairs.find(key);
+                    if (it == pairs.end())
+                        pairs.emplace(key, std::move(common));
+                    else
+                        it->second = it->second.set_union(common);
+                }
+            }
         }
-        gprime.clear_vertex_w_group(group_to_del);
-
-        // todo make sure gproj is empty add new tests case
-        gproj.copy_graph(gprime);
-        for(auto i = g.vertices().first; i != g.vertices().second; ++i){
-            for(auto j = g.vertices().first; j != g.vertices().second; ++j){
-                for(auto k = g.vertices().first; k != g.vertices().second; ++k){
-                    if(g.has_edge(*i, *k) && g.has_edge(*j, *k) && *i != *k && *j != *k && *i != *j){
-                        //compute the union of the two interval from edges (i,k) and (j,k)
-                        auto t1 = g.edge_tinterval_set(*i, *k);
-                        auto t2 = g.edge_tinterval_set(*j, *k);
-                        if(t1.intersects(t2)){
-                            auto intersection = t1.intersection(t2);
-                            gproj.add_edge_w_time(g.label(*i), g.label(*j), intersection);
-                        }
+
+        ///< insert the edges in a deterministic order
+        std::vector<std::size_t> keys;
+        keys.reserve(pairs.size());
+        for (auto &p : pairs)
+            keys.push_back(p.first);
+        std::sort(keys.begin(), keys.end());
+        for (auto key : keys) {
+            auto tis = pairs[key].to_time_interval_set();
+            tis.set_definition(tb, te);
+            gproj.add_edge_w_time(key / num_projected, key % num_projected, tis);
+        }
+    }
+
+    /**
+     * @brief Weighted projection of a bipartite link stream onto one of its groups.
+     *
+     * Two vertices u and v of the group are co-present while they are both linked to a common
+     * neighbor. The weight of the edge (u, v) of gproj is, depending on options.weight:
+     *  - co_presence: the total duration of co-presence,
+     *  - shared_neighbors: the number of distinct neighbors at which they have been co-present,
+     *  - jaccard: the co-presence duration divided by the duration during which u or v is linked,
+     *  - overlap: the co-presence duration divided by the smallest presence duration of u and v,
+     * where the presence of a vertex is the union of the intervals of its edges.
+     *
+     * The projection is swept one vertex at a time, in parallel: the co-presence of u with all the
+     * other vertices is accumulated in a per-thread row, the thresholds are applied to the row and
+     * only the surviving edges are kept, so that the pairs below options.min_overlap, or outside the
+     * options.top_k heaviest edges of both of their end points, are never materialized.
+     *
+     * @param group group of the vertices kept in the projection
+     * @param g bipartite link stream
+     * @param gproj empty graph receiving the weighted projection
+     * @param options projection_options
+     */
+    inline void weighted_projected_graph(vertex_group group, BiLinkStream &g, Graph &gproj,
+                                         const projection_options &options = projection_options())
+    {
+        detail::opposite_group(group);
+        auto proj = detail::project_vertices(group, g, gproj);
+        auto n = proj.size();
+        auto num_projected = static_cast<std::size_t>(gproj.num_vertices());
+        auto csr = make_csr(g);
+
+        const auto &members = g.group_vertices(group);
+
+        std::vector<FlatTimeIntervalSet> edge_presence;
+        edge_presence.reserve(csr.num_edges);
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto tis = g.edge_tinterval_set(*it);
+            edge_presence.emplace_back(tis);
+        }
+
+        bool relative = options.weight == projection_weight::jaccard || options.weight == projection_weight::overlap;
+        std::vector<FlatTimeIntervalSet> presence(relative ? num_projected : 0);
+        parallel_for(0, presence.size(), [&](std::size_t p) {
+            auto u = members[p];
+            for (auto i = csr.offsets[u]; i < csr.offsets[u + 1]; ++i)
+                presence[p] = presence[p].set_union(edge_presence[csr.edge_ids[i]]);
+        });
+
+        struct row_scratch
+        {
+            std::vector<std::size_t> slot, touched, shared;
+            std::vector<FlatTimeIntervalSet> common;
+            std::vector<std::pair<double, std::size_t>> candidates;
+            std::vector<std::tuple<std::size_t, std::size_t, double>> edges;
+        };
+        std::vector<row_scratch> rows(num_threads());
+
+        parallel_for_threads(0, num_projected, [&](std::size_t p, unsigned tid) {
+            auto &r = rows[tid];
+            if (r.slot.empty())
+                r.slot.assign(num_projected, n);
+            auto u = members[p];
+
+            ///< co-presence of u with every vertex sharing a neighbor with it
+            for (auto i = csr.offsets[u]; i < csr.offsets[u + 1]; ++i) {
+                auto w = csr.targets[i];
+                const auto &uw = edge_presence[csr.edge_ids[i]];
+                for (auto j = csr.offsets[w]; j < csr.offsets[w + 1]; ++j) {
+                    auto q = proj[csr.targets[j]];
+                    if (q == n || q == p)
+                        continue;
+                    auto common = uw.intersection(edge_presence[csr.edge_ids[j]]);
+                    if (common.empty())
+                        continue;
+                    if (r.slot[q] == n) {
+                        r.slot[q] = r.touched.size();
+                        r.touched.push_back(q);
+                        r.common.push_back(std::move(common));
+                        r.shared.push_back(1);
+                    } else {
+                        auto k = r.slot[q];
+                        r.common[k] = r.common[k].set_union(common);
+                        ++r.shared[k];
                     }
                 }
             }
+
+            ///< thresholds applied on the row before anything is emitted
+            r.candidates.clear();
+            for (std::size_t k = 0; k < r.touched.size(); ++k) {
+                auto q = r.touched[k];
+                auto duration = r.common[k].length();
+                if (duration < options.min_overlap)
+                    continue;
+                double weight = static_cast<double>(duration);
+                if (options.weight == projection_weight::shared_neighbors) {
+                    weight = static_cast<double>(r.shared[k]);
+                } else if (options.weight == projection_weight::jaccard) {
+                    auto both = presence[p].intersection(presence[q]).length();
+                    weight /= static_cast<double>(presence[p].length() + presence[q].length() - both);
+                } else if (options.weight == projection_weight::overlap) {
+                    weight /= static_cast<double>(std::min(presence[p].length(), presence[q].length()));
+                }
+                r.candidates.emplace_back(weight, q);
+            }
+            if (options.top_k != 0 && r.candidates.size() > options.top_k) {
+                std::nth_element(r.candidates.begin(), r.candidates.begin() + options.top_k - 1, r.candidates.end(),
+                                 [](const auto &a, const auto &b) { return a.first > b.first; });
+                r.candidates.resize(options.top_k);
+            }
+            for (auto &c : r.candidates) {
+                ///< without top-k both end points keep the edge, it is emitted once
+                if (options.top_k == 0 && c.second < p)
+                    continue;
+                r.edges.emplace_back(std::min(p, c.second), std::max(p, c.second), c.first);
+            }
+
+            for (auto q : r.touched)
+                r.slot[q] = n;
+            r.touched.clear();
+            r.common.clear();
+            r.shared.clear();
+        }, 16);
+
+        std::vector<std::tuple<std::size_t, std::size_t, double>> edges;
+        for (auto &r : rows)
+            edges.insert(edges.end(), r.edges.begin(), r.edges.end());
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end(), [](const auto &a, const auto &b) {
+            return std::get<0>(a) == std::get<0>(b) && std::get<1>(a) == std::get<1>(b);
+        }), edges.end());
+        for (auto &e : edges) {
+            gproj.add_edge(std::get<0>(e), std::get<1>(e));
+            gproj.set_edge_weight(std::get<0>(e), std::get<1>(e), std::get<2>(e));
         }
     }
 }
 
-
 #endif //BSTREAM_BIPARTITE_HPP
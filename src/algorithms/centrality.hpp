@@ -0,0 +1,383 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       centrality.hpp
+/// @brief      Centrality measures on graphs
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_CENTRALITY_HPP
+#define BSTREAM_CENTRALITY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <Eigen/Core>
+
+#include "GraphType.hpp"
+#include "CSR.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @brief Stopping criteria of the power iterations of pagerank and katz_centrality
+     */
+    struct power_iteration_options
+    {
+        double tolerance = 1e-6;          ///< stop when the l1 change of the scores is below n * tolerance
+        std::size_t max_iterations = 100; ///< a GraphBaseException is thrown past this number of iterations
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief In-adjacency of a graph with the weight of every edge and the total weight of the
+         * out-edges of every vertex.
+         *
+         * The in-neighbors of v are in.targets[in.offsets[v]] ..., with the weights weight[...]. An
+         * undirected edge is taken in both directions and a self loop once, as in networkx.
+         */
+        struct weighted_in_adjacency
+        {
+            CSRGraph in;
+            std::vector<double> weight;
+            std::vector<double> out_weight;
+        };
+
+        template<typename DirectedS>
+        weighted_in_adjacency make_weighted_in_adjacency(GraphBase<DirectedS> &g)
+        {
+            std::vector<double> edge_weights;
+            edge_weights.reserve(static_cast<std::size_t>(g.num_edges()));
+            for (auto it = g.edges().first; it != g.edges().second; ++it) {
+                edge_weights.push_back(g.edge_weight(*it));
+                if (edge_weights.back() < 0)
+                    throw GraphBaseException("the edge weights must be non negative");
+            }
+
+            weighted_in_adjacency a;
+            auto out = make_csr(g);
+            a.out_weight.assign(out.num_vertices, 0.0);
+            for (std::size_t v = 0; v < out.num_vertices; ++v)
+                for (auto i = out.offsets[v]; i < out.offsets[v + 1]; ++i)
+                    a.out_weight[v] += edge_weights[out.edge_ids[i]];
+            a.in = g.is_directed() ? transpose(out) : std::move(out);
+            a.weight.resize(a.in.targets.size());
+            for (std::size_t i = 0; i < a.weight.size(); ++i)
+                a.weight[i] = edge_weights[a.in.edge_ids[i]];
+            return a;
+        }
+
+        /**
+         * @brief Power iteration x <- f(x) on k vectors of n entries stored row by row, x[v * k + c].
+         *
+         * prepare(x) is called at the start of every iteration, then step(v, x, y) writes the k
+         * entries of the row v of f(x) into y. The rows are computed in
+         * parallel by blocks, and the l1 change of every vector is summed per block then over the
+         * blocks in order, so that the result does not depend on the number of threads. The iteration
+         * stops when the change of every vector is below n * tolerance.
+         */
+        template<typename Prepare, typename Step>
+        void power_iteration(std::size_t n, std::size_t k, std::vector<double> &x, Prepare prepare, Step step,
+                             const power_iteration_options &options, const char *name)
+        {
+            constexpr std::size_t block = 1024;
+            auto num_blocks = (n + block - 1) / block;
+            std::vector<double> y(x.size()), change(num_blocks * k);
+            for (std::size_t iteration = 0; iteration < options.max_iterations; ++iteration) {
+                prepare(x);
+                parallel_for(0, num_blocks, [&](std::size_t b) {
+                    std::fill(change.begin() + b * k, change.begin() + (b + 1) * k, 0.0);
+                    for (auto v = b * block; v < std::min(n, (b + 1) * block); ++v) {
+                        step(v, x, y.data() + v * k);
+                        for (std::size_t c = 0; c < k; ++c)
+                            change[b * k + c] += std::abs(y[v * k + c] - x[v * k + c]);
+                    }
+                }, 1);
+                x.swap(y);
+                bool converged = true;
+                for (std::size_t c = 0; c < k && converged; ++c) {
+                    double err = 0.0;
+                    for (std::size_t b = 0; b < num_blocks; ++b)
+                        err += change[b * k + c];
+                    converged = err < static_cast<double>(n) * options.tolerance;
+                }
+                if (converged)
+                    return;
+            }
+            throw GraphBaseException(std::string(name) + " failed to converge in " +
+                                     std::to_string(options.max_iterations) + " iterations");
+        }
+
+        /**
+         * @brief PageRank of k personalization vectors stored row by row, p[v * k + c], each summing
+         * to 1. The random walk follows the out-edges with a probability proportional to their
+         * weight, and restarts from p from the vertices without out-edges.
+         */
+        inline std::vector<double> pagerank(const weighted_in_adjacency &a, const std::vector<double> &p,
+                                            std::size_t k, double alpha, const power_iteration_options &options)
+        {
+            auto n = a.in.num_vertices;
+            std::vector<double> x(p), dangling(k);
+            ///< the walkers on a vertex without out-edges restart from p
+            auto prepare = [&](const std::vector<double> &x) {
+                std::fill(dangling.begin(), dangling.end(), 0.0);
+                for (std::size_t u = 0; u < n; ++u)
+                    if (a.out_weight[u] == 0)
+                        for (std::size_t c = 0; c < k; ++c)
+                            dangling[c] += alpha * x[u * k + c];
+            };
+            auto step = [&](std::size_t v, const std::vector<double> &x, double *y) {
+                for (std::size_t c = 0; c < k; ++c)
+                    y[c] = (dangling[c] + 1.0 - alpha) * p[v * k + c];
+                for (auto i = a.in.offsets[v]; i < a.in.offsets[v + 1]; ++i) {
+                    auto u = a.in.targets[i];
+                    auto w = alpha * a.weight[i] / a.out_weight[u];
+                    for (std::size_t c = 0; c < k; ++c)
+                        y[c] += w * x[u * k + c];
+                }
+            };
+            power_iteration(n, k, x, prepare, step, options, "pagerank");
+            return x;
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Betweenness centrality of every vertex, computed with the algorithm of Brandes.
+     *
+     * Every source runs one breadth first search followed by the accumulation of the dependencies
+     * in reverse order of distance. The sources are spread over the threads, each thread owning its
+     * own work arrays and accumulator, the accumulators being summed at the end. When k is non zero
+     * only k sources sampled uniformly are used and the result is extrapolated by n / k. The scaling
+     * follows networkx: normalized values are divided by (n-1)(n-2), otherwise the values of
+     * undirected graphs are halved.
+     *
+     * @param g graph
+     * @param normalized normalize by the number of pairs of vertices
+     * @param k number of sampled sources, 0 for all the vertices
+     * @param seed seed of the source sampling
+     * @return the betweenness of each vertex indexed by vertex_t
+     */
+    template<typename DirectedS>
+    std::vector<double> betweenness_centrality(GraphBase<DirectedS> &g, bool normalized = true,
+                                               std::size_t k = 0, unsigned seed = 0)
+    {
+        auto out = make_csr(g);
+        CSRGraph transposed;
+        if (g.is_directed())
+            transposed = transpose(out);
+        const CSRGraph &in = g.is_directed() ? transposed : out;
+        auto n = out.num_vertices;
+
+        std::vector<std::size_t> sources(n);
+        std::iota(sources.begin(), sources.end(), 0);
+        bool sampled = k != 0 && k < n;
+        if (sampled) {
+            std::mt19937 rng(seed);
+            for (std::size_t i = 0; i < k; ++i) {
+                std::uniform_int_distribution<std::size_t> pick(i, n - 1);
+                std::swap(sources[i], sources[pick(rng)]);
+            }
+            sources.resize(k);
+        }
+
+        struct workspace
+        {
+            std::vector<std::int64_t> dist;
+            std::vector<double> sigma, delta, betweenness;
+            std::vector<std::size_t> order;
+        };
+        std::vector<workspace> work(num_threads());
+
+        parallel_for_threads(0, sources.size(), [&](std::size_t i, unsigned tid) {
+            auto &w = work[tid];
+            if (w.dist.empty()) {
+                w.dist.assign(n, -1);
+                w.sigma.assign(n, 0.0);
+                w.delta.assign(n, 0.0);
+                w.betweenness.assign(n, 0.0);
+                w.order.reserve(n);
+            }
+            auto s = sources[i];
+
+            ///< breadth first search counting the shortest paths, order is the visit order
+            w.order.clear();
+            w.order.push_back(s);
+            w.dist[s] = 0;
+            w.sigma[s] = 1.0;
+            for (std::size_t head = 0; head < w.order.size(); ++head) {
+                auto v = w.order[head];
+                for (auto j = out.offsets[v]; j < out.offsets[v + 1]; ++j) {
+                    auto u = out.targets[j];
+                    if (w.dist[u] == -1) {
+                        w.dist[u] = w.dist[v] + 1;
+                        w.order.push_back(u);
+                    }
+                    if (w.dist[u] == w.dist[v] + 1)
+                        w.sigma[u] += w.sigma[v];
+                }
+            }
+
+            ///< dependencies, the predecessors of v are its in-neighbors one hop closer to s
+            for (auto it = w.order.rbegin(); it != w.order.rend(); ++it) {
+                auto v = *it;
+                for (auto j = in.offsets[v]; j < in.offsets[v + 1]; ++j) {
+                    auto u = in.targets[j];
+                    if (w.dist[u] == w.dist[v] - 1)
+                        w.delta[u] += w.sigma[u] / w.sigma[v] * (1.0 + w.delta[v]);
+                }
+                if (v != s)
+                    w.betweenness[v] += w.delta[v];
+            }
+
+            for (auto v : w.order) {
+                w.dist[v] = -1;
+                w.sigma[v] = 0.0;
+                w.delta[v] = 0.0;
+            }
+        }, 1);
+
+        std::vector<double> betweenness(n, 0.0);
+        for (auto &w : work) {
+            for (std::size_t v = 0; v < w.betweenness.size(); ++v)
+                betweenness[v] += w.betweenness[v];
+        }
+
+        double scale = 1.0;
+        bool rescale = false;
+        if (normalized && n > 2) {
+            scale = 1.0 / (static_cast<double>(n - 1) * static_cast<double>(n - 2));
+            rescale = true;
+        } else if (!normalized && !g.is_directed()) {
+            scale = 0.5;
+            rescale = true;
+        }
+        if (rescale && sampled)
+            scale *= static_cast<double>(n) / static_cast<double>(k);
+        if (rescale) {
+            for (auto &b : betweenness)
+                b *= scale;
+        }
+        return betweenness;
+    }
+
+    /**
+     * @brief PageRank of the vertices, with the conventions of networkx.
+     *
+     * The random walk follows an out-edge with a probability proportional to its weight with
+     * probability alpha, and jumps to a uniformly chosen vertex otherwise or when it is on a vertex
+     * without out-edges. The scores are computed by power iteration, every iteration being one
+     * parallel sparse matrix-vector product over the in-adjacency of g, so that the dense adjacency
+     * matrix is never built.
+     *
+     * @param g graph or directed graph, the weights are given by edge_weight and must be non negative
+     * @param alpha damping factor
+     * @param options convergence tolerance and maximum number of iterations
+     * @return the PageRank of each vertex indexed by vertex_t, summing to 1
+     */
+    template<typename DirectedS>
+    std::vector<double> pagerank(GraphBase<DirectedS> &g, double alpha = 0.85,
+                                 const power_iteration_options &options = power_iteration_options())
+    {
+        auto a = detail::make_weighted_in_adjacency(g);
+        auto n = a.in.num_vertices;
+        if (n == 0)
+            return {};
+        std::vector<double> p(n, 1.0 / static_cast<double>(n));
+        return detail::pagerank(a, p, 1, alpha, options);
+    }
+
+    /**
+     * @brief Personalized PageRank of several personalization vectors at once.
+     *
+     * Same walk as pagerank, except that the jumps go to a vertex drawn from the personalization
+     * vector. The k vectors are iterated together, every edge being read once per iteration for all
+     * of them (sparse matrix times dense matrix product), and the iteration stops when all of them
+     * have converged.
+     *
+     * @param g graph or directed graph, the weights are given by edge_weight and must be non negative
+     * @param seeds n x k matrix whose columns are the personalization vectors, indexed by vertex_t,
+     * non negative and not all zero, normalized to sum 1
+     * @param alpha damping factor
+     * @param options convergence tolerance and maximum number of iterations
+     * @return the n x k matrix of the PageRank of each vertex for each personalization vector
+     */
+    template<typename DirectedS>
+    MatrixXd personalized_pagerank(GraphBase<DirectedS> &g, const MatrixXd &seeds, double alpha = 0.85,
+                                   const power_iteration_options &options = power_iteration_options())
+    {
+        auto a = detail::make_weighted_in_adjacency(g);
+        auto n = a.in.num_vertices;
+        if (static_cast<std::size_t>(seeds.rows()) != n)
+            throw GraphBaseException("the seed matrix must have one row per vertex");
+        auto k = static_cast<std::size_t>(seeds.cols());
+        std::vector<double> p(n * k);
+        for (std::size_t c = 0; c < k; ++c) {
+            if ((seeds.col(c).array() < 0).any() || !(seeds.col(c).sum() > 0))
+                throw GraphBaseException("a personalization vector must be non negative and not all zero");
+            auto sum = seeds.col(c).sum();
+            for (std::size_t v = 0; v < n; ++v)
+                p[v * k + c] = seeds(v, c) / sum;
+        }
+
+        MatrixXd result(n, k);
+        if (n == 0 || k == 0)
+            return result;
+        auto x = detail::pagerank(a, p, k, alpha, options);
+        for (std::size_t v = 0; v < n; ++v)
+            for (std::size_t c = 0; c < k; ++c)
+                result(v, c) = x[v * k + c];
+        return result;
+    }
+
+    /**
+     * @brief Katz centrality of the vertices, with the conventions of networkx.
+     *
+     * x is the fixed point of x_v = alpha sum_{u -> v} w(u, v) x_u + beta, computed by power
+     * iteration from 0 with parallel sparse matrix-vector products. It converges when alpha is
+     * smaller than the inverse of the largest eigenvalue of the weighted adjacency matrix.
+     *
+     * @param g graph or directed graph, the weights are given by edge_weight and must be non negative
+     * @param alpha attenuation factor
+     * @param beta weight given to every vertex
+     * @param normalized divide the scores by their euclidean norm
+     * @param options convergence tolerance and maximum number of iterations
+     * @return the Katz centrality of each vertex indexed by vertex_t
+     */
+    template<typename DirectedS>
+    std::vector<double> katz_centrality(GraphBase<DirectedS> &g, double alpha = 0.1, double beta = 1.0,
+                                        bool normalized = true,
+                                        const power_iteration_options &options = power_iteration_options())
+    {
+        auto a = detail::make_weighted_in_adjacency(g);
+        auto n = a.in.num_vertices;
+        std::vector<double> x(n, 0.0);
+        auto step = [&](std::size_t v, const std::vector<double> &x, double *y) {
+            double sum = 0.0;
+            for (auto i = a.in.offsets[v]; i < a.in.offsets[v + 1]; ++i)
+                sum += a.weight[i] * x[a.in.targets[i]];
+            *y = alpha * sum + beta;
+        };
+        detail::power_iteration(n, 1, x, [](const std::vector<double> &) {}, step, options, "katz_centrality");
+        if (normalized) {
+            double norm = 0.0;
+            for (auto s : x)
+                norm += s * s;
+            norm = std::sqrt(norm);
+            if (norm > 0)
+                for (auto &s : x)
+                    s /= norm;
+        }
+        return x;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_CENTRALITY_HPP
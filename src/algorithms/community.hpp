@@ -0,0 +1,457 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       community.hpp
+/// @brief      Modularity and parallel Louvain / Leiden community detection
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_COMMUNITY_HPP
+#define BSTREAM_COMMUNITY_HPP
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "CSR.hpp"
+#include "parallel.hpp"
+#include "union_find.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @brief Parameters of louvain
+     */
+    struct louvain_options
+    {
+        double resolution = 1.0;    ///< weight of the null model, larger values give smaller communities
+        bool refine = true;         ///< split the communities in connected parts before aggregating (Leiden)
+        std::size_t max_levels = 32;
+        std::size_t max_sweeps = 64; ///< maximum number of local moving sweeps per level
+        double tolerance = 1e-7;    ///< a level stops when a sweep improves the modularity by less
+    };
+
+    /**
+     * @brief Result of louvain
+     */
+    struct community_partition
+    {
+        std::vector<std::size_t> membership; ///< community of each vertex, numbered from 0 by first vertex
+        double modularity = 0.0;
+        std::size_t levels = 0;              ///< number of aggregation levels
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Symmetric weighted adjacency in CSR form.
+         *
+         * Every edge is stored in the rows of its two end points and a self loop once with twice its
+         * weight, so that degree[v], the sum of the row of v, is the weighted degree of v and total the
+         * sum of the degrees (twice the total weight).
+         */
+        struct weighted_csr
+        {
+            std::size_t num_vertices = 0;
+            std::vector<std::size_t> offsets, targets;
+            std::vector<double> weights, degree;
+            double total = 0.0;
+
+            void finish()
+            {
+                degree.assign(num_vertices, 0.0);
+                parallel_for(0, num_vertices, [this](std::size_t v) {
+                    for (auto i = offsets[v]; i < offsets[v + 1]; ++i)
+                        degree[v] += weights[i];
+                }, 1024);
+                total = 0.0;
+                for (auto d : degree)
+                    total += d;
+            }
+        };
+
+        inline weighted_csr make_weighted_csr(Graph &g)
+        {
+            auto csr = make_csr(g);
+            std::vector<double> edge_weights;
+            edge_weights.reserve(csr.num_edges);
+            for (auto it = g.edges().first; it != g.edges().second; ++it) {
+                edge_weights.push_back(g.edge_weight(*it));
+                if (edge_weights.back() < 0)
+                    throw GraphBaseException("modularity is not defined for negative edge weights");
+            }
+
+            weighted_csr w;
+            w.num_vertices = csr.num_vertices;
+            w.offsets = std::move(csr.offsets);
+            w.targets = std::move(csr.targets);
+            w.weights.resize(w.targets.size());
+            parallel_for(0, w.num_vertices, [&](std::size_t v) {
+                for (auto i = w.offsets[v]; i < w.offsets[v + 1]; ++i)
+                    w.weights[i] = edge_weights[csr.edge_ids[i]] * (w.targets[i] == v ? 2.0 : 1.0);
+            }, 1024);
+            w.finish();
+            return w;
+        }
+
+        /**
+         * @brief Renumber the labels of c from 0 in order of first appearance.
+         * @return the number of distinct labels
+         */
+        inline std::size_t renumber(std::vector<std::size_t> &c)
+        {
+            constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+            std::vector<std::size_t> label(c.size(), npos);
+            std::size_t k = 0;
+            for (auto &x : c) {
+                if (label[x] == npos)
+                    label[x] = k++;
+                x = label[x];
+            }
+            return k;
+        }
+
+        inline double modularity(const weighted_csr &g, const std::vector<std::size_t> &c, double resolution)
+        {
+            if (g.total <= 0)
+                return 0.0;
+            std::vector<double> internal(g.num_vertices, 0.0);
+            parallel_for(0, g.num_vertices, [&](std::size_t v) {
+                for (auto i = g.offsets[v]; i < g.offsets[v + 1]; ++i)
+                    if (c[g.targets[i]] == c[v])
+                        internal[v] += g.weights[i];
+            }, 1024);
+            std::vector<double> tot(g.num_vertices, 0.0);
+            double q = 0.0;
+            for (std::size_t v = 0; v < g.num_vertices; ++v) {
+                q += internal[v];
+                tot[c[v]] += g.degree[v];
+            }
+            q /= g.total;
+            for (auto t : tot)
+                q -= resolution * (t / g.total) * (t / g.total);
+            return q;
+        }
+
+        /**
+         * @brief Best community of v given the totals and sizes of the communities, c[v] if no move
+         * improves the modularity.
+         *
+         * empty is the label of an empty community, or any value not smaller than n if there is none
+         * to try. acc and touched are scratch buffers, acc must be zero on entry and is left zero.
+         */
+        inline std::size_t best_community(const weighted_csr &g, std::size_t v, const std::vector<std::size_t> &c,
+                                          const std::vector<double> &tot, const std::vector<std::size_t> &size,
+                                          std::size_t empty, double resolution, bool singleton_rule,
+                                          std::vector<double> &acc, std::vector<std::size_t> &touched)
+        {
+            auto a = c[v];
+            touched.clear();
+            for (auto i = g.offsets[v]; i < g.offsets[v + 1]; ++i) {
+                auto u = g.targets[i];
+                if (u == v)
+                    continue;
+                if (acc[c[u]] == 0.0)
+                    touched.push_back(c[u]);
+                acc[c[u]] += g.weights[i];
+            }
+            auto scale = resolution * g.degree[v] / g.total;
+            auto best = a;
+            auto best_gain = acc[a] - scale * (tot[a] - g.degree[v]);
+            for (auto b : touched) {
+                if (b == a)
+                    continue;
+                ///< two singletons only merge into the smaller label, so that they cannot swap
+                if (singleton_rule && size[a] == 1 && size[b] == 1 && b > a)
+                    continue;
+                auto gain = acc[b] - scale * tot[b];
+                if (gain > best_gain || (gain == best_gain && best != a && b < best)) {
+                    best = b;
+                    best_gain = gain;
+                }
+            }
+            if (empty < size.size() && best_gain < 0) {
+                best = empty;
+                best_gain = 0;
+            }
+            for (auto b : touched)
+                acc[b] = 0.0;
+            acc[a] = 0.0;
+            return best;
+        }
+
+        /**
+         * @brief Local moving phase of Louvain, c is the initial partition and receives the result.
+         *
+         * Every sweep proposes in parallel the best community of every vertex against the state of the
+         * previous sweep, without locks, then applies all the moves (Lu et al., Grappolo). A sweep
+         * that does not improve the modularity by tolerance is replaced by a sequential sweep, where
+         * every move sees the previous ones, and the phase stops when this one does not improve it
+         * either.
+         */
+        inline void local_moving(const weighted_csr &g, std::vector<std::size_t> &c, const louvain_options &options)
+        {
+            auto n = g.num_vertices;
+            std::vector<double> tot(n);
+            std::vector<std::size_t> size(n);
+            auto count = [&](const std::vector<std::size_t> &p) {
+                std::fill(tot.begin(), tot.end(), 0.0);
+                std::fill(size.begin(), size.end(), 0);
+                for (std::size_t v = 0; v < n; ++v) {
+                    tot[p[v]] += g.degree[v];
+                    ++size[p[v]];
+                }
+            };
+
+            struct workspace
+            {
+                std::vector<double> acc;
+                std::vector<std::size_t> touched;
+            };
+            std::vector<workspace> work(num_threads());
+            auto q = modularity(g, c, options.resolution);
+            std::vector<std::size_t> next(n);
+
+            for (std::size_t sweep = 0; sweep < options.max_sweeps; ++sweep) {
+                count(c);
+                parallel_for_threads(0, n, [&](std::size_t v, unsigned tid) {
+                    auto &w = work[tid];
+                    if (w.acc.empty())
+                        w.acc.assign(n, 0.0);
+                    ///< the label v is the only empty community that no other vertex can pick
+                    auto empty = size[v] == 0 ? v : n;
+                    next[v] = best_community(g, v, c, tot, size, empty, options.resolution, true, w.acc, w.touched);
+                }, 256);
+                auto qn = modularity(g, next, options.resolution);
+                if (qn > q + options.tolerance) {
+                    c.swap(next);
+                    q = qn;
+                    continue;
+                }
+
+                next = c;
+                count(next);
+                auto &w = work[0];
+                if (w.acc.empty())
+                    w.acc.assign(n, 0.0);
+                std::vector<std::size_t> free;
+                for (auto x = n; x-- > 0;)
+                    if (size[x] == 0)
+                        free.push_back(x);
+                for (std::size_t v = 0; v < n; ++v) {
+                    auto empty = free.empty() ? n : free.back();
+                    auto b = best_community(g, v, next, tot, size, empty, options.resolution, false, w.acc, w.touched);
+                    if (b != next[v]) {
+                        if (b == empty)
+                            free.pop_back();
+                        tot[next[v]] -= g.degree[v];
+                        if (--size[next[v]] == 0)
+                            free.push_back(next[v]);
+                        tot[b] += g.degree[v];
+                        ++size[b];
+                        next[v] = b;
+                    }
+                }
+                qn = modularity(g, next, options.resolution);
+                auto improved = qn > q + options.tolerance;
+                if (qn > q) {
+                    c.swap(next);
+                    q = qn;
+                }
+                if (!improved)
+                    break;
+            }
+        }
+
+        /**
+         * @brief Split every community of c into its connected parts, labeled by their smallest vertex.
+         */
+        inline std::vector<std::size_t> connected_parts(const weighted_csr &g, const std::vector<std::size_t> &c)
+        {
+            ConcurrentUnionFind uf(g.num_vertices);
+            parallel_for(0, g.num_vertices, [&](std::size_t v) {
+                for (auto i = g.offsets[v]; i < g.offsets[v + 1]; ++i)
+                    if (g.targets[i] < v && c[g.targets[i]] == c[v])
+                        uf.unite(v, g.targets[i]);
+            }, 1024);
+            std::vector<std::size_t> parts(g.num_vertices);
+            parallel_for(0, g.num_vertices, [&](std::size_t v) { parts[v] = uf.find(v); }, 1024);
+            return parts;
+        }
+
+        /**
+         * @brief Graph of the k communities of c, labeled from 0, whose edge weights are the sums of
+         * the weights between the communities.
+         *
+         * The rows of the communities are built in parallel in two passes, one counting the
+         * neighboring communities of every community and one filling the rows.
+         */
+        inline weighted_csr aggregate(const weighted_csr &g, const std::vector<std::size_t> &c, std::size_t k)
+        {
+            std::vector<std::size_t> first(k + 1, 0), members(g.num_vertices);
+            for (auto x : c)
+                ++first[x + 1];
+            for (std::size_t x = 0; x < k; ++x)
+                first[x + 1] += first[x];
+            {
+                std::vector<std::size_t> position(first.begin(), first.end() - 1);
+                for (std::size_t v = 0; v < g.num_vertices; ++v)
+                    members[position[c[v]]++] = v;
+            }
+
+            struct workspace
+            {
+                std::vector<double> acc;
+                std::vector<std::size_t> touched;
+                std::vector<char> seen;
+            };
+            std::vector<workspace> work(num_threads());
+            auto collect = [&](std::size_t x, workspace &w) {
+                if (w.seen.empty()) {
+                    w.acc.assign(k, 0.0);
+                    w.seen.assign(k, 0);
+                }
+                w.touched.clear();
+                for (auto m = first[x]; m < first[x + 1]; ++m) {
+                    auto v = members[m];
+                    for (auto i = g.offsets[v]; i < g.offsets[v + 1]; ++i) {
+                        auto y = c[g.targets[i]];
+                        if (!w.seen[y]) {
+                            w.seen[y] = 1;
+                            w.touched.push_back(y);
+                        }
+                        w.acc[y] += g.weights[i];
+                    }
+                }
+            };
+
+            weighted_csr a;
+            a.num_vertices = k;
+            a.offsets.assign(k + 1, 0);
+            parallel_for_threads(0, k, [&](std::size_t x, unsigned tid) {
+                auto &w = work[tid];
+                collect(x, w);
+                a.offsets[x + 1] = w.touched.size();
+                for (auto y : w.touched) {
+                    w.acc[y] = 0.0;
+                    w.seen[y] = 0;
+                }
+            }, 64);
+            for (std::size_t x = 0; x < k; ++x)
+                a.offsets[x + 1] += a.offsets[x];
+            a.targets.resize(a.offsets[k]);
+            a.weights.resize(a.offsets[k]);
+            parallel_for_threads(0, k, [&](std::size_t x, unsigned tid) {
+                auto &w = work[tid];
+                collect(x, w);
+                auto p = a.offsets[x];
+                for (auto y : w.touched) {
+                    a.targets[p] = y;
+                    a.weights[p++] = w.acc[y];
+                    w.acc[y] = 0.0;
+                    w.seen[y] = 0;
+                }
+            }, 64);
+            a.finish();
+            return a;
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Modularity of a partition of the vertices of a weighted graph.
+     *
+     * Q = sum over the communities c of L_c / m - resolution (d_c / 2m)^2, with L_c the weight of the
+     * edges inside c, d_c the sum of the weighted degrees of its vertices and m the total weight (the
+     * convention of networkx, a self loop counts twice in the degree).
+     *
+     * @param g graph, the weights are given by edge_weight
+     * @param membership community of each vertex indexed by vertex_t, any labels smaller than n
+     * @param resolution weight of the null model
+     * @return the modularity, 0 for a graph without edges
+     */
+    inline double modularity(Graph &g, const std::vector<std::size_t> &membership, double resolution = 1.0)
+    {
+        auto csr = detail::make_weighted_csr(g);
+        if (membership.size() != csr.num_vertices)
+            throw GraphBaseException("the membership must have one entry per vertex");
+        if (std::any_of(membership.begin(), membership.end(), [&](std::size_t x) { return x >= csr.num_vertices; }))
+            throw GraphBaseException("community labels must be smaller than the number of vertices");
+        return detail::modularity(csr, membership, resolution);
+    }
+
+    /**
+     * @brief Community detection by modularity maximization with the Louvain method (Blondel et al.),
+     * optionally with the refinement of Leiden (Traag et al.).
+     *
+     * Each level moves the vertices between communities with parallel sweeps (see
+     * detail::local_moving), then collapses every community into one vertex of a smaller graph, built
+     * in parallel, and starts again on it. With options.refine the communities are first split into
+     * their connected parts, the parts become the vertices of the next level and their initial
+     * communities are the communities they come from, so that the communities found are always
+     * connected. The algorithm stops when a level merges no vertex, and a last local moving phase on
+     * g lets the single vertices leave the communities they were aggregated into.
+     *
+     * @param g graph, the weights are given by edge_weight and must be non negative
+     * @param options resolution, refinement and stopping criteria
+     * @return the community of each vertex indexed by vertex_t, its modularity and the number of levels
+     */
+    inline community_partition louvain(Graph &g, const louvain_options &options = louvain_options())
+    {
+        auto csr = detail::make_weighted_csr(g);
+        auto n = csr.num_vertices;
+        community_partition result;
+        result.membership.resize(n);
+        for (std::size_t v = 0; v < n; ++v)
+            result.membership[v] = v;
+        if (csr.total <= 0)
+            return result;
+
+        ///< membership maps every vertex to a vertex of the current level, c is the partition of the level
+        detail::weighted_csr aggregated;
+        const detail::weighted_csr *level = &csr;
+        std::vector<std::size_t> c(result.membership);
+        while (true) {
+            detail::local_moving(*level, c, options);
+            auto k = detail::renumber(c);
+            if (k == level->num_vertices || result.levels + 1 >= options.max_levels)
+                break;
+
+            auto parts = c;
+            auto kp = k;
+            if (options.refine) {
+                parts = detail::connected_parts(*level, c);
+                kp = detail::renumber(parts);
+                if (kp == level->num_vertices)
+                    break;
+            }
+            for (auto &x : result.membership)
+                x = parts[x];
+            std::vector<std::size_t> next(kp);
+            for (std::size_t v = 0; v < level->num_vertices; ++v)
+                next[parts[v]] = c[v];
+            aggregated = detail::aggregate(*level, parts, kp);
+            level = &aggregated;
+            c.swap(next);
+            ++result.levels;
+        }
+        for (auto &x : result.membership)
+            x = c[x];
+        ///< the moves of single vertices are revisited once on g, splitting a disconnected community never
+        ///< lowers the modularity
+        if (result.levels > 0) {
+            detail::local_moving(csr, result.membership, options);
+            if (options.refine)
+                result.membership = detail::connected_parts(csr, result.membership);
+        }
+        detail::renumber(result.membership);
+        result.modularity = detail::modularity(csr, result.membership, options.resolution);
+        return result;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_COMMUNITY_HPP
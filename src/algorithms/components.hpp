@@ -0,0 +1,323 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       components.hpp
+/// @brief      Connected components of graphs and link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_COMPONENTS_HPP
+#define BSTREAM_COMPONENTS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/strong_components.hpp>
+
+#include "GraphType.hpp"
+#include "CSR.hpp"
+#include "parallel.hpp"
+#include "union_find.hpp"
+
+namespace boost::bstream
+{
+    enum class connectivity_strategy
+    {
+        automatic, offline, recompute
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Renumber arbitrary component ids into [0, c) in the order of the first vertex.
+         */
+        inline std::size_t compact_labels(std::vector<std::size_t> &label)
+        {
+            std::vector<std::size_t> dense(label.size(), label.size());
+            std::size_t c = 0;
+            for (auto &l : label) {
+                if (dense[l] == label.size())
+                    dense[l] = c++;
+                l = dense[l];
+            }
+            return c;
+        }
+
+        struct timed_edge
+        {
+            std::size_t source, target;
+            std::size_t first, last; ///< range [first, last) of elementary segments covered
+        };
+
+        /**
+         * @brief Insert an edge in the segment tree node covering [l, r) and its children.
+         */
+        inline void segment_insert(std::vector<std::vector<std::pair<std::size_t, std::size_t>>> &tree,
+                                   std::size_t node, std::size_t l, std::size_t r, const timed_edge &e)
+        {
+            if (e.last <= l || r <= e.first)
+                return;
+            if (e.first <= l && r <= e.last) {
+                tree[node].emplace_back(e.source, e.target);
+                return;
+            }
+            auto mid = l + (r - l) / 2;
+            segment_insert(tree, 2 * node, l, mid, e);
+            segment_insert(tree, 2 * node + 1, mid, r, e);
+        }
+
+        /**
+         * @brief Depth first traversal of the segment tree, the unions of a node are undone on the way back.
+         *
+         * The leaves are reached in time order, visit(s, uf) is called on the leaf of the segment s.
+         */
+        template<typename Visitor>
+        void segment_traverse(const std::vector<std::vector<std::pair<std::size_t, std::size_t>>> &tree,
+                              std::size_t node, std::size_t l, std::size_t r,
+                              RollbackUnionFind &uf, Visitor &visit)
+        {
+            auto mark = uf.snapshot();
+            for (auto &e : tree[node])
+                uf.unite(e.first, e.second);
+            if (r - l == 1) {
+                visit(l, static_cast<const RollbackUnionFind &>(uf));
+            } else {
+                auto mid = l + (r - l) / 2;
+                segment_traverse(tree, 2 * node, l, mid, uf, visit);
+                segment_traverse(tree, 2 * node + 1, mid, r, uf, visit);
+            }
+            uf.rollback(mark);
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Connected components of a graph, weakly connected components for directed graphs.
+     *
+     * The edges are merged in parallel in a lock-free union-find.
+     *
+     * @param g graph
+     * @return the component of each vertex indexed by vertex_t, components are numbered from 0 in
+     * the order of their first vertex
+     */
+    template<typename DirectedS>
+    std::vector<std::size_t> connected_components(GraphBase<DirectedS> &g)
+    {
+        auto csr = make_csr(g);
+        auto n = csr.num_vertices;
+        bool directed = g.is_directed();
+        ConcurrentUnionFind uf(n);
+        parallel_for(0, n, [&](std::size_t v) {
+            for (auto i = csr.offsets[v]; i < csr.offsets[v + 1]; ++i) {
+                ///< undirected edges are stored twice, merge them once
+                if (directed || csr.targets[i] > v)
+                    uf.unite(v, csr.targets[i]);
+            }
+        }, 256);
+
+        std::vector<std::size_t> label(n);
+        for (std::size_t v = 0; v < n; ++v)
+            label[v] = uf.find(v);
+        detail::compact_labels(label);
+        return label;
+    }
+
+    template<typename DirectedS>
+    std::vector<std::size_t> weakly_connected_components(GraphBase<DirectedS> &g)
+    {
+        return connected_components(g);
+    }
+
+    template<typename DirectedS>
+    std::size_t number_connected_components(GraphBase<DirectedS> &g)
+    {
+        auto label = connected_components(g);
+        return label.empty() ? 0 : *std::max_element(label.begin(), label.end()) + 1;
+    }
+
+    /**
+     * @brief Strongly connected components of a graph, computed with boost::strong_components.
+     *
+     * For undirected graphs they are the connected components.
+     *
+     * @param g graph
+     * @return the component of each vertex indexed by vertex_t, components are numbered from 0 in
+     * the order of their first vertex
+     */
+    template<typename DirectedS>
+    std::vector<std::size_t> strongly_connected_components(GraphBase<DirectedS> &g)
+    {
+        if (!g.is_directed())
+            return connected_components(g);
+
+        auto csr = make_csr(g);
+        typedef adjacency_list<vecS, vecS, directedS> digraph_t;
+        digraph_t h(csr.num_vertices);
+        for (std::size_t v = 0; v < csr.num_vertices; ++v)
+            for (auto i = csr.offsets[v]; i < csr.offsets[v + 1]; ++i)
+                boost::add_edge(v, csr.targets[i], h);
+
+        std::vector<std::size_t> label(csr.num_vertices);
+        boost::strong_components(h, make_iterator_property_map(label.begin(), get(vertex_index, h)));
+        detail::compact_labels(label);
+        return label;
+    }
+
+    /**
+     * @brief Visit the connected components of a link stream on each elementary segment.
+     *
+     * The definition interval is cut into elementary segments at every start and end of an edge
+     * interval, the snapshot graph is constant on each of them. visit(t1, t2, uf) is called once per
+     * segment [t1, t2), in time order, with a union-find holding the components of the snapshot: every
+     * vertex of the link stream is in it, an isolated vertex being its own component, and uf.find(v)
+     * gives the representative of v. The union-find is only valid during the call. Two strategies are
+     * available:
+     *  - offline: every edge interval is stored in the O(log S) nodes of a segment tree over the S
+     *    segments, a depth first traversal with a rollback union-find reaches the segments in order.
+     *    Cost O(I log S log V).
+     *  - recompute: the segments are swept in order and the union-find of each segment is rebuilt
+     *    from the active edges, then rolled back. Cost O(C log V) where C is the number of
+     *    (edge interval, segment) pairs, cheaper when the intervals are short.
+     * The automatic strategy compares C with I log S.
+     *
+     * @param g link stream
+     * @param visit callable as visit(time_t t1, time_t t2, const RollbackUnionFind &uf)
+     * @param strategy connectivity_strategy
+     */
+    template<typename DirectedS, typename Visitor>
+    void temporal_components_visit(LinkStreamBase<DirectedS> &g, Visitor visit,
+                                   connectivity_strategy strategy = connectivity_strategy::automatic)
+    {
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        time_t t_begin, t_end;
+        std::tie(t_begin, t_end) = g.definition();
+
+        ///< elementary segments [times[s], times[s+1])
+        std::vector<std::pair<std::size_t, std::size_t>> endpoints;
+        std::vector<TimeIntervalSet> intervals;
+        std::vector<time_t> times{t_begin, t_end};
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            endpoints.push_back(g.edge_endpoint(*it));
+            intervals.push_back(g.edge_tinterval_set(*it));
+            for (auto ti = intervals.back().begin(); ti != intervals.back().end(); ++ti) {
+                times.push_back(ti->lower());
+                times.push_back(ti->upper());
+            }
+        }
+        std::sort(times.begin(), times.end());
+        times.erase(std::unique(times.begin(), times.end()), times.end());
+        auto num_segments = times.size() - 1;
+        if (num_segments == 0)
+            return;
+        auto segment = [&times](time_t t) {
+            return static_cast<std::size_t>(std::lower_bound(times.begin(), times.end(), t) - times.begin());
+        };
+
+        std::vector<detail::timed_edge> timed_edges;
+        std::size_t coverage = 0;
+        for (std::size_t e = 0; e < endpoints.size(); ++e) {
+            for (auto ti = intervals[e].begin(); ti != intervals[e].end(); ++ti) {
+                detail::timed_edge te{endpoints[e].first, endpoints[e].second, segment(ti->lower()), segment(ti->upper())};
+                coverage += te.last - te.first;
+                timed_edges.push_back(te);
+            }
+        }
+        intervals.clear();
+
+        if (strategy == connectivity_strategy::automatic) {
+            auto depth = std::ceil(std::log2(static_cast<double>(num_segments) + 1.0));
+            strategy = static_cast<double>(coverage) <= static_cast<double>(timed_edges.size()) * depth
+                       ? connectivity_strategy::recompute : connectivity_strategy::offline;
+        }
+
+        auto visit_segment = [&](std::size_t s, const RollbackUnionFind &uf) {
+            visit(times[s], times[s + 1], uf);
+        };
+        RollbackUnionFind uf(n);
+        if (strategy == connectivity_strategy::offline) {
+            std::vector<std::vector<std::pair<std::size_t, std::size_t>>> tree(4 * num_segments);
+            for (auto &te : timed_edges)
+                detail::segment_insert(tree, 1, 0, num_segments, te);
+            detail::segment_traverse(tree, 1, 0, num_segments, uf, visit_segment);
+        } else {
+            ///< edges bucketed by first segment, the active list is swept forward
+            std::sort(timed_edges.begin(), timed_edges.end(),
+                      [](const auto &a, const auto &b) { return a.first < b.first; });
+            std::vector<const detail::timed_edge *> active;
+            std::size_t next = 0;
+            for (std::size_t s = 0; s < num_segments; ++s) {
+                while (next < timed_edges.size() && timed_edges[next].first == s)
+                    active.push_back(&timed_edges[next++]);
+                active.erase(std::remove_if(active.begin(), active.end(),
+                                            [s](const detail::timed_edge *e) { return e->last <= s; }),
+                             active.end());
+                for (auto e : active)
+                    uf.unite(e->source, e->target);
+                visit_segment(s, uf);
+                uf.rollback(0);
+            }
+        }
+    }
+
+    /**
+     * @brief Component of every vertex of a link stream over time.
+     *
+     * Built on temporal_components_visit, the labels of a segment are numbered from 0 in the order of
+     * their first vertex, so that two segments with the same partition of the vertices have the same
+     * labels. Labelling a segment costs O(V log V) on top of the strategy.
+     *
+     * @param g link stream
+     * @param strategy connectivity_strategy
+     * @return the (time, labels) pairs at which the partition of the vertices changes, starting with
+     * the beginning of the definition interval, labels being the component of each vertex indexed by
+     * vertex_t
+     */
+    template<typename DirectedS>
+    std::vector<std::pair<time_t, std::vector<std::size_t>>>
+    temporal_component_labels(LinkStreamBase<DirectedS> &g,
+                              connectivity_strategy strategy = connectivity_strategy::automatic)
+    {
+        std::vector<std::pair<time_t, std::vector<std::size_t>>> evolution;
+        std::vector<std::size_t> label(static_cast<std::size_t>(g.num_vertices()));
+        temporal_components_visit(g, [&](time_t t1, time_t, const RollbackUnionFind &uf) {
+            for (std::size_t v = 0; v < label.size(); ++v)
+                label[v] = uf.find(v);
+            detail::compact_labels(label);
+            if (evolution.empty() || evolution.back().second != label)
+                evolution.emplace_back(t1, label);
+        }, strategy);
+        return evolution;
+    }
+
+    /**
+     * @brief Number of connected components of a link stream over time.
+     *
+     * Summary of temporal_component_labels which only keeps the number of components, read from the
+     * union-find of each segment without labelling the vertices. See temporal_components_visit for the
+     * strategies and their cost.
+     *
+     * @param g link stream
+     * @param strategy connectivity_strategy
+     * @return the (time, number of components) pairs at which the number of components changes,
+     * starting with the beginning of the definition interval
+     */
+    template<typename DirectedS>
+    std::vector<std::pair<time_t, std::size_t>>
+    temporal_connected_components(LinkStreamBase<DirectedS> &g,
+                                  connectivity_strategy strategy = connectivity_strategy::automatic)
+    {
+        std::vector<std::pair<time_t, std::size_t>> evolution;
+        temporal_components_visit(g, [&evolution](time_t t1, time_t, const RollbackUnionFind &uf) {
+            if (evolution.empty() || evolution.back().second != uf.num_components())
+                evolution.emplace_back(t1, uf.num_components());
+        }, strategy);
+        return evolution;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_COMPONENTS_HPP
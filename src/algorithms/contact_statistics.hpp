@@ -0,0 +1,374 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       contact_statistics.hpp
+/// @brief      Contact durations, inter-contact times and burstiness of link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_CONTACT_STATISTICS_HPP
+#define BSTREAM_CONTACT_STATISTICS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @brief Count, mean, variance and extrema of a stream of values (Welford), two accumulators of
+     * disjoint samples being merged with the formula of Chan et al.
+     */
+    class running_moments
+    {
+    public:
+        void add(double x)
+        {
+            ++n;
+            auto d = x - m;
+            m += d / static_cast<double>(n);
+            m2 += d * (x - m);
+            lo = std::min(lo, x);
+            hi = std::max(hi, x);
+        };
+
+        void merge(const running_moments &other)
+        {
+            if (other.n == 0)
+                return;
+            auto total = static_cast<double>(n + other.n);
+            auto d = other.m - m;
+            m += d * static_cast<double>(other.n) / total;
+            m2 += other.m2 + d * d * static_cast<double>(n) * static_cast<double>(other.n) / total;
+            n += other.n;
+            lo = std::min(lo, other.lo);
+            hi = std::max(hi, other.hi);
+        };
+
+        std::size_t count() const
+        {
+            return n;
+        };
+
+        /**
+         * @brief Mean of the values, NaN if there is none.
+         */
+        double mean() const
+        {
+            return n > 0 ? m : std::numeric_limits<double>::quiet_NaN();
+        };
+
+        /**
+         * @brief Population variance of the values, NaN if there is none.
+         */
+        double variance() const
+        {
+            return n > 0 ? m2 / static_cast<double>(n) : std::numeric_limits<double>::quiet_NaN();
+        };
+
+        double min() const
+        {
+            return n > 0 ? lo : std::numeric_limits<double>::quiet_NaN();
+        };
+
+        double max() const
+        {
+            return n > 0 ? hi : std::numeric_limits<double>::quiet_NaN();
+        };
+
+    private:
+        std::size_t n = 0;
+        double m = 0.0, m2 = 0.0;
+        double lo = std::numeric_limits<double>::infinity(), hi = -std::numeric_limits<double>::infinity();
+    };
+
+    /**
+     * @brief Means and co-moments of a stream of pairs (x, y), mergeable as running_moments.
+     */
+    class running_comoments
+    {
+    public:
+        void add(double x, double y)
+        {
+            ++n;
+            auto dx = x - mx, dy = y - my;
+            mx += dx / static_cast<double>(n);
+            my += dy / static_cast<double>(n);
+            cxx += dx * (x - mx);
+            cyy += dy * (y - my);
+            cxy += dx * (y - my);
+        };
+
+        void merge(const running_comoments &other)
+        {
+            if (other.n == 0)
+                return;
+            auto total = static_cast<double>(n + other.n);
+            auto weight = static_cast<double>(n) * static_cast<double>(other.n) / total;
+            auto dx = other.mx - mx, dy = other.my - my;
+            cxx += other.cxx + dx * dx * weight;
+            cyy += other.cyy + dy * dy * weight;
+            cxy += other.cxy + dx * dy * weight;
+            mx += dx * static_cast<double>(other.n) / total;
+            my += dy * static_cast<double>(other.n) / total;
+            n += other.n;
+        };
+
+        std::size_t count() const
+        {
+            return n;
+        };
+
+        /**
+         * @brief Pearson correlation of x and y, NaN with less than 2 pairs or a constant variable.
+         */
+        double correlation() const
+        {
+            if (n < 2 || cxx <= 0.0 || cyy <= 0.0)
+                return std::numeric_limits<double>::quiet_NaN();
+            return cxy / std::sqrt(cxx * cyy);
+        };
+
+    private:
+        std::size_t n = 0;
+        double mx = 0.0, my = 0.0, cxx = 0.0, cyy = 0.0, cxy = 0.0;
+    };
+
+    /**
+     * @brief Histogram with logarithmic bins, the bin i holding the values in [base^i, base^(i+1)).
+     *
+     * The values below 1 are counted in the first bin, durations being at least one time unit. The
+     * bins are allocated as the values arrive, and histograms of the same base can be merged.
+     */
+    class log_histogram
+    {
+    public:
+        explicit log_histogram(double base = 2.0) : b(base), log_b(std::log(base))
+        {
+            if (!(base > 1.0))
+                throw LinkStreamBaseException("the base of a logarithmic histogram must be larger than 1");
+        };
+
+        void add(double x, std::uint64_t count = 1)
+        {
+            std::size_t i = 0;
+            if (x >= b) {
+                i = static_cast<std::size_t>(std::log(x) / log_b);
+                ///< correct the rounding of the logarithm at the bin edges
+                while (i > 0 && std::pow(b, static_cast<double>(i)) > x)
+                    --i;
+                while (std::pow(b, static_cast<double>(i + 1)) <= x)
+                    ++i;
+            }
+            if (i >= bins.size())
+                bins.resize(i + 1, 0);
+            bins[i] += count;
+        };
+
+        void merge(const log_histogram &other)
+        {
+            if (other.b != b)
+                throw LinkStreamBaseException("only histograms with the same base can be merged");
+            if (other.bins.size() > bins.size())
+                bins.resize(other.bins.size(), 0);
+            for (std::size_t i = 0; i < other.bins.size(); ++i)
+                bins[i] += other.bins[i];
+        };
+
+        double base() const
+        {
+            return b;
+        };
+
+        /**
+         * @brief Number of values in every bin, up to the last non empty one.
+         */
+        const std::vector<std::uint64_t> &counts() const
+        {
+            return bins;
+        };
+
+        /**
+         * @brief Edges 1, base, base^2, ... of the bins, one more than the number of bins.
+         */
+        std::vector<double> edges() const
+        {
+            std::vector<double> res(bins.size() + 1);
+            for (std::size_t i = 0; i < res.size(); ++i)
+                res[i] = std::pow(b, static_cast<double>(i));
+            return res;
+        };
+
+    private:
+        double b, log_b;
+        std::vector<std::uint64_t> bins;
+    };
+
+    /**
+     * @brief Statistics of a sequence of contacts [b, e) fed in increasing order of time.
+     *
+     * The inter-contact times are the gaps between the end of a contact and the beginning of the
+     * next one. The burstiness (sigma - mu) / (sigma + mu) and the memory coefficient, the correlation of
+     * consecutive inter-contact times, are those of Goh and Barabási. merge pools the statistics
+     * of another independent sequence (another edge, another shard of a stream), the sequence
+     * continued by add being still this one.
+     */
+    class contact_accumulator
+    {
+    public:
+        void add(time_t b, time_t e)
+        {
+            durations.add(static_cast<double>(e - b));
+            if (has_last) {
+                auto gap = static_cast<double>(b - last_end);
+                gaps.add(gap);
+                if (gaps.count() > 1)
+                    consecutive_gaps.add(last_gap, gap);
+                last_gap = gap;
+            }
+            has_last = true;
+            last_end = e;
+        };
+
+        void merge(const contact_accumulator &other)
+        {
+            durations.merge(other.durations);
+            gaps.merge(other.gaps);
+            consecutive_gaps.merge(other.consecutive_gaps);
+        };
+
+        /**
+         * @brief Burstiness of the inter-contact times, from -1 (periodic) to 1, 0 for a Poisson
+         * process, NaN without inter-contact time.
+         */
+        double burstiness() const
+        {
+            auto mu = gaps.mean(), sigma = std::sqrt(gaps.variance());
+            if (gaps.count() == 0 || sigma + mu <= 0.0)
+                return std::numeric_limits<double>::quiet_NaN();
+            return (sigma - mu) / (sigma + mu);
+        };
+
+        /**
+         * @brief Memory coefficient, NaN with less than 3 inter-contact times.
+         */
+        double memory() const
+        {
+            return consecutive_gaps.correlation();
+        };
+
+        running_moments durations;          ///< durations e - b of the contacts
+        running_moments gaps;               ///< inter-contact times
+        running_comoments consecutive_gaps; ///< pairs of consecutive inter-contact times
+
+    private:
+        bool has_last = false;
+        time_t last_end = 0;
+        double last_gap = 0.0;
+    };
+
+    /**
+     * @brief Contact and inter-contact statistics of a link stream.
+     */
+    struct contact_statistics
+    {
+        log_histogram durations;                   ///< durations of the contacts of all the edges
+        log_histogram gaps;                        ///< inter-contact times of all the edges
+        std::vector<contact_accumulator> edges;    ///< indexed by the rank of the edge in g.edges()
+        std::vector<contact_accumulator> vertices; ///< activity of the vertices, indexed by vertex_t
+    };
+
+    /**
+     * @brief Distributions of the contact durations and inter-contact times of every edge and
+     * vertex of a link stream.
+     *
+     * The contacts of an edge are its time intervals. A vertex is in contact while at least one of
+     * its edges is active, its contacts being the union of the intervals of its edges. The intervals
+     * of every edge are read once, by a parallel pass over the edges that fills per-thread
+     * histograms merged at the end, then the vertices are processed in parallel. The result does
+     * not depend on the number of threads.
+     *
+     * @param g link stream
+     * @param base ratio between the edges of consecutive bins of the histograms
+     * @return the pooled histograms and the statistics of every edge and vertex
+     */
+    template<typename DirectedS>
+    contact_statistics intercontact_statistics(LinkStreamBase<DirectedS> &g, double base = 2.0)
+    {
+        contact_statistics res{log_histogram(base), log_histogram(base), {}, {}};
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        std::vector<typename LinkStreamBase<DirectedS>::edge_t> edges;
+        edges.reserve(static_cast<std::size_t>(g.num_edges()));
+        for (auto it = g.edges().first; it != g.edges().second; ++it)
+            edges.push_back(*it);
+        auto m = edges.size();
+
+        ///< edges of every vertex, bucketed with a counting sort
+        std::vector<std::size_t> offsets(n + 1, 0), incident;
+        for (auto e : edges) {
+            auto ends = g.edge_endpoint(e);
+            ++offsets[ends.first + 1];
+            if (ends.second != ends.first)
+                ++offsets[ends.second + 1];
+        }
+        for (std::size_t v = 0; v < n; ++v)
+            offsets[v + 1] += offsets[v];
+        incident.resize(offsets[n]);
+        std::vector<std::size_t> position(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < m; ++i) {
+            auto ends = g.edge_endpoint(edges[i]);
+            incident[position[ends.first]++] = i;
+            if (ends.second != ends.first)
+                incident[position[ends.second]++] = i;
+        }
+
+        ///< single read of the intervals of every edge, kept for the vertices
+        std::vector<std::vector<std::pair<time_t, time_t>>> contacts(m);
+        std::vector<log_histogram> durations(num_threads(), log_histogram(base));
+        std::vector<log_histogram> gaps(num_threads(), log_histogram(base));
+        res.edges.resize(m);
+        parallel_for_threads(0, m, [&](std::size_t i, unsigned tid) {
+            auto tis = g.edge_tinterval_set(edges[i]);
+            for (auto ti = tis.begin(); ti != tis.end(); ++ti) {
+                if (!contacts[i].empty())
+                    gaps[tid].add(static_cast<double>(ti->lower() - contacts[i].back().second));
+                durations[tid].add(static_cast<double>(ti->upper() - ti->lower()));
+                res.edges[i].add(ti->lower(), ti->upper());
+                contacts[i].emplace_back(ti->lower(), ti->upper());
+            }
+        });
+        ///< the bins hold integer counts, the order of the merge does not matter
+        for (std::size_t t = 0; t < durations.size(); ++t) {
+            res.durations.merge(durations[t]);
+            res.gaps.merge(gaps[t]);
+        }
+
+        ///< contacts of a vertex, the union of the intervals of its edges
+        res.vertices.resize(n);
+        parallel_for(0, n, [&](std::size_t v) {
+            std::vector<std::pair<time_t, time_t>> intervals;
+            for (auto p = offsets[v]; p < offsets[v + 1]; ++p)
+                intervals.insert(intervals.end(), contacts[incident[p]].begin(), contacts[incident[p]].end());
+            std::sort(intervals.begin(), intervals.end());
+            for (std::size_t k = 0; k < intervals.size();) {
+                auto b = intervals[k].first, e = intervals[k].second;
+                for (++k; k < intervals.size() && intervals[k].first <= e; ++k)
+                    e = std::max(e, intervals[k].second);
+                res.vertices[v].add(b, e);
+            }
+        });
+        return res;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_CONTACT_STATISTICS_HPP
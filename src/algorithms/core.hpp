@@ -0,0 +1,371 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       core.hpp
+/// @brief      Core decomposition of graphs and link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_CORE_HPP
+#define BSTREAM_CORE_HPP
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "CSR.hpp"
+#include "FlatTimeIntervalSet.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @brief Core number of every vertex of a graph.
+     *
+     * The core number of v is the largest k such as v belongs to a subgraph in which every vertex has
+     * a degree of at least k. The vertices are peeled by increasing degree with a bucket queue
+     * (Batagelj and Zaversnik) in O(|V| + |E|). Self loops are ignored and the degree of a vertex of a
+     * directed graph is its in-degree + out-degree, a reciprocal pair u->v, v->u counting twice as in
+     * networkx.
+     *
+     * @param g graph
+     * @return the core number of each vertex, indexed by vertex_t
+     */
+    template<typename DirectedS>
+    std::vector<std::size_t> core_number(GraphBase<DirectedS> &g)
+    {
+        auto csr = make_csr(g, true);
+        auto n = csr.num_vertices;
+        std::vector<std::size_t> deg(n, 0);
+        std::size_t max_deg = 0;
+        for (std::size_t v = 0; v < n; ++v) {
+            for (auto i = csr.offsets[v]; i < csr.offsets[v + 1]; ++i)
+                deg[v] += csr.targets[i] != v;
+            max_deg = std::max(max_deg, deg[v]);
+        }
+
+        ///< vertices sorted by degree, bin[d] is the position of the first vertex of degree d
+        std::vector<std::size_t> bin(max_deg + 2, 0), pos(n), vert(n);
+        for (std::size_t v = 0; v < n; ++v)
+            ++bin[deg[v] + 1];
+        for (std::size_t d = 0; d <= max_deg; ++d)
+            bin[d + 1] += bin[d];
+        {
+            std::vector<std::size_t> next(bin.begin(), bin.end() - 1);
+            for (std::size_t v = 0; v < n; ++v) {
+                pos[v] = next[deg[v]]++;
+                vert[pos[v]] = v;
+            }
+        }
+
+        ///< deg[v] becomes the core number of v once v is peeled
+        for (std::size_t i = 0; i < n; ++i) {
+            auto v = vert[i];
+            for (auto j = csr.offsets[v]; j < csr.offsets[v + 1]; ++j) {
+                auto u = csr.targets[j];
+                if (deg[u] > deg[v]) {
+                    ///< move u to the front of its bucket, then shift the bucket boundary
+                    auto du = deg[u];
+                    auto pu = pos[u];
+                    auto pw = bin[du];
+                    auto w = vert[pw];
+                    if (u != w) {
+                        std::swap(vert[pu], vert[pw]);
+                        pos[u] = pw;
+                        pos[w] = pu;
+                    }
+                    ++bin[du];
+                    --deg[u];
+                }
+            }
+        }
+        return deg;
+    }
+
+    /**
+     * @brief Maximal subgraph in which every vertex has a degree of at least k, in-degree + out-degree
+     * for directed graphs.
+     * @param g graph
+     * @param k minimum degree
+     * @param res graph receiving the k-core, the vertices keep their label
+     */
+    template<typename DirectedS>
+    void k_core(GraphBase<DirectedS> &g, std::size_t k, GraphBase<DirectedS> &res)
+    {
+        auto core = core_number(g);
+        for (auto v = g.vertices().first; v != g.vertices().second; ++v) {
+            if (core[*v] >= k && !res.has_vertex(g.label(*v)))
+                res.add_vertex(g.label(*v));
+        }
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto e = g.edge_endpoint(*it);
+            if (e.first != e.second && core[e.first] >= k && core[e.second] >= k)
+                res.add_edge(g.label(e.first), g.label(e.second));
+        }
+    }
+
+    /**
+     * @brief Time during which each vertex belongs to the (k, delta)-core of a link stream.
+     *
+     * The (k, delta)-core is the largest set of (vertex, time) pairs such as every vertex has, at
+     * every instant where it is present, a degree of at least k among the vertices present with it,
+     * and stays present during maximal periods of at least delta. An edge only counts while both of
+     * its end points are present, the degree being in-degree + out-degree as in core_number.
+     *
+     * The vertices whose core number in the aggregated graph is below k can never reach degree k and
+     * are dropped first in O(|V| + |E|). The remaining link stream is cut once at the bounds of its
+     * intervals into elementary segments, on which the active edges do not change. A piece is a
+     * vertex touched by an active edge during a segment: its degree is the number of its active edges
+     * in the segment, and its consecutive pieces in time form the runs of the vertex. The pieces of
+     * degree below k and the runs shorter than delta are peeled with a worklist, every peeled piece
+     * decrementing the degree of the pieces of its neighbors in the same segment and splitting its
+     * run in two, the smaller half being relabeled. With P the number of (edge, segment) pairs of
+     * active edges, the decomposition runs in O(|E| + |I| log |I| + P log P) time and O(P) memory.
+     *
+     * P is not bounded by O(|I|): an edge active over many elementary segments counts once for each
+     * of them, so P reaches |E| x |I| when long-lived edges overlap many short contacts. No exact
+     * algorithm reaches O(|E| + |I| log |I|) since the core itself may hold Theta(|I|^2) intervals:
+     * a path of n edges active over the whole stream, closed into a cycle by an edge with c contacts,
+     * puts each of the n vertices in the (2, 0)-core during the c contacts only.
+     *
+     * @param g link stream
+     * @param k minimum instantaneous degree
+     * @param delta minimum duration of a presence period
+     * @return the presence of each vertex in the core, indexed by vertex_t
+     */
+    template<typename DirectedS>
+    std::vector<FlatTimeIntervalSet>
+    temporal_core_intervals(LinkStreamBase<DirectedS> &g, std::size_t k, time_t delta)
+    {
+        if (delta < 0)
+            throw LinkStreamBaseException("The minimum duration of the core must be positive");
+
+        const auto none = std::numeric_limits<std::size_t>::max();
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        time_t t_begin, t_end;
+        std::tie(t_begin, t_end) = g.definition();
+        std::vector<FlatTimeIntervalSet> alive(n, FlatTimeIntervalSet(t_begin, t_end));
+        if (t_end - t_begin < std::max<time_t>(delta, 1))
+            return alive;
+        if (k == 0) {
+            for (auto &a : alive)
+                a.append(t_begin, t_end);
+            return alive;
+        }
+
+        ///< intervals of the edges of the static k-core, self loops never count in the degree
+        auto static_core = core_number(g);
+        std::vector<std::pair<std::size_t, std::size_t>> endpoints;
+        std::vector<std::pair<time_t, time_t>> intervals;
+        std::vector<std::size_t> interval_edge;
+        std::vector<time_t> times;
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto e = g.edge_endpoint(*it);
+            if (e.first == e.second || static_core[e.first] < k || static_core[e.second] < k)
+                continue;
+            endpoints.emplace_back(e.first, e.second);
+            auto tis = g.edge_tinterval_set(*it);
+            for (auto ti = tis.begin(); ti != tis.end(); ++ti) {
+                intervals.emplace_back(ti->lower(), ti->upper());
+                interval_edge.push_back(endpoints.size() - 1);
+                times.push_back(ti->lower());
+                times.push_back(ti->upper());
+            }
+        }
+        std::sort(times.begin(), times.end());
+        times.erase(std::unique(times.begin(), times.end()), times.end());
+        auto num_segments = times.empty() ? 0 : times.size() - 1;
+        auto segment = [&times](time_t t) {
+            return static_cast<std::size_t>(std::lower_bound(times.begin(), times.end(), t) - times.begin());
+        };
+
+        ///< active edges of every segment, bucketed with a counting sort
+        std::vector<std::size_t> edge_offsets(num_segments + 1, 0);
+        std::vector<std::pair<std::size_t, std::size_t>> ranges(intervals.size());
+        for (std::size_t i = 0; i < intervals.size(); ++i) {
+            ranges[i] = std::make_pair(segment(intervals[i].first), segment(intervals[i].second));
+            for (auto j = ranges[i].first; j < ranges[i].second; ++j)
+                ++edge_offsets[j + 1];
+        }
+        for (std::size_t j = 0; j < num_segments; ++j)
+            edge_offsets[j + 1] += edge_offsets[j];
+        std::vector<std::size_t> active(edge_offsets[num_segments]);
+        {
+            std::vector<std::size_t> position(edge_offsets.begin(), edge_offsets.end() - 1);
+            for (std::size_t i = 0; i < intervals.size(); ++i)
+                for (auto j = ranges[i].first; j < ranges[i].second; ++j)
+                    active[position[j]++] = interval_edge[i];
+        }
+
+        ///< pieces numbered segment by segment, with the pieces of their neighbors in the segment
+        std::vector<std::size_t> piece_vertex, piece_segment, adjacency_offsets(1, 0), adjacency;
+        std::vector<std::size_t> local(n, none);
+        for (std::size_t j = 0; j < num_segments; ++j) {
+            auto base = piece_vertex.size();
+            for (auto i = edge_offsets[j]; i < edge_offsets[j + 1]; ++i) {
+                for (auto v : {endpoints[active[i]].first, endpoints[active[i]].second}) {
+                    if (local[v] == none) {
+                        local[v] = piece_vertex.size();
+                        piece_vertex.push_back(v);
+                        piece_segment.push_back(j);
+                        adjacency_offsets.push_back(0);
+                    }
+                }
+            }
+            for (auto i = edge_offsets[j]; i < edge_offsets[j + 1]; ++i) {
+                ++adjacency_offsets[local[endpoints[active[i]].first] + 1];
+                ++adjacency_offsets[local[endpoints[active[i]].second] + 1];
+            }
+            auto adjacency_base = adjacency.size();
+            for (auto p = base; p < piece_vertex.size(); ++p)
+                adjacency_offsets[p + 1] += p == base ? adjacency_base : adjacency_offsets[p];
+            adjacency.resize(adjacency_offsets.back());
+            std::vector<std::size_t> position(adjacency_offsets.begin() + base, adjacency_offsets.end() - 1);
+            for (auto i = edge_offsets[j]; i < edge_offsets[j + 1]; ++i) {
+                auto s = local[endpoints[active[i]].first], t = local[endpoints[active[i]].second];
+                adjacency[position[s - base]++] = t;
+                adjacency[position[t - base]++] = s;
+            }
+            for (auto p = base; p < piece_vertex.size(); ++p)
+                local[piece_vertex[p]] = none;
+        }
+        auto num_pieces = piece_vertex.size();
+
+        ///< pieces of every vertex in time order, rank[p] being the position of the piece p
+        std::vector<std::size_t> vertex_offsets(n + 1, 0), order(num_pieces), rank(num_pieces);
+        for (auto v : piece_vertex)
+            ++vertex_offsets[v + 1];
+        for (std::size_t v = 0; v < n; ++v)
+            vertex_offsets[v + 1] += vertex_offsets[v];
+        {
+            std::vector<std::size_t> position(vertex_offsets.begin(), vertex_offsets.end() - 1);
+            for (std::size_t p = 0; p < num_pieces; ++p) {
+                rank[p] = position[piece_vertex[p]]++;
+                order[rank[p]] = p;
+            }
+        }
+        ///< duration[r] is the total duration of the pieces before the position r
+        std::vector<time_t> duration(num_pieces + 1, 0);
+        for (std::size_t r = 0; r < num_pieces; ++r) {
+            auto j = piece_segment[order[r]];
+            duration[r + 1] = duration[r] + times[j + 1] - times[j];
+        }
+
+        ///< runs of consecutive pieces as [run_begin, run_end) positions
+        std::vector<std::size_t> run(num_pieces), run_begin, run_end;
+        for (std::size_t v = 0; v < n; ++v) {
+            for (auto r = vertex_offsets[v]; r < vertex_offsets[v + 1]; ++r) {
+                if (r == vertex_offsets[v] || piece_segment[order[r]] != piece_segment[order[r - 1]] + 1) {
+                    run_begin.push_back(r);
+                    run_end.push_back(r);
+                }
+                ++run_end.back();
+                run[order[r]] = run_begin.size() - 1;
+            }
+        }
+
+        std::vector<std::size_t> degree(num_pieces), worklist;
+        std::vector<char> peeled(num_pieces, 0);
+        for (std::size_t p = 0; p < num_pieces; ++p)
+            degree[p] = adjacency_offsets[p + 1] - adjacency_offsets[p];
+        auto peel_run = [&](std::size_t first, std::size_t last) {
+            for (auto r = first; r < last; ++r) {
+                if (!peeled[order[r]]) {
+                    peeled[order[r]] = 1;
+                    worklist.push_back(order[r]);
+                }
+            }
+        };
+        auto peel = [&](std::size_t p) {
+            peeled[p] = 1;
+            worklist.push_back(p);
+            auto id = run[p], first = run_begin[id], last = run_end[id], r = rank[p];
+            ///< the larger half keeps the run id, the smaller one is relabeled
+            bool left_smaller = r - first < last - r - 1;
+            auto relabeled_first = left_smaller ? first : r + 1, relabeled_last = left_smaller ? r : last;
+            if (relabeled_first < relabeled_last) {
+                run_begin.push_back(relabeled_first);
+                run_end.push_back(relabeled_last);
+                for (auto q = relabeled_first; q < relabeled_last; ++q)
+                    run[order[q]] = run_begin.size() - 1;
+            }
+            run_begin[id] = left_smaller ? r + 1 : first;
+            run_end[id] = left_smaller ? last : r;
+            if (r - first > 0 && duration[r] - duration[first] < delta)
+                peel_run(first, r);
+            if (last - r - 1 > 0 && duration[last] - duration[r + 1] < delta)
+                peel_run(r + 1, last);
+        };
+
+        for (std::size_t id = 0; id < run_begin.size(); ++id) {
+            if (duration[run_end[id]] - duration[run_begin[id]] < delta)
+                peel_run(run_begin[id], run_end[id]);
+        }
+        for (std::size_t p = 0; p < num_pieces; ++p) {
+            if (!peeled[p] && degree[p] < k)
+                peel(p);
+        }
+        while (!worklist.empty()) {
+            auto p = worklist.back();
+            worklist.pop_back();
+            for (auto a = adjacency_offsets[p]; a < adjacency_offsets[p + 1]; ++a) {
+                auto q = adjacency[a];
+                if (!peeled[q] && --degree[q] < k)
+                    peel(q);
+            }
+        }
+
+        for (std::size_t v = 0; v < n; ++v) {
+            for (auto r = vertex_offsets[v]; r < vertex_offsets[v + 1]; ++r) {
+                auto p = order[r];
+                if (peeled[p])
+                    continue;
+                auto lower = times[piece_segment[p]], upper = times[piece_segment[p] + 1];
+                while (r + 1 < vertex_offsets[v + 1] && !peeled[order[r + 1]] &&
+                       piece_segment[order[r + 1]] == piece_segment[order[r]] + 1)
+                    upper = times[piece_segment[order[++r]] + 1];
+                alive[v].append(lower, upper);
+            }
+        }
+        return alive;
+    }
+
+    /**
+     * @brief Sub link stream induced by the (k, delta)-core.
+     * @param g link stream
+     * @param k minimum instantaneous degree
+     * @param delta minimum duration of a presence period
+     * @param res link stream receiving the core, the vertices keep their label
+     */
+    template<typename DirectedS>
+    void temporal_k_core(LinkStreamBase<DirectedS> &g, std::size_t k, time_t delta, LinkStreamBase<DirectedS> &res)
+    {
+        auto alive = temporal_core_intervals(g, k, delta);
+        time_t t_begin, t_end;
+        std::tie(t_begin, t_end) = g.definition();
+        res.set_definition(t_begin, t_end);
+
+        for (auto v = g.vertices().first; v != g.vertices().second; ++v) {
+            if (!alive[*v].empty() && !res.has_vertex(g.label(*v)))
+                res.add_vertex(g.label(*v));
+        }
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto e = g.edge_endpoint(*it);
+            if (e.first == e.second)
+                continue;
+            auto tis = g.edge_tinterval_set(*it);
+            auto active = FlatTimeIntervalSet(tis).intersection(alive[e.first]).intersection(alive[e.second]);
+            if (active.empty())
+                continue;
+            auto restricted = active.to_time_interval_set();
+            res.add_edge_w_time(g.label(e.first), g.label(e.second), restricted);
+        }
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_CORE_HPP
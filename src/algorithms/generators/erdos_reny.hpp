@@ -13,28 +13,123 @@
 #ifndef BSTREAM_ERDOS_RENY_HPP
 #define BSTREAM_ERDOS_RENY_HPP
 
-#include <boost/graph/erdos_renyi_generator.hpp>
-#include <boost/random/linear_congruential.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <ctime>
+#include <utility>
+#include <vector>
 
 #include "GraphType.hpp"
+#include "parallel.hpp"
+#include "random.hpp"
 
 namespace boost::bstream
 {
+    typedef std::vector<std::pair<std::size_t, std::size_t>> edge_list;
+
+    namespace detail
+    {
+        /**
+         * @brief Draw the pairs of [0, num_pairs) kept independently with probability p.
+         *
+         * The pair space is cut in blocks whose size only depends on num_pairs and p, every block
+         * owns the random stream (seed, block) and jumps from one kept pair to the next with
+         * geometric skips (Batagelj and Brandes), so that the cost is linear in the number of kept
+         * pairs and the result does not depend on the number of threads.
+         *
+         * @return the kept pair indices, in increasing order
+         */
+        inline std::vector<std::uint64_t> geometric_pairs(std::uint64_t num_pairs, double p, std::uint64_t seed)
+        {
+            if (num_pairs == 0 || p <= 0.0)
+                return {};
+            ///< about 4096 kept pairs per block
+            auto block = static_cast<std::uint64_t>(std::max(65536.0, std::min(4096.0 / p, 1e15)));
+            auto num_blocks = (num_pairs + block - 1) / block;
+
+            std::vector<std::vector<std::uint64_t>> kept(num_blocks);
+            parallel_for(0, num_blocks, [&](std::size_t b) {
+                counter_rng rng(seed, b);
+                auto first = b * block, last = std::min(num_pairs, first + block);
+                for (auto k = first;; ++k) {
+                    auto skip = rng.geometric_skip(p);
+                    if (skip >= last - k)
+                        break;
+                    k += skip;
+                    kept[b].push_back(k);
+                }
+            }, 1);
+
+            std::vector<std::uint64_t> pairs;
+            std::size_t total = 0;
+            for (auto &k : kept)
+                total += k.size();
+            pairs.reserve(total);
+            for (auto &k : kept) {
+                pairs.insert(pairs.end(), k.begin(), k.end());
+                std::vector<std::uint64_t>().swap(k);
+            }
+            return pairs;
+        }
+
+        /**
+         * @brief The k-th pair (v, w) with w < v in the row-major order of the strict lower triangle.
+         */
+        inline std::pair<std::size_t, std::size_t> triangle_pair(std::uint64_t k)
+        {
+            auto v = static_cast<std::uint64_t>((1.0 + std::sqrt(1.0 + 8.0 * static_cast<double>(k))) / 2.0);
+            while (v * (v - 1) / 2 > k)
+                --v;
+            while ((v + 1) * v / 2 <= k)
+                ++v;
+            return std::make_pair(static_cast<std::size_t>(k - v * (v - 1) / 2), static_cast<std::size_t>(v));
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Edges of a G(n, p) random graph, drawn with geometric skips in O(n + m).
+     * @param n number of vertices
+     * @param p probability of every edge
+     * @param seed seed of the random streams
+     * @return the edges (s, t), with s < t for undirected graphs
+     */
+    inline edge_list erdos_renyi_edges(std::size_t n, double p, std::uint64_t seed, bool directed = false)
+    {
+        std::uint64_t num_pairs = directed ? std::uint64_t(n) * (n - (n > 0)) : std::uint64_t(n) * (n - (n > 0)) / 2;
+        auto pairs = detail::geometric_pairs(num_pairs, p, seed);
+        edge_list edges(pairs.size());
+        parallel_for(0, pairs.size(), [&](std::size_t i) {
+            auto k = pairs[i];
+            if (directed) {
+                auto s = static_cast<std::size_t>(k / (n - 1)), t = static_cast<std::size_t>(k % (n - 1));
+                edges[i] = std::make_pair(s, t >= s ? t + 1 : t);
+            } else {
+                edges[i] = detail::triangle_pair(k);
+            }
+        }, 4096);
+        return edges;
+    }
+
+    /**
+     * @brief G(n, p) random graph in O(n + m).
+     *
+     * The pairs of vertices are drawn in parallel with geometric skips by erdos_renyi_edges and the
+     * adjacency of graph is built directly from the edge list. The result only depends on the seed,
+     * not on the number of threads.
+     *
+     * @param n number of vertices
+     * @param p probability of every edge
+     * @param graph graph receiving the G(n, p), its previous content is discarded
+     * @param seed seed of the random streams, 0 to seed from the clock
+     * @param labels if false the vertices are not labeled, which saves the label map on large graphs
+     */
     template <typename DirectedS>
-    void erdos_renyi_graph(int n, float p, GraphBase<DirectedS>& graph, int seed=0)
+    void erdos_renyi_graph(int n, float p, GraphBase<DirectedS>& graph, int seed=0, bool labels=true)
     {
-        typedef boost::minstd_rand RNG;
-        RNG rng;
-        if(seed != 0)
-            rng.seed(seed);
-        else
-            rng.seed(time(0));
-
-        typedef typename GraphBase<DirectedS>::Adjacency Adjacency;
-        typedef boost::erdos_renyi_iterator<boost::minstd_rand, Adjacency> ERGen;
-        Adjacency g(ERGen(rng, n, p), ERGen(), n);
-        graph.copy_adjacency(g);
+        std::uint64_t s = seed != 0 ? static_cast<std::uint64_t>(seed) : static_cast<std::uint64_t>(time(0));
+        auto edges = erdos_renyi_edges(static_cast<std::size_t>(n), p, s, graph.is_directed());
+        graph.assign_edges(static_cast<std::size_t>(n), edges, labels);
     }
 } //end namespace boost::bstream
 
@@ -0,0 +1,402 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       link_stream_generators.hpp
+/// @brief      Synthetic link streams: contact processes on random backbones and activity-driven models
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_LINK_STREAM_GENERATORS_HPP
+#define BSTREAM_LINK_STREAM_GENERATORS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "erdos_reny.hpp"
+#include "parallel.hpp"
+#include "random.hpp"
+
+namespace boost::bstream
+{
+    enum class duration_law
+    {
+        constant, exponential, power_law
+    };
+
+    /**
+     * @brief Parameters of the contacts generated on every edge of a backbone.
+     *
+     * The contacts of an edge start at the arrival times of a Poisson process of the given rate.
+     * Their duration is `duration` for the constant law, exponential of mean `duration`, or
+     * Pareto of minimum `duration` and the given exponent (> 1). Durations are rounded to at least
+     * one time unit and the contacts are clipped to the definition interval of the link stream.
+     */
+    struct contact_process
+    {
+        double rate = 0.01;
+        duration_law law = duration_law::exponential;
+        double duration = 1.0;
+        double exponent = 2.5;
+    };
+
+    namespace detail
+    {
+        inline time_t draw_duration(counter_rng &rng, const contact_process &process)
+        {
+            double d = process.duration;
+            if (process.law == duration_law::exponential)
+                d = rng.exponential(1.0 / process.duration);
+            else if (process.law == duration_law::power_law)
+                d = process.duration * std::pow(1.0 - rng.uniform(), -1.0 / (process.exponent - 1.0));
+            return std::max<time_t>(1, static_cast<time_t>(std::llround(std::min(d, 1e15))));
+        }
+
+        /**
+         * @brief Generate the contacts of num_units independent units of work and bulk insert them.
+         *
+         * generate(unit, rng, contacts) appends the contacts of a unit using the random stream
+         * (seed, unit). The units are generated in parallel by batches, each batch being inserted
+         * with add_edges_w_time before the next one is generated so that the memory used by the
+         * contacts in flight stays bounded.
+         */
+        template<typename Stream, typename Generate>
+        void generate_contacts(Stream &g, std::size_t num_units, std::uint64_t seed, Generate generate)
+        {
+            const std::size_t batch = 1 << 16;
+            std::vector<std::vector<typename Stream::contact_t>> buffers(std::min(batch, num_units));
+            std::vector<typename Stream::contact_t> contacts;
+            for (std::size_t first = 0; first < num_units; first += batch) {
+                auto last = std::min(num_units, first + batch);
+                parallel_for(first, last, [&](std::size_t unit) {
+                    counter_rng rng(seed, unit);
+                    buffers[unit - first].clear();
+                    generate(unit, rng, buffers[unit - first]);
+                });
+                contacts.clear();
+                for (std::size_t unit = first; unit < last; ++unit)
+                    contacts.insert(contacts.end(), buffers[unit - first].begin(), buffers[unit - first].end());
+                g.add_edges_w_time(contacts);
+            }
+        }
+
+        /**
+         * @brief Contacts of the edge (s, t) following a contact process over [tb, te).
+         */
+        template<typename Contact>
+        void poisson_contacts(std::size_t s, std::size_t t, time_t tb, time_t te, const contact_process &process,
+                              counter_rng &rng, std::vector<Contact> &contacts)
+        {
+            double now = static_cast<double>(tb);
+            while (true) {
+                now += rng.exponential(process.rate);
+                if (now >= static_cast<double>(te))
+                    break;
+                auto b = static_cast<time_t>(now);
+                auto e = std::min(te, b + draw_duration(rng, process));
+                contacts.emplace_back(s, t, b, e);
+            }
+        }
+
+        /**
+         * @brief Call f(step) for the steps of [0, num_steps) at which a vertex of activity a is
+         * active, jumping from one activation to the next with geometric skips.
+         */
+        template<typename Function>
+        void activation_steps(counter_rng &rng, double a, std::uint64_t num_steps, Function f)
+        {
+            for (std::uint64_t step = 0; step < num_steps; ++step) {
+                auto skip = rng.geometric_skip(a);
+                if (skip >= num_steps - step)
+                    break;
+                step += skip;
+                f(step);
+            }
+        }
+
+        inline void check_process(const contact_process &process)
+        {
+            if (process.rate <= 0.0 || process.duration <= 0.0)
+                throw GraphBaseException("the contact rate and duration must be positive");
+            if (process.law == duration_law::power_law && process.exponent <= 1.0)
+                throw GraphBaseException("the exponent of the power law must be greater than 1");
+        }
+
+        template<typename Stream>
+        void add_vertices(Stream &g, std::size_t n)
+        {
+            if (g.num_vertices() != 0)
+                throw GraphBaseException("the link stream must be empty");
+            for (std::size_t v = 0; v < n; ++v)
+                g.add_vertex();
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Edges of a Barabasi-Albert preferential attachment graph.
+     *
+     * Linear-time algorithm of Batagelj and Brandes: every new vertex draws m end points uniformly
+     * in the list of all the end points drawn so far, which selects the existing vertices in
+     * proportion to their degree. Self loops and multiple edges are dropped. This generator is
+     * sequential by nature.
+     *
+     * @param n number of vertices
+     * @param m number of edges of every new vertex
+     * @param seed seed of the random stream
+     * @return the edges (s, t) with s < t
+     */
+    inline edge_list barabasi_albert_edges(std::size_t n, std::size_t m, std::uint64_t seed)
+    {
+        counter_rng rng(seed, 0);
+        std::vector<std::size_t> endpoints(2 * n * m);
+        for (std::size_t v = 0; v < n; ++v) {
+            for (std::size_t i = 0; i < m; ++i) {
+                auto k = 2 * (v * m + i);
+                endpoints[k] = v;
+                endpoints[k + 1] = endpoints[rng.below(k + 1)];
+            }
+        }
+        edge_list edges;
+        edges.reserve(n * m);
+        for (std::size_t k = 0; k < endpoints.size(); k += 2) {
+            if (endpoints[k] != endpoints[k + 1])
+                edges.emplace_back(std::min(endpoints[k], endpoints[k + 1]), std::max(endpoints[k], endpoints[k + 1]));
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        return edges;
+    }
+
+    /**
+     * @brief Edges of an undirected stochastic block model.
+     *
+     * The vertices of the block a are numbered consecutively, a pair of vertices of the blocks a
+     * and b is an edge with probability probs[a][b]. Every pair of blocks is drawn with geometric
+     * skips on its own random streams.
+     *
+     * @param sizes number of vertices of each block
+     * @param probs symmetric matrix of the edge probabilities between blocks
+     * @param seed seed of the random streams
+     * @return the edges (s, t) with s < t
+     */
+    inline edge_list stochastic_block_model_edges(const std::vector<std::size_t> &sizes,
+                                                  const std::vector<std::vector<double>> &probs, std::uint64_t seed)
+    {
+        if (probs.size() != sizes.size())
+            throw GraphBaseException("the probability matrix must have one row per block");
+        std::vector<std::size_t> offset(sizes.size() + 1, 0);
+        for (std::size_t a = 0; a < sizes.size(); ++a)
+            offset[a + 1] = offset[a] + sizes[a];
+
+        edge_list edges;
+        counter_rng keys(seed, 0);
+        for (std::size_t a = 0; a < sizes.size(); ++a) {
+            if (probs[a].size() != sizes.size())
+                throw GraphBaseException("the probability matrix must have one column per block");
+            for (std::size_t b = a; b < sizes.size(); ++b) {
+                auto key = keys();
+                if (a == b) {
+                    std::uint64_t num_pairs = std::uint64_t(sizes[a]) * (sizes[a] - (sizes[a] > 0)) / 2;
+                    for (auto k : detail::geometric_pairs(num_pairs, probs[a][a], key)) {
+                        auto e = detail::triangle_pair(k);
+                        edges.emplace_back(offset[a] + e.first, offset[a] + e.second);
+                    }
+                } else {
+                    std::uint64_t num_pairs = std::uint64_t(sizes[a]) * sizes[b];
+                    for (auto k : detail::geometric_pairs(num_pairs, probs[a][b], key))
+                        edges.emplace_back(offset[a] + k / sizes[b], offset[b] + k % sizes[b]);
+                }
+            }
+        }
+        return edges;
+    }
+
+    /**
+     * @brief Power-law activity potentials F(a) ~ a^-gamma on [epsilon, 1].
+     * @return the activity of each vertex
+     */
+    inline std::vector<double> power_law_activities(std::size_t n, double gamma, double epsilon, std::uint64_t seed)
+    {
+        if (epsilon <= 0.0 || epsilon > 1.0 || gamma == 1.0)
+            throw GraphBaseException("the activities need 0 < epsilon <= 1 and gamma != 1");
+        std::vector<double> activity(n);
+        auto lo = std::pow(epsilon, 1.0 - gamma), hi = 1.0;
+        parallel_for(0, n, [&](std::size_t v) {
+            counter_rng rng(seed, v);
+            activity[v] = std::pow(lo + (hi - lo) * rng.uniform(), 1.0 / (1.0 - gamma));
+        }, 4096);
+        return activity;
+    }
+
+    /**
+     * @brief Link stream of contacts following a contact process on the edges of a backbone.
+     *
+     * The n vertices are added to g, which must be empty, and the contacts of every edge of the
+     * backbone are drawn over the definition interval of g on the random stream (seed, edge rank).
+     * The edges are generated in parallel and inserted through the bulk-load path.
+     *
+     * @param n number of vertices
+     * @param backbone edges carrying the contacts
+     * @param process contact_process
+     * @param g empty link stream with its definition interval set
+     * @param seed seed of the random streams
+     */
+    inline void contact_process_link_stream(std::size_t n, const edge_list &backbone, const contact_process &process,
+                                            LinkStream &g, std::uint64_t seed)
+    {
+        detail::check_process(process);
+        for (auto &e : backbone) {
+            if (e.first >= n || e.second >= n)
+                throw GraphBaseException("the backbone has an edge outside of the n vertices");
+        }
+        detail::add_vertices(g, n);
+        time_t tb, te;
+        std::tie(tb, te) = g.definition();
+        detail::generate_contacts(g, backbone.size(), seed, [&](std::size_t k, counter_rng &rng, auto &contacts) {
+            detail::poisson_contacts(backbone[k].first, backbone[k].second, tb, te, process, rng, contacts);
+        });
+    }
+
+    /**
+     * @brief Activity-driven link stream (Perra et al.).
+     *
+     * Time is divided in steps of length dt starting at the beginning of the definition interval of
+     * g. At every step a vertex v is active with probability activity[v] (clamped to 1) and then
+     * creates m contacts of duration dt with distinct vertices drawn uniformly. The activation steps
+     * of a vertex are found with geometric skips, the vertices are generated in parallel.
+     *
+     * @param activity activation probability of each vertex per step
+     * @param m number of contacts of an active vertex
+     * @param dt length of a step
+     * @param g empty link stream with its definition interval set
+     * @param seed seed of the random streams
+     */
+    inline void activity_driven_link_stream(const std::vector<double> &activity, std::size_t m, time_t dt,
+                                            LinkStream &g, std::uint64_t seed)
+    {
+        auto n = activity.size();
+        if (dt <= 0)
+            throw GraphBaseException("the time step must be positive");
+        if (n > 0 && m >= n)
+            throw GraphBaseException("m must be lower than the number of vertices");
+        detail::add_vertices(g, n);
+        time_t tb, te;
+        std::tie(tb, te) = g.definition();
+        auto num_steps = static_cast<std::uint64_t>((te - tb) / dt);
+
+        detail::generate_contacts(g, n, seed, [&](std::size_t v, counter_rng &rng, auto &contacts) {
+            auto a = std::min(activity[v], 1.0);
+            if (a <= 0.0)
+                return;
+            std::vector<std::size_t> targets;
+            detail::activation_steps(rng, a, num_steps, [&](std::uint64_t step) {
+                targets.clear();
+                while (targets.size() < m) {
+                    auto t = static_cast<std::size_t>(rng.below(n - 1));
+                    t = t >= v ? t + 1 : t;
+                    if (std::find(targets.begin(), targets.end(), t) == targets.end())
+                        targets.push_back(t);
+                }
+                auto b = tb + static_cast<time_t>(step) * dt;
+                for (auto t : targets)
+                    contacts.emplace_back(v, t, b, b + dt);
+            });
+        });
+    }
+
+    /**
+     * @brief Bipartite link stream of contacts following a contact process on a random bipartite
+     * backbone, every top-bottom pair being an edge of the backbone with probability p.
+     *
+     * The top vertices are added first, then the bottom vertices. The backbone is drawn with
+     * geometric skips and the contacts of its edges as in contact_process_link_stream.
+     *
+     * @param num_top number of top vertices
+     * @param num_bottom number of bottom vertices
+     * @param p probability of a backbone edge
+     * @param process contact_process
+     * @param g empty bipartite link stream with its definition interval set
+     * @param seed seed of the random streams
+     */
+    inline void contact_process_bipartite_link_stream(std::size_t num_top, std::size_t num_bottom, double p,
+                                                      const contact_process &process, BiLinkStream &g,
+                                                      std::uint64_t seed)
+    {
+        detail::check_process(process);
+        if (g.num_vertices() != 0)
+            throw GraphBaseException("the link stream must be empty");
+        for (std::size_t v = 0; v < num_top; ++v)
+            g.add_vertex_w_group(vertex_group::top);
+        for (std::size_t v = 0; v < num_bottom; ++v)
+            g.add_vertex_w_group(vertex_group::bottom);
+        time_t tb, te;
+        std::tie(tb, te) = g.definition();
+
+        counter_rng keys(seed, 0);
+        auto pairs = detail::geometric_pairs(std::uint64_t(num_top) * num_bottom, p, keys());
+        detail::generate_contacts(g, pairs.size(), keys(), [&](std::size_t k, counter_rng &rng, auto &contacts) {
+            auto s = static_cast<std::size_t>(pairs[k] / num_bottom);
+            auto t = num_top + static_cast<std::size_t>(pairs[k] % num_bottom);
+            detail::poisson_contacts(s, t, tb, te, process, rng, contacts);
+        });
+    }
+
+    /**
+     * @brief Bipartite activity-driven link stream: at every step of length dt an active top
+     * vertex v (probability activity[v]) creates m contacts of duration dt with distinct bottom
+     * vertices drawn uniformly, as users connecting to antennas.
+     *
+     * @param activity activation probability of each top vertex per step
+     * @param num_bottom number of bottom vertices
+     * @param m number of contacts of an active vertex
+     * @param dt length of a step
+     * @param g empty bipartite link stream with its definition interval set
+     * @param seed seed of the random streams
+     */
+    inline void activity_driven_bipartite_link_stream(const std::vector<double> &activity, std::size_t num_bottom,
+                                                      std::size_t m, time_t dt, BiLinkStream &g, std::uint64_t seed)
+    {
+        auto num_top = activity.size();
+        if (dt <= 0)
+            throw GraphBaseException("the time step must be positive");
+        if (m > num_bottom)
+            throw GraphBaseException("m must be at most the number of bottom vertices");
+        if (g.num_vertices() != 0)
+            throw GraphBaseException("the link stream must be empty");
+        for (std::size_t v = 0; v < num_top; ++v)
+            g.add_vertex_w_group(vertex_group::top);
+        for (std::size_t v = 0; v < num_bottom; ++v)
+            g.add_vertex_w_group(vertex_group::bottom);
+        time_t tb, te;
+        std::tie(tb, te) = g.definition();
+        auto num_steps = static_cast<std::uint64_t>((te - tb) / dt);
+
+        detail::generate_contacts(g, num_top, seed, [&](std::size_t v, counter_rng &rng, auto &contacts) {
+            auto a = std::min(activity[v], 1.0);
+            if (a <= 0.0 || m == 0)
+                return;
+            std::vector<std::size_t> targets;
+            detail::activation_steps(rng, a, num_steps, [&](std::uint64_t step) {
+                targets.clear();
+                while (targets.size() < m) {
+                    auto t = num_top + static_cast<std::size_t>(rng.below(num_bottom));
+                    if (std::find(targets.begin(), targets.end(), t) == targets.end())
+                        targets.push_back(t);
+                }
+                auto b = tb + static_cast<time_t>(step) * dt;
+                for (auto t : targets)
+                    contacts.emplace_back(v, t, b, b + dt);
+            });
+        });
+    }
+} //end namespace boost::bstream
+
+#endif //BSTREAM_LINK_STREAM_GENERATORS_HPP
@@ -0,0 +1,273 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       bipartite_metrics.hpp
+/// @brief      Degree, redundancy and co-presence metrics of bipartite link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_BIPARTITE_METRICS_HPP
+#define BSTREAM_BIPARTITE_METRICS_HPP
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "FlatTimeIntervalSet.hpp"
+#include "CSR.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    namespace detail
+    {
+        /**
+         * @brief Adjacency of a bipartite link stream with the time intervals of every edge stored
+         * as sorted arrays, indexed by CSRGraph::edge_ids.
+         */
+        struct bipartite_stream
+        {
+            CSRGraph csr;
+            std::vector<FlatTimeIntervalSet> presence;
+            time_t tb, te;
+
+            explicit bipartite_stream(BiLinkStream &g) : csr(make_csr(g))
+            {
+                std::tie(tb, te) = g.definition();
+                presence.reserve(csr.num_edges);
+                for (auto it = g.edges().first; it != g.edges().second; ++it) {
+                    auto tis = g.edge_tinterval_set(*it);
+                    presence.emplace_back(tis);
+                }
+            }
+
+            const FlatTimeIntervalSet &interval(std::size_t i) const
+            {
+                return presence[csr.edge_ids[i]];
+            }
+        };
+
+        /**
+         * @brief Duration spent by v at each instantaneous degree, events is a scratch buffer.
+         */
+        inline void degree_durations(const bipartite_stream &s, std::size_t v,
+                                     std::vector<std::pair<time_t, int>> &events, std::vector<double> &durations)
+        {
+            events.clear();
+            for (auto i = s.csr.offsets[v]; i < s.csr.offsets[v + 1]; ++i) {
+                const auto &tis = s.interval(i);
+                for (std::size_t k = 0; k < tis.size(); ++k) {
+                    events.emplace_back(tis.lower(k), 1);
+                    events.emplace_back(tis.upper(k), -1);
+                }
+            }
+            std::sort(events.begin(), events.end());
+
+            std::size_t degree = 0;
+            time_t last = s.tb;
+            for (auto &e : events) {
+                if (durations.size() <= degree)
+                    durations.resize(degree + 1, 0.0);
+                durations[degree] += static_cast<double>(e.first - last);
+                last = e.first;
+                degree += e.second;
+            }
+            if (durations.size() <= degree)
+                durations.resize(degree + 1, 0.0);
+            durations[degree] += static_cast<double>(s.te - last);
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Time-averaged degree of the vertices of a group.
+     * @param g bipartite link stream
+     * @param group vertex_group::top or vertex_group::bottom
+     * @return the total duration of the edges of each vertex divided by the length of the
+     * definition interval, indexed by group id, zeros if the definition interval is empty
+     */
+    inline std::vector<double> time_averaged_degree(BiLinkStream &g, vertex_group group)
+    {
+        const auto &members = g.group_vertices(group);
+        detail::bipartite_stream s(g);
+        std::vector<double> degree(members.size(), 0.0);
+        if (s.te <= s.tb)
+            return degree;
+        auto length = static_cast<double>(s.te - s.tb);
+        parallel_for(0, members.size(), [&](std::size_t id) {
+            auto v = members[id];
+            for (auto i = s.csr.offsets[v]; i < s.csr.offsets[v + 1]; ++i)
+                degree[id] += static_cast<double>(s.interval(i).length());
+            degree[id] /= length;
+        });
+        return degree;
+    }
+
+    /**
+     * @brief Time-averaged degree distribution of a group.
+     *
+     * The instantaneous degree of every vertex is obtained by sweeping the sorted bounds of the
+     * intervals of its edges. The vertices are swept in parallel, each thread accumulating its own
+     * histogram of durations.
+     *
+     * @param g bipartite link stream
+     * @param group vertex_group::top or vertex_group::bottom
+     * @return p[k], the fraction of the time a vertex of the group has degree k, averaged over the
+     * vertices of the group
+     */
+    inline std::vector<double> degree_distribution(BiLinkStream &g, vertex_group group)
+    {
+        const auto &members = g.group_vertices(group);
+        detail::bipartite_stream s(g);
+        if (members.empty() || s.te <= s.tb)
+            return {};
+
+        struct workspace
+        {
+            std::vector<std::pair<time_t, int>> events;
+            std::vector<double> durations;
+        };
+        std::vector<workspace> work(num_threads());
+        parallel_for_threads(0, members.size(), [&](std::size_t id, unsigned tid) {
+            detail::degree_durations(s, members[id], work[tid].events, work[tid].durations);
+        });
+
+        std::vector<double> p;
+        for (auto &w : work) {
+            if (p.size() < w.durations.size())
+                p.resize(w.durations.size(), 0.0);
+            for (std::size_t k = 0; k < w.durations.size(); ++k)
+                p[k] += w.durations[k];
+        }
+        auto total = static_cast<double>(members.size()) * static_cast<double>(s.te - s.tb);
+        for (auto &x : p)
+            x /= total;
+        return p;
+    }
+
+    /**
+     * @brief Temporal redundancy of the vertices of a group (Latapy et al. for bipartite graphs).
+     *
+     * A pair of neighbors w1, w2 of u is a pair of u while u is linked to both of them, and it is
+     * redundant while another vertex v of the group is also linked to both w1 and w2. The
+     * redundancy of u is the total duration of its redundant pairs divided by the total duration of
+     * its pairs, 0 if u never has two neighbors at the same time. The vertices are processed in
+     * parallel, the cost of u is the sum over its pairs of neighbors of the degree of w2.
+     *
+     * @param g bipartite link stream
+     * @param group vertex_group::top or vertex_group::bottom
+     * @return the redundancy of each vertex, indexed by group id
+     */
+    inline std::vector<double> temporal_redundancy(BiLinkStream &g, vertex_group group)
+    {
+        const auto &members = g.group_vertices(group);
+        detail::bipartite_stream s(g);
+        auto n = s.csr.num_vertices;
+        std::vector<double> redundancy(members.size(), 0.0);
+
+        std::vector<std::vector<std::size_t>> slots(num_threads());
+        parallel_for_threads(0, members.size(), [&](std::size_t id, unsigned tid) {
+            auto &slot = slots[tid];
+            if (slot.empty())
+                slot.assign(n, s.csr.targets.size());
+            auto u = members[id];
+            double redundant = 0.0, total = 0.0;
+
+            for (auto i = s.csr.offsets[u]; i < s.csr.offsets[u + 1]; ++i) {
+                auto w1 = s.csr.targets[i];
+                ///< slot[v] is the position of the edge (w1, v) in the CSR
+                for (auto k = s.csr.offsets[w1]; k < s.csr.offsets[w1 + 1]; ++k)
+                    if (s.csr.targets[k] != u)
+                        slot[s.csr.targets[k]] = k;
+
+                for (auto j = i + 1; j < s.csr.offsets[u + 1]; ++j) {
+                    auto w2 = s.csr.targets[j];
+                    auto pair = s.interval(i).intersection(s.interval(j));
+                    if (pair.empty())
+                        continue;
+                    FlatTimeIntervalSet covered;
+                    for (auto k = s.csr.offsets[w2]; k < s.csr.offsets[w2 + 1]; ++k) {
+                        auto v = s.csr.targets[k];
+                        if (slot[v] == s.csr.targets.size())
+                            continue;
+                        covered = covered.set_union(s.interval(slot[v]).intersection(s.interval(k)));
+                    }
+                    total += static_cast<double>(pair.length());
+                    redundant += static_cast<double>(pair.intersection(covered).length());
+                }
+
+                for (auto k = s.csr.offsets[w1]; k < s.csr.offsets[w1 + 1]; ++k)
+                    slot[s.csr.targets[k]] = s.csr.targets.size();
+            }
+            redundancy[id] = total > 0 ? redundant / total : 0.0;
+        }, 16);
+        return redundancy;
+    }
+
+    /**
+     * @brief Fraction of the time the vertices of a group share a neighbor with another vertex of
+     * the group.
+     *
+     * For every vertex w of the other group the times at which w has at least two neighbors are
+     * computed once by a sweep over the sorted bounds of its intervals. A vertex u shares a neighbor
+     * while it is linked to some w at one of these times.
+     *
+     * @param g bipartite link stream
+     * @param group vertex_group::top or vertex_group::bottom
+     * @return the shared time of each vertex divided by the time during which it has at least one
+     * neighbor (0 if it never has one), indexed by group id
+     */
+    inline std::vector<double> shared_neighbor_time_fraction(BiLinkStream &g, vertex_group group)
+    {
+        const auto &members = g.group_vertices(group);
+        detail::bipartite_stream s(g);
+        auto n = s.csr.num_vertices;
+
+        ///< crowded[w]: times at which w has at least two neighbors
+        std::vector<FlatTimeIntervalSet> crowded(n, FlatTimeIntervalSet(s.tb, s.te));
+        std::vector<std::vector<std::pair<time_t, int>>> events(num_threads());
+        parallel_for_threads(0, n, [&](std::size_t w, unsigned tid) {
+            if (g.group(w) == group || s.csr.degree(w) < 2)
+                return;
+            auto &e = events[tid];
+            e.clear();
+            for (auto i = s.csr.offsets[w]; i < s.csr.offsets[w + 1]; ++i) {
+                const auto &tis = s.interval(i);
+                for (std::size_t k = 0; k < tis.size(); ++k) {
+                    e.emplace_back(tis.lower(k), 1);
+                    e.emplace_back(tis.upper(k), -1);
+                }
+            }
+            std::sort(e.begin(), e.end());
+            int count = 0;
+            time_t start = s.tb;
+            for (auto &x : e) {
+                if (count < 2 && count + x.second >= 2)
+                    start = x.first;
+                else if (count >= 2 && count + x.second < 2 && start < x.first)
+                    crowded[w].append(start, x.first);
+                count += x.second;
+            }
+        }, 64);
+
+        std::vector<double> fraction(members.size(), 0.0);
+        parallel_for(0, members.size(), [&](std::size_t id) {
+            auto u = members[id];
+            FlatTimeIntervalSet present, shared;
+            for (auto i = s.csr.offsets[u]; i < s.csr.offsets[u + 1]; ++i) {
+                present = present.set_union(s.interval(i));
+                shared = shared.set_union(s.interval(i).intersection(crowded[s.csr.targets[i]]));
+            }
+            if (!present.empty())
+                fraction[id] = static_cast<double>(shared.length()) / static_cast<double>(present.length());
+        });
+        return fraction;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_BIPARTITE_METRICS_HPP
@@ -0,0 +1,197 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       operators.hpp
+/// @brief      Set operations between link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_OPERATORS_HPP
+#define BSTREAM_OPERATORS_HPP
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "FlatTimeIntervalSet.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    namespace detail
+    {
+        enum class stream_operation
+        {
+            union_op, intersection_op, difference_op, symmetric_difference_op
+        };
+
+        typedef std::pair<std::string, std::string> edge_key;
+
+        /**
+         * @brief Edges of a link stream keyed by the labels of their end points and sorted by key.
+         *
+         * Undirected edges are keyed by (min label, max label) so that both streams agree on the key
+         * whatever the orientation used when the edge was added.
+         */
+        template<typename DirectedS>
+        std::vector<std::pair<edge_key, FlatTimeIntervalSet>>
+        sorted_edge_list(LinkStreamBase<DirectedS> &g)
+        {
+            std::vector<std::pair<edge_key, FlatTimeIntervalSet>> edges;
+            for (auto it = g.edges().first; it != g.edges().second; ++it) {
+                auto endpoints = g.edge_endpoint(*it);
+                auto s = g.label(endpoints.first);
+                auto t = g.label(endpoints.second);
+                if (!g.is_directed() && t < s)
+                    std::swap(s, t);
+                auto tis = g.edge_tinterval_set(*it);
+                edges.emplace_back(std::make_pair(s, t), FlatTimeIntervalSet(tis));
+            }
+            std::sort(edges.begin(), edges.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+            return edges;
+        }
+
+        inline FlatTimeIntervalSet
+        combine(stream_operation op, const FlatTimeIntervalSet *a, const FlatTimeIntervalSet *b)
+        {
+            switch (op) {
+                case stream_operation::union_op:
+                    if (a && b)
+                        return a->set_union(*b);
+                    return a ? *a : *b;
+                case stream_operation::intersection_op:
+                    if (a && b)
+                        return a->intersection(*b);
+                    return FlatTimeIntervalSet();
+                case stream_operation::difference_op:
+                    if (a && b)
+                        return a->difference(*b);
+                    return a ? *a : FlatTimeIntervalSet();
+                case stream_operation::symmetric_difference_op:
+                    if (a && b)
+                        return a->difference(*b).set_union(b->difference(*a));
+                    return a ? *a : *b;
+            }
+            return FlatTimeIntervalSet();
+        }
+
+        template<typename DirectedS>
+        void stream_operation_apply(stream_operation op,
+                                    LinkStreamBase<DirectedS> &a,
+                                    LinkStreamBase<DirectedS> &b,
+                                    LinkStreamBase<DirectedS> &res)
+        {
+            ///< definition interval of the result
+            time_t a_lower, a_upper, b_lower, b_upper;
+            std::tie(a_lower, a_upper) = a.definition();
+            std::tie(b_lower, b_upper) = b.definition();
+            if (op == stream_operation::union_op || op == stream_operation::symmetric_difference_op)
+                res.set_definition(std::min(a_lower, b_lower), std::max(a_upper, b_upper));
+            else if (op == stream_operation::intersection_op && std::max(a_lower, b_lower) < std::min(a_upper, b_upper))
+                res.set_definition(std::max(a_lower, b_lower), std::min(a_upper, b_upper));
+            else
+                res.set_definition(a_lower, a_upper);
+
+            ///< vertices of the result
+            for (auto &label : a.labels()) {
+                if (op != stream_operation::intersection_op || b.has_vertex(label))
+                    if (!res.has_vertex(label))
+                        res.add_vertex(label);
+            }
+            if (op == stream_operation::union_op || op == stream_operation::symmetric_difference_op) {
+                for (auto &label : b.labels())
+                    if (!res.has_vertex(label))
+                        res.add_vertex(label);
+            }
+
+            ///< sorted merge join on the edge keys
+            auto edges_a = sorted_edge_list(a);
+            auto edges_b = sorted_edge_list(b);
+            std::vector<std::tuple<const edge_key *, const FlatTimeIntervalSet *, const FlatTimeIntervalSet *>> joined;
+            joined.reserve(edges_a.size() + edges_b.size());
+            std::size_t i = 0, j = 0;
+            while (i < edges_a.size() || j < edges_b.size()) {
+                if (j == edges_b.size() || (i < edges_a.size() && edges_a[i].first < edges_b[j].first)) {
+                    joined.emplace_back(&edges_a[i].first, &edges_a[i].second, nullptr);
+                    ++i;
+                } else if (i == edges_a.size() || edges_b[j].first < edges_a[i].first) {
+                    joined.emplace_back(&edges_b[j].first, nullptr, &edges_b[j].second);
+                    ++j;
+                } else {
+                    joined.emplace_back(&edges_a[i].first, &edges_a[i].second, &edges_b[j].second);
+                    ++i;
+                    ++j;
+                }
+            }
+
+            ///< the interval merges are independent from one edge to the other
+            std::vector<FlatTimeIntervalSet> merged(joined.size());
+            parallel_for(0, joined.size(), [&](std::size_t k) {
+                merged[k] = combine(op, std::get<1>(joined[k]), std::get<2>(joined[k]));
+            });
+
+            time_t lower, upper;
+            std::tie(lower, upper) = res.definition();
+            for (std::size_t k = 0; k < joined.size(); ++k) {
+                if (merged[k].empty())
+                    continue;
+                auto tis = merged[k].to_time_interval_set();
+                tis.set_definition(lower, upper);
+                auto key = std::get<0>(joined[k]);
+                res.add_edge_w_time(key->first, key->second, tis);
+            }
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Union of two link streams, an edge of res is active when it is active in a or in b.
+     * @param a first link stream
+     * @param b second link stream
+     * @param res link stream receiving the result, the vertices are matched by label
+     */
+    template<typename DirectedS>
+    void stream_union(LinkStreamBase<DirectedS> &a, LinkStreamBase<DirectedS> &b, LinkStreamBase<DirectedS> &res)
+    {
+        detail::stream_operation_apply(detail::stream_operation::union_op, a, b, res);
+    }
+
+    /**
+     * @brief Intersection of two link streams, an edge of res is active when it is active in a and in b.
+     */
+    template<typename DirectedS>
+    void stream_intersection(LinkStreamBase<DirectedS> &a, LinkStreamBase<DirectedS> &b,
+                             LinkStreamBase<DirectedS> &res)
+    {
+        detail::stream_operation_apply(detail::stream_operation::intersection_op, a, b, res);
+    }
+
+    /**
+     * @brief Difference of two link streams, an edge of res is active when it is active in a but not in b.
+     */
+    template<typename DirectedS>
+    void stream_difference(LinkStreamBase<DirectedS> &a, LinkStreamBase<DirectedS> &b,
+                           LinkStreamBase<DirectedS> &res)
+    {
+        detail::stream_operation_apply(detail::stream_operation::difference_op, a, b, res);
+    }
+
+    /**
+     * @brief Symmetric difference of two link streams, an edge of res is active when it is active in
+     * exactly one of a and b.
+     */
+    template<typename DirectedS>
+    void stream_symmetric_difference(LinkStreamBase<DirectedS> &a, LinkStreamBase<DirectedS> &b,
+                                     LinkStreamBase<DirectedS> &res)
+    {
+        detail::stream_operation_apply(detail::stream_operation::symmetric_difference_op, a, b, res);
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_OPERATORS_HPP
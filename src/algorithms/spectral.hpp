@@ -0,0 +1,466 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       spectral.hpp
+/// @brief      Sparse Laplacian matrices and thick restart Lanczos eigensolver
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_SPECTRAL_HPP
+#define BSTREAM_SPECTRAL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+#include <Eigen/SparseCore>
+
+#include "GraphType.hpp"
+#include "components.hpp"
+#include "parallel.hpp"
+#include "random.hpp"
+
+namespace boost::bstream
+{
+    enum class spectral_matrix
+    {
+        adjacency, laplacian, normalized_laplacian
+    };
+
+    enum class spectrum_end
+    {
+        largest, smallest
+    };
+
+    /**
+     * @brief Parameters of lanczos_eigenpairs
+     */
+    struct lanczos_options
+    {
+        std::size_t basis_size = 0;      ///< Lanczos vectors kept in memory, at least 2k + 1 and at most n, 0 for max(2k + 1, 20)
+        std::size_t max_restarts = 1000; ///< a GraphBaseException is thrown past this number of restarts
+        double tolerance = 1e-8;         ///< residual of the Ritz pairs relative to the largest Ritz value
+        std::uint64_t seed = 0;          ///< seed of the starting vector
+        bool multiplicities = true;      ///< search the missing copies of multiple eigenvalues
+    };
+
+    /**
+     * @brief Eigenvalues, in order from the requested end of the spectrum, and the matching
+     * orthonormal eigenvectors in the columns of vectors
+     */
+    struct eigenpairs
+    {
+        Eigen::VectorXd values;
+        MatrixXd vectors;
+    };
+
+    /**
+     * @brief Weighted adjacency matrix of a graph in sparse form.
+     *
+     * A(u, v) is the weight of the edge u -> v, an undirected edge appears in both directions and a
+     * self loop once on the diagonal, as in networkx.
+     *
+     * @param g graph or directed graph
+     * @return the n x n adjacency matrix indexed by vertex_t
+     */
+    template<typename DirectedS>
+    Eigen::SparseMatrix<double> sparse_adjacency(GraphBase<DirectedS> &g)
+    {
+        auto n = static_cast<Eigen::Index>(g.num_vertices());
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.reserve(2 * static_cast<std::size_t>(g.num_edges()));
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto e = g.edge_endpoint(*it);
+            auto w = g.edge_weight(*it);
+            auto s = static_cast<Eigen::Index>(e.first), t = static_cast<Eigen::Index>(e.second);
+            triplets.emplace_back(s, t, w);
+            if (!g.is_directed() && s != t)
+                triplets.emplace_back(t, s, w);
+        }
+        Eigen::SparseMatrix<double> a(n, n);
+        a.setFromTriplets(triplets.begin(), triplets.end());
+        return a;
+    }
+
+    /**
+     * @brief Laplacian matrix L = D - A of a graph in sparse form, D being the diagonal matrix of
+     * the row sums of the weighted adjacency A (the out-degrees of a directed graph).
+     *
+     * @param g graph or directed graph
+     * @return the n x n Laplacian indexed by vertex_t
+     */
+    template<typename DirectedS>
+    Eigen::SparseMatrix<double> laplacian(GraphBase<DirectedS> &g)
+    {
+        auto a = sparse_adjacency(g);
+        Eigen::VectorXd degree = a * Eigen::VectorXd::Ones(a.cols());
+        ///< the diagonal is assembled with the triplets, inserting it in the compressed matrix is quadratic
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.reserve(static_cast<std::size_t>(a.nonZeros() + a.rows()));
+        for (Eigen::Index v = 0; v < a.outerSize(); ++v) {
+            triplets.emplace_back(v, v, degree(v));
+            for (Eigen::SparseMatrix<double>::InnerIterator it(a, v); it; ++it)
+                triplets.emplace_back(it.row(), it.col(), -it.value());
+        }
+        Eigen::SparseMatrix<double> l(a.rows(), a.cols());
+        l.setFromTriplets(triplets.begin(), triplets.end());
+        return l;
+    }
+
+    /**
+     * @brief Normalized Laplacian D^-1/2 (D - A) D^-1/2 of a graph in sparse form, the rows and
+     * columns of the vertices of degree 0 being null, as in networkx.
+     *
+     * @param g graph or directed graph
+     * @return the n x n normalized Laplacian indexed by vertex_t
+     */
+    template<typename DirectedS>
+    Eigen::SparseMatrix<double> normalized_laplacian(GraphBase<DirectedS> &g)
+    {
+        auto l = laplacian(g);
+        Eigen::VectorXd scale(l.rows());
+        for (Eigen::Index v = 0; v < l.rows(); ++v)
+            scale(v) = l.coeff(v, v) > 0 ? 1.0 / std::sqrt(l.coeff(v, v)) : 0.0;
+        l = scale.asDiagonal() * l * scale.asDiagonal();
+        l.prune(0.0);
+        return l;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Dense linear algebra on vectors of n entries split in blocks of rows processed in
+         * parallel. The partial dot products of the blocks are summed in order, so that the results
+         * do not depend on the number of threads.
+         */
+        class block_rows
+        {
+        public:
+            explicit block_rows(Eigen::Index n) : n(n), num_blocks((n + block - 1) / block)
+            {};
+
+            template<typename Function>
+            void for_each(Function f) const
+            {
+                parallel_for(0, static_cast<std::size_t>(num_blocks), [&](std::size_t b) {
+                    auto first = static_cast<Eigen::Index>(b) * block;
+                    f(first, std::min(block, n - first));
+                }, 1);
+            }
+
+            /**
+             * @brief V.leftCols(j)^T w
+             */
+            Eigen::VectorXd project(const MatrixXd &V, Eigen::Index j, const Eigen::VectorXd &w) const
+            {
+                MatrixXd partial(j, num_blocks);
+                for_each([&](Eigen::Index first, Eigen::Index len) {
+                    partial.col(first / block) = V.block(first, 0, len, j).transpose() * w.segment(first, len);
+                });
+                Eigen::VectorXd h = Eigen::VectorXd::Zero(j);
+                for (Eigen::Index b = 0; b < num_blocks; ++b)
+                    h += partial.col(b);
+                return h;
+            }
+
+            double norm(const Eigen::VectorXd &w) const
+            {
+                Eigen::VectorXd partial(num_blocks);
+                for_each([&](Eigen::Index first, Eigen::Index len) {
+                    partial(first / block) = w.segment(first, len).squaredNorm();
+                });
+                return std::sqrt(partial.sum());
+            }
+
+            /**
+             * @brief Remove from w its projection on the j first columns of V (one pass of classical
+             * Gram-Schmidt).
+             * @return the coefficients of w on the columns
+             */
+            Eigen::VectorXd remove(const MatrixXd &V, Eigen::Index j, Eigen::VectorXd &w) const
+            {
+                if (j == 0)
+                    return Eigen::VectorXd();
+                auto h = project(V, j, w);
+                for_each([&](Eigen::Index first, Eigen::Index len) {
+                    w.segment(first, len) -= V.block(first, 0, len, j) * h;
+                });
+                return h;
+            }
+
+            /**
+             * @brief Replace the l first columns of V by V.leftCols(m) Y, row block by row block.
+             */
+            void rotate(MatrixXd &V, Eigen::Index m, const MatrixXd &Y) const
+            {
+                for_each([&](Eigen::Index first, Eigen::Index len) {
+                    MatrixXd rows = V.block(first, 0, len, m) * Y;
+                    V.block(first, 0, len, Y.cols()) = rows;
+                });
+            }
+
+        private:
+            static constexpr Eigen::Index block = 4096;
+            Eigen::Index n, num_blocks;
+        };
+
+        /**
+         * @brief y = M x for a sparse matrix stored by rows, the blocks of rows being computed in
+         * parallel.
+         */
+        inline void spmv(const Eigen::SparseMatrix<double, Eigen::RowMajor> &M, const block_rows &rows,
+                         const Eigen::VectorXd &x, Eigen::VectorXd &y)
+        {
+            rows.for_each([&](Eigen::Index first, Eigen::Index len) {
+                y.segment(first, len) = M.middleRows(first, len) * x;
+            });
+        }
+
+        /**
+         * @brief Thick restart Lanczos (Wu and Simon) on the complement of the orthonormal columns of
+         * locked, which must span an invariant subspace of M, run being the random stream of the
+         * starting vector.
+         *
+         * The Krylov basis holds m vectors fully reorthogonalized, T being the projection of M on
+         * it. When the basis is full and the k wanted Ritz pairs have not converged, the method
+         * restarts from the best Ritz vectors followed by the residual.
+         */
+        template<typename Operator>
+        eigenpairs thick_restart_lanczos(std::size_t n, std::size_t k, Operator &apply, spectrum_end end,
+                                         const lanczos_options &options, const MatrixXd &locked, std::uint64_t run)
+        {
+            auto size = static_cast<Eigen::Index>(n);
+            auto free = n - static_cast<std::size_t>(locked.cols());
+            auto m = static_cast<Eigen::Index>(std::min(free, options.basis_size != 0 ? std::max(options.basis_size, 2 * k + 1)
+                                                                                    : std::max<std::size_t>(2 * k + 1, 20)));
+            auto wanted = static_cast<Eigen::Index>(k);
+            block_rows rows(size);
+            counter_rng rng(options.seed, run);
+            MatrixXd V(size, m), T = MatrixXd::Zero(m, m);
+            ///< two passes of Gram-Schmidt against locked and the j first columns of V
+            auto orthogonalize = [&](Eigen::VectorXd &x, Eigen::Index j) {
+                Eigen::VectorXd h = Eigen::VectorXd::Zero(j);
+                for (int pass = 0; pass < 2; ++pass) {
+                    rows.remove(locked, locked.cols(), x);
+                    if (j > 0)
+                        h += rows.remove(V, j, x);
+                }
+                return h;
+            };
+            ///< random unit vector orthogonal to locked and to the j first columns of V
+            auto random_vector = [&](Eigen::VectorXd &x, Eigen::Index j) {
+                for (Eigen::Index i = 0; i < size; ++i)
+                    x(i) = rng.uniform() - 0.5;
+                orthogonalize(x, j);
+                x /= rows.norm(x);
+            };
+
+            Eigen::VectorXd w(size), v(size);
+            random_vector(v, 0);
+            V.col(0) = v;
+            Eigen::Index kept = 0;
+            for (std::size_t restart = 0; restart <= options.max_restarts; ++restart) {
+                ///< extend the basis to m vectors
+                double residual = 0.0;
+                for (Eigen::Index j = kept; j < m; ++j) {
+                    v = V.col(j);
+                    apply(v, w);
+                    auto applied = rows.norm(w);
+                    auto h = orthogonalize(w, j + 1);
+                    T.block(0, j, j + 1, 1) = h;
+                    T.block(j, 0, 1, j + 1) = h.transpose();
+                    residual = rows.norm(w);
+                    if (j + 1 == m)
+                        break;
+                    ///< invariant subspace, continue with a new direction
+                    if (residual <= 1e-10 * std::max(applied, T.topLeftCorner(j + 1, j + 1).cwiseAbs().maxCoeff())) {
+                        random_vector(v, j + 1);
+                        V.col(j + 1) = v;
+                    } else {
+                        V.col(j + 1) = w / residual;
+                    }
+                }
+
+                ///< Ritz pairs ordered from the requested end
+                Eigen::SelfAdjointEigenSolver<MatrixXd> solver(T);
+                std::vector<Eigen::Index> order(m);
+                std::iota(order.begin(), order.end(), 0);
+                if (end == spectrum_end::largest)
+                    std::reverse(order.begin(), order.end());
+                auto scale = std::max(solver.eigenvalues().cwiseAbs().maxCoeff(), 1e-300);
+                ///< when the basis spans the whole complement of locked the Ritz pairs are exact
+                bool converged = true;
+                if (static_cast<std::size_t>(m) != free)
+                    for (Eigen::Index i = 0; i < wanted && converged; ++i)
+                        converged = residual * std::abs(solver.eigenvectors()(m - 1, order[i])) <= options.tolerance * scale;
+
+                auto keep = converged ? wanted : std::min(m - 1, wanted + (m - wanted) / 2);
+                MatrixXd Y(m, keep);
+                for (Eigen::Index i = 0; i < keep; ++i)
+                    Y.col(i) = solver.eigenvectors().col(order[i]);
+                rows.rotate(V, m, Y);
+                if (converged) {
+                    eigenpairs result;
+                    result.values.resize(wanted);
+                    for (Eigen::Index i = 0; i < wanted; ++i)
+                        result.values(i) = solver.eigenvalues()(order[i]);
+                    result.vectors = V.leftCols(wanted);
+                    return result;
+                }
+
+                ///< thick restart: the kept Ritz vectors are followed by the residual, the couplings between
+                ///< them are recomputed with the next projection
+                T.setZero();
+                for (Eigen::Index i = 0; i < keep; ++i)
+                    T(i, i) = solver.eigenvalues()(order[i]);
+                V.col(keep) = w / residual;
+                kept = keep;
+            }
+            throw GraphBaseException("lanczos_eigenpairs failed to converge in " + std::to_string(options.max_restarts) +
+                                     " restarts");
+        }
+    } // end namespace detail
+
+    /**
+     * @brief k eigenpairs at one end of the spectrum of a symmetric operator, computed by the thick
+     * restart Lanczos method (Wu and Simon).
+     *
+     * The operator is only accessed through apply(x, y), y = M x, so that M never needs to be
+     * stored densely. The Krylov basis holds at most basis_size vectors of n entries, and the vector
+     * operations are performed in parallel by blocks of rows. A Krylov space only holds one vector
+     * of each eigenspace, so unless options.multiplicities is false the method is run again from a
+     * random vector orthogonal to the eigenvectors found, until this finds no better eigenvalue, to
+     * recover the multiple eigenvalues. This costs at least one extra run.
+     *
+     * @param n order of the operator
+     * @param k number of eigenpairs, 0 < k <= n
+     * @param apply function (const Eigen::VectorXd &x, Eigen::VectorXd &y) computing y = M x
+     * @param end largest or smallest eigenvalues
+     * @param options size of the basis, tolerance and seed
+     * @return the k eigenvalues and eigenvectors, ordered from the requested end
+     */
+    template<typename Operator>
+    eigenpairs lanczos_eigenpairs(std::size_t n, std::size_t k, Operator apply, spectrum_end end = spectrum_end::largest,
+                                  const lanczos_options &options = lanczos_options())
+    {
+        if (k == 0 || k > n)
+            throw GraphBaseException("the number of eigenpairs must be between 1 and the order of the matrix");
+        auto better = [end](double x, double y) { return end == spectrum_end::largest ? x > y : x < y; };
+        auto wanted = static_cast<Eigen::Index>(k);
+        auto found = detail::thick_restart_lanczos(n, k, apply, end, options, MatrixXd(n, 0), 0);
+        for (std::uint64_t run = 1; options.multiplicities && k < n; ++run) {
+            auto extra = detail::thick_restart_lanczos(n, std::min(k, n - k), apply, end, options, found.vectors, run);
+            auto scale = std::max(found.values.cwiseAbs().maxCoeff(), extra.values.cwiseAbs().maxCoeff());
+            ///< merge the two lists, an extra eigenvalue must beat the found one by the tolerance
+            std::vector<std::pair<bool, Eigen::Index>> merged;
+            Eigen::Index i = 0, j = 0;
+            while (static_cast<Eigen::Index>(merged.size()) < wanted) {
+                if (j < extra.values.size() &&
+                    (i == wanted || better(extra.values(j) - (end == spectrum_end::largest ? 1 : -1) *
+                                                             options.tolerance * scale, found.values(i))))
+                    merged.emplace_back(true, j++);
+                else
+                    merged.emplace_back(false, i++);
+            }
+            if (j == 0)
+                return found;
+            eigenpairs next;
+            next.values.resize(wanted);
+            next.vectors.resize(static_cast<Eigen::Index>(n), wanted);
+            for (Eigen::Index x = 0; x < wanted; ++x) {
+                auto &source = merged[x].first ? extra : found;
+                next.values(x) = source.values(merged[x].second);
+                next.vectors.col(x) = source.vectors.col(merged[x].second);
+            }
+            found = std::move(next);
+        }
+        return found;
+    }
+
+    /**
+     * @brief k eigenpairs at one end of the spectrum of the adjacency or Laplacian matrix of an
+     * undirected graph.
+     *
+     * The matrix is built in sparse form and the eigenpairs computed by lanczos_eigenpairs with
+     * parallel sparse matrix-vector products.
+     *
+     * @param g graph
+     * @param k number of eigenpairs
+     * @param matrix adjacency, laplacian or normalized_laplacian
+     * @param end largest or smallest eigenvalues
+     * @param options parameters of the Lanczos method
+     * @return the eigenvalues and eigenvectors, indexed by vertex_t
+     */
+    inline eigenpairs graph_eigenpairs(Graph &g, std::size_t k, spectral_matrix matrix = spectral_matrix::adjacency,
+                                       spectrum_end end = spectrum_end::largest,
+                                       const lanczos_options &options = lanczos_options())
+    {
+        Eigen::SparseMatrix<double, Eigen::RowMajor> M;
+        if (matrix == spectral_matrix::adjacency)
+            M = sparse_adjacency(g);
+        else if (matrix == spectral_matrix::laplacian)
+            M = laplacian(g);
+        else
+            M = normalized_laplacian(g);
+        detail::block_rows rows(M.rows());
+        return lanczos_eigenpairs(static_cast<std::size_t>(M.rows()), k,
+                                  [&](const Eigen::VectorXd &x, Eigen::VectorXd &y) { detail::spmv(M, rows, x, y); },
+                                  end, options);
+    }
+
+    /**
+     * @brief Algebraic connectivity of an undirected graph, the second smallest eigenvalue of its
+     * Laplacian (or normalized Laplacian), 0 if and only if the graph is disconnected, in which
+     * case no eigenvalue is computed.
+     *
+     * @param g graph with at least 2 vertices
+     * @param normalized use the normalized Laplacian
+     * @param options parameters of the Lanczos method
+     */
+    inline double algebraic_connectivity(Graph &g, bool normalized = false,
+                                         const lanczos_options &options = lanczos_options())
+    {
+        if (g.num_vertices() < 2)
+            throw GraphBaseException("the algebraic connectivity needs at least 2 vertices");
+        if (number_connected_components(g) > 1)
+            return 0.0;
+        ///< the eigenvalue 0 of a connected graph is simple, a multiple second eigenvalue is found once
+        auto single = options;
+        single.multiplicities = false;
+        auto pairs = graph_eigenpairs(g, 2, normalized ? spectral_matrix::normalized_laplacian : spectral_matrix::laplacian,
+                                      spectrum_end::smallest, single);
+        return std::max(pairs.values(1), 0.0);
+    }
+
+    /**
+     * @brief Laplacian eigenmaps of an undirected graph (Belkin and Niyogi).
+     *
+     * The coordinates of the vertices are the eigenvectors of the normalized Laplacian of the
+     * eigenvalues 2 to dimension + 1, multiplied by D^-1/2, i.e. the nontrivial solutions of the
+     * generalized problem L x = lambda D x. The vertices of degree 0 are mapped to the origin.
+     *
+     * @param g graph with more than dimension vertices
+     * @param dimension dimension of the embedding
+     * @param options parameters of the Lanczos method
+     * @return the n x dimension matrix of the coordinates, indexed by vertex_t
+     */
+    inline MatrixXd spectral_embedding(Graph &g, std::size_t dimension, const lanczos_options &options = lanczos_options())
+    {
+        auto pairs = graph_eigenpairs(g, dimension + 1, spectral_matrix::normalized_laplacian, spectrum_end::smallest,
+                                      options);
+        Eigen::VectorXd degree = sparse_adjacency(g) * Eigen::VectorXd::Ones(pairs.vectors.rows());
+        MatrixXd embedding = pairs.vectors.rightCols(static_cast<Eigen::Index>(dimension));
+        for (Eigen::Index v = 0; v < embedding.rows(); ++v)
+            embedding.row(v) *= degree(v) > 0 ? 1.0 / std::sqrt(degree(v)) : 0.0;
+        return embedding;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_SPECTRAL_HPP
@@ -0,0 +1,401 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       temporal_centrality.hpp
+/// @brief      Fastest paths, temporal betweenness and temporal closeness of link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_TEMPORAL_CENTRALITY_HPP
+#define BSTREAM_TEMPORAL_CENTRALITY_HPP
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    enum class temporal_path_type
+    {
+        fastest, shortest_fastest
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief The link stream cut into elementary segments on which the active edges do not change.
+         *
+         * Only the segments with at least one active edge are kept. The segment k spans the instants
+         * [begin[k], end[k]), its touched vertices are vertices[vertex_offsets[k] ... vertex_offsets[k+1]),
+         * and the neighbors of the touched vertex at global position p are the local positions
+         * adjacency[adjacency_offsets[p] ... adjacency_offsets[p+1]). contact_begin[a] is the first
+         * segment of the edge interval behind the adjacency entry a.
+         */
+        struct snapshot_sequence
+        {
+            std::vector<time_t> begin, end;
+            std::vector<std::size_t> vertex_offsets;
+            std::vector<std::size_t> vertices;
+            std::vector<std::size_t> adjacency_offsets;
+            std::vector<std::size_t> adjacency;
+            std::vector<std::size_t> contact_begin;
+        };
+
+        template<typename DirectedS>
+        snapshot_sequence make_snapshot_sequence(LinkStreamBase<DirectedS> &g)
+        {
+            auto n = static_cast<std::size_t>(g.num_vertices());
+            bool directed = g.is_directed();
+
+            std::vector<std::pair<std::size_t, std::size_t>> endpoints;
+            std::vector<std::pair<time_t, time_t>> intervals;
+            std::vector<std::size_t> interval_edge;
+            std::vector<time_t> times;
+            for (auto it = g.edges().first; it != g.edges().second; ++it) {
+                endpoints.push_back(g.edge_endpoint(*it));
+                auto tis = g.edge_tinterval_set(*it);
+                for (auto ti = tis.begin(); ti != tis.end(); ++ti) {
+                    intervals.emplace_back(ti->lower(), ti->upper());
+                    interval_edge.push_back(endpoints.size() - 1);
+                    times.push_back(ti->lower());
+                    times.push_back(ti->upper());
+                }
+            }
+            std::sort(times.begin(), times.end());
+            times.erase(std::unique(times.begin(), times.end()), times.end());
+            auto num_segments = times.empty() ? 0 : times.size() - 1;
+            auto segment = [&times](time_t t) {
+                return static_cast<std::size_t>(std::lower_bound(times.begin(), times.end(), t) - times.begin());
+            };
+
+            ///< active intervals of every segment, bucketed with a counting sort
+            std::vector<std::size_t> edge_offsets(num_segments + 1, 0);
+            std::vector<std::pair<std::size_t, std::size_t>> ranges(intervals.size());
+            for (std::size_t i = 0; i < intervals.size(); ++i) {
+                ranges[i] = std::make_pair(segment(intervals[i].first), segment(intervals[i].second));
+                for (auto k = ranges[i].first; k < ranges[i].second; ++k)
+                    ++edge_offsets[k + 1];
+            }
+            for (std::size_t k = 0; k < num_segments; ++k)
+                edge_offsets[k + 1] += edge_offsets[k];
+            std::vector<std::size_t> active(edge_offsets[num_segments]);
+            {
+                std::vector<std::size_t> position(edge_offsets.begin(), edge_offsets.end() - 1);
+                for (std::size_t i = 0; i < intervals.size(); ++i)
+                    for (auto k = ranges[i].first; k < ranges[i].second; ++k)
+                        active[position[k]++] = i;
+            }
+
+            ///< local adjacency of every non empty segment
+            snapshot_sequence seq;
+            seq.vertex_offsets.push_back(0);
+            seq.adjacency_offsets.push_back(0);
+            std::vector<std::size_t> local(n, n), degree, index(num_segments);
+            for (std::size_t k = 0; k < num_segments; ++k) {
+                if (edge_offsets[k] == edge_offsets[k + 1])
+                    continue;
+                index[k] = seq.begin.size();
+                auto base = seq.vertices.size();
+                for (auto i = edge_offsets[k]; i < edge_offsets[k + 1]; ++i) {
+                    auto &endpoint = endpoints[interval_edge[active[i]]];
+                    for (auto v : {endpoint.first, endpoint.second}) {
+                        if (local[v] == n) {
+                            local[v] = seq.vertices.size() - base;
+                            seq.vertices.push_back(v);
+                        }
+                    }
+                }
+                auto m = seq.vertices.size() - base;
+                degree.assign(m + 1, 0);
+                for (auto i = edge_offsets[k]; i < edge_offsets[k + 1]; ++i) {
+                    auto &endpoint = endpoints[interval_edge[active[i]]];
+                    ++degree[local[endpoint.first] + 1];
+                    if (!directed)
+                        ++degree[local[endpoint.second] + 1];
+                }
+                auto adjacency_base = seq.adjacency.size();
+                for (std::size_t j = 0; j < m; ++j) {
+                    degree[j + 1] += degree[j];
+                    seq.adjacency_offsets.push_back(adjacency_base + degree[j + 1]);
+                }
+                seq.adjacency.resize(adjacency_base + degree[m]);
+                seq.contact_begin.resize(adjacency_base + degree[m]);
+                for (auto i = edge_offsets[k]; i < edge_offsets[k + 1]; ++i) {
+                    auto &endpoint = endpoints[interval_edge[active[i]]];
+                    auto s = local[endpoint.first], t = local[endpoint.second];
+                    auto contact = index[ranges[active[i]].first];
+                    seq.contact_begin[adjacency_base + degree[s]] = contact;
+                    seq.adjacency[adjacency_base + degree[s]++] = t;
+                    if (!directed) {
+                        seq.contact_begin[adjacency_base + degree[t]] = contact;
+                        seq.adjacency[adjacency_base + degree[t]++] = s;
+                    }
+                }
+                for (auto j = base; j < seq.vertices.size(); ++j)
+                    local[seq.vertices[j]] = n;
+
+                seq.begin.push_back(times[k]);
+                seq.end.push_back(times[k + 1]);
+                seq.vertex_offsets.push_back(seq.vertices.size());
+            }
+            return seq;
+        }
+
+        /**
+         * @brief State of the forward sweep from one source, reused from one source to the next.
+         *
+         * latest[v] is the latest departure from the source that reaches v by the current time and
+         * hops[v] the fewest hops of the paths with this departure. These paths are split in records,
+         * one for each segment in which some of them arrived: head[v] is the most recent record and
+         * next links it to the older records of the same state. A record keeps its vertex, the segment
+         * that created it and its number of paths sigma, the arcs (predecessor record, record) form
+         * the DAG of the counted paths in their order of creation.
+         */
+        struct temporal_sweep_workspace
+        {
+            std::vector<time_t> latest, best_duration;
+            std::vector<std::size_t> hops, head, best_hops, best_record;
+            std::vector<char> reached;
+            std::vector<std::size_t> changed;
+            std::vector<std::size_t> record_vertex, record_segment, record_next;
+            std::vector<double> sigma, dependency;
+            std::vector<std::pair<std::size_t, std::size_t>> arcs;
+        };
+
+        /**
+         * @brief Fastest paths from the source s.
+         *
+         * The traversal of an edge is instantaneous, an interval [b, e) covering the integer instants
+         * b ... e-1. The segments are swept forward: in each of them the states (latest departure,
+         * hops) of the touched vertices are propagated through the active edges, best latest
+         * departure first then fewest hops, and every improved vertex gets a candidate duration
+         * (segment begin - latest departure). The vertices reached directly from s can leave the
+         * segment as late as its last instant.
+         *
+         * A path is a sequence of contacts, the intervals of the edges, and it is counted once, in the
+         * first segment where its last contact is active and its prefix has arrived: a record only
+         * crosses the contacts that begin in the current segment, except in the segment that created
+         * it. The best record of a vertex is the first one with the shortest duration, or with the
+         * fewest hops among the shortest durations for the shortest_fastest type.
+         */
+        inline void temporal_sweep(const snapshot_sequence &seq, std::size_t n, std::size_t s,
+                                   temporal_path_type type, temporal_sweep_workspace &w)
+        {
+            const auto none = std::numeric_limits<std::size_t>::max();
+            bool shortest = type == temporal_path_type::shortest_fastest;
+            w.latest.assign(n, 0);
+            w.hops.assign(n, 0);
+            w.head.assign(n, none);
+            w.reached.assign(n, 0);
+            w.best_duration.assign(n, -1);
+            w.best_hops.assign(n, 0);
+            w.best_record.assign(n, none);
+            w.record_vertex.clear();
+            w.record_segment.clear();
+            w.record_next.clear();
+            w.sigma.clear();
+            w.arcs.clear();
+            w.reached[s] = 1;
+            w.best_duration[s] = 0;
+            auto add_record = [&w](std::size_t v, std::size_t k, std::size_t next, double sigma) {
+                w.record_vertex.push_back(v);
+                w.record_segment.push_back(k);
+                w.record_next.push_back(next);
+                w.sigma.push_back(sigma);
+                w.head[v] = w.sigma.size() - 1;
+            };
+
+            typedef std::tuple<time_t, std::size_t, std::size_t> item; ///< (latest, hops, local vertex)
+            auto worse = [](const item &a, const item &b) {
+                return std::get<0>(a) < std::get<0>(b) ||
+                       (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) > std::get<1>(b));
+            };
+            std::priority_queue<item, std::vector<item>, decltype(worse)> queue(worse);
+
+            for (std::size_t k = 0; k < seq.begin.size(); ++k) {
+                auto base = seq.vertex_offsets[k];
+                auto m = seq.vertex_offsets[k + 1] - base;
+                auto t = seq.begin[k];
+                w.changed.clear();
+                for (std::size_t j = 0; j < m; ++j) {
+                    auto v = seq.vertices[base + j];
+                    if (v == s) {
+                        w.latest[s] = t;
+                        w.hops[s] = 0;
+                        add_record(s, k, none, 1.0);
+                    }
+                    if (w.reached[v])
+                        queue.emplace(w.latest[v], w.hops[v], j);
+                }
+
+                ///< a vertex is popped after all its predecessors of the same departure, its sigma is final
+                while (!queue.empty()) {
+                    time_t latest;
+                    std::size_t hops, j;
+                    std::tie(latest, hops, j) = queue.top();
+                    queue.pop();
+                    auto v = seq.vertices[base + j];
+                    if (latest != w.latest[v] || hops != w.hops[v])
+                        continue;
+                    for (auto r = w.head[v]; r != none; r = w.record_next[r]) {
+                        for (auto a = seq.adjacency_offsets[base + j]; a < seq.adjacency_offsets[base + j + 1]; ++a) {
+                            if (w.record_segment[r] != k && seq.contact_begin[a] != k)
+                                continue;
+                            auto u = seq.vertices[base + seq.adjacency[a]];
+                            if (!w.reached[u] || latest > w.latest[u] || (latest == w.latest[u] && hops + 1 < w.hops[u])) {
+                                w.reached[u] = 1;
+                                w.latest[u] = latest;
+                                w.hops[u] = hops + 1;
+                                add_record(u, k, none, 0.0);
+                                w.changed.push_back(u);
+                                queue.emplace(latest, hops + 1, seq.adjacency[a]);
+                            } else if (latest != w.latest[u] || hops + 1 != w.hops[u]) {
+                                continue;
+                            } else if (w.record_segment[w.head[u]] != k) {
+                                add_record(u, k, w.head[u], 0.0);
+                            }
+                            w.sigma[w.head[u]] += w.sigma[r];
+                            w.arcs.emplace_back(r, w.head[u]);
+                        }
+                    }
+                }
+
+                for (auto u : w.changed) {
+                    auto duration = t - w.latest[u];
+                    auto &best = w.best_duration[u];
+                    if (best == -1 || duration < best ||
+                        (shortest && duration == best && w.hops[u] < w.best_hops[u])) {
+                        best = duration;
+                        w.best_hops[u] = w.hops[u];
+                        w.best_record[u] = w.head[u];
+                    }
+                }
+                for (std::size_t j = 0; j < m; ++j) {
+                    auto v = seq.vertices[base + j];
+                    if (w.reached[v] && w.latest[v] == t)
+                        w.latest[v] = seq.end[k] - 1;
+                }
+            }
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Duration of the fastest temporal paths from a source to every vertex.
+     *
+     * Edges are traversed instantaneously at integer instants, a path can wait on a vertex and its
+     * duration is its arrival time minus its departure time.
+     *
+     * @param g link stream
+     * @param source vertex_t
+     * @return the duration for each vertex indexed by vertex_t, -1 for unreachable vertices
+     */
+    template<typename DirectedS>
+    std::vector<time_t> fastest_path_duration(LinkStreamBase<DirectedS> &g, std::size_t source)
+    {
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        if (source >= n)
+            throw LinkStreamBaseException("the vertex " + std::to_string(source) + " doesn't exist");
+        auto seq = detail::make_snapshot_sequence(g);
+        detail::temporal_sweep_workspace w;
+        detail::temporal_sweep(seq, n, source, temporal_path_type::fastest, w);
+        return w.best_duration;
+    }
+
+    /**
+     * @brief Temporal betweenness of every vertex.
+     *
+     * A temporal path is a sequence of contacts, the intervals of the edges, crossed at non
+     * decreasing instants. For every ordered pair (s, v) the paths counted are those of the first
+     * arrival at v with the shortest duration, or with the fewest hops among the shortest durations
+     * for the shortest_fastest type, that leave s as late as possible and have the fewest hops for
+     * this departure. Each intermediate vertex receives the fraction of these paths going through
+     * it: the forward sweep counts the paths reaching every state and the dependencies are
+     * accumulated backward over the DAG of the counted paths, as in the algorithm of Brandes. The
+     * sources are processed in parallel, every thread accumulating in its own vector.
+     *
+     * @param g link stream
+     * @param type fastest or shortest_fastest
+     * @param normalized divide by (n-1)(n-2)
+     * @return the betweenness of each vertex indexed by vertex_t
+     */
+    template<typename DirectedS>
+    std::vector<double> temporal_betweenness(LinkStreamBase<DirectedS> &g,
+                                             temporal_path_type type = temporal_path_type::shortest_fastest,
+                                             bool normalized = true)
+    {
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        auto seq = detail::make_snapshot_sequence(g);
+        std::vector<detail::temporal_sweep_workspace> work(num_threads());
+        std::vector<std::vector<double>> accumulator(num_threads());
+
+        parallel_for_threads(0, n, [&](std::size_t s, unsigned tid) {
+            auto &w = work[tid];
+            auto &acc = accumulator[tid];
+            if (acc.empty())
+                acc.assign(n, 0.0);
+            detail::temporal_sweep(seq, n, s, type, w);
+            ///< dependency[r]: sum over the targets v of the paths from r to the best record of v over sigma_sv
+            w.dependency.assign(w.sigma.size(), 0.0);
+            for (auto arc = w.arcs.rbegin(); arc != w.arcs.rend(); ++arc) {
+                auto r = arc->second;
+                auto target = w.best_record[w.record_vertex[r]] == r ? 1.0 / w.sigma[r] : 0.0;
+                w.dependency[arc->first] += target + w.dependency[r];
+            }
+            for (std::size_t r = 0; r < w.sigma.size(); ++r) {
+                if (w.record_vertex[r] != s)
+                    acc[w.record_vertex[r]] += w.sigma[r] * w.dependency[r];
+            }
+        }, 1);
+
+        std::vector<double> betweenness(n, 0.0);
+        for (auto &acc : accumulator)
+            for (std::size_t v = 0; v < acc.size(); ++v)
+                betweenness[v] += acc[v];
+        if (normalized && n > 2) {
+            auto scale = 1.0 / (static_cast<double>(n - 1) * static_cast<double>(n - 2));
+            for (auto &b : betweenness)
+                b *= scale;
+        }
+        return betweenness;
+    }
+
+    /**
+     * @brief Temporal closeness of every vertex, the sum (harmonic closeness) of 1 / (1 + d) over the
+     * fastest path durations d from the vertex, unreachable vertices counting for 0.
+     *
+     * @param g link stream
+     * @param normalized divide by n-1
+     * @return the closeness of each vertex indexed by vertex_t
+     */
+    template<typename DirectedS>
+    std::vector<double> temporal_closeness(LinkStreamBase<DirectedS> &g, bool normalized = true)
+    {
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        auto seq = detail::make_snapshot_sequence(g);
+        std::vector<detail::temporal_sweep_workspace> work(num_threads());
+        std::vector<double> closeness(n, 0.0);
+
+        parallel_for_threads(0, n, [&](std::size_t s, unsigned tid) {
+            auto &w = work[tid];
+            detail::temporal_sweep(seq, n, s, temporal_path_type::fastest, w);
+            double sum = 0.0;
+            for (std::size_t v = 0; v < n; ++v) {
+                if (v != s && w.best_duration[v] != -1)
+                    sum += 1.0 / (1.0 + static_cast<double>(w.best_duration[v]));
+            }
+            closeness[s] = (normalized && n > 1) ? sum / static_cast<double>(n - 1) : sum;
+        }, 1);
+        return closeness;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_TEMPORAL_CENTRALITY_HPP
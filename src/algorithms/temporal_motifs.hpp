@@ -0,0 +1,515 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       temporal_motifs.hpp
+/// @brief      Counting of the 2 and 3 vertex, 3 event delta-temporal motifs of link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_TEMPORAL_MOTIFS_HPP
+#define BSTREAM_TEMPORAL_MOTIFS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include <Eigen/Core>
+
+#include "GraphType.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    namespace detail
+    {
+        typedef std::array<std::uint64_t, 36> motif_counts; ///< counts indexed by 6 * code(e2) + code(e3)
+
+        /**
+         * @brief Code of the event s -> t relative to the first event a -> b of a motif.
+         *
+         * The vertices of a motif are named by order of appearance, a -> b is the first event and c
+         * the third vertex: 0 = a->b, 1 = b->a, 2 = a->c, 3 = c->a, 4 = b->c, 5 = c->b.
+         */
+        inline int motif_code(std::size_t a, std::size_t b, std::size_t s, std::size_t t)
+        {
+            if (s == a && t == b)
+                return 0;
+            if (s == b && t == a)
+                return 1;
+            if (s == a)
+                return 2;
+            if (t == a)
+                return 3;
+            if (s == b)
+                return 4;
+            return 5;
+        }
+
+        /**
+         * @brief Number of the sequences of 3 labels among L in a sliding window of events
+         * (Paranjape et al., algorithm 1).
+         *
+         * c1[x] is the number of events labeled x in the window, c2[x][y] the number of ordered pairs
+         * x, y and c3[x][y][z] the number of triples found so far. An event is pushed after all the
+         * events that it follows and the oldest event of the window is popped first.
+         */
+        template<std::size_t L>
+        struct sequence_counter
+        {
+            std::array<std::uint64_t, L> c1{};
+            std::array<std::array<std::uint64_t, L>, L> c2{};
+            std::array<std::array<std::array<std::uint64_t, L>, L>, L> c3{};
+
+            void push(std::size_t z)
+            {
+                for (std::size_t x = 0; x < L; ++x)
+                    for (std::size_t y = 0; y < L; ++y)
+                        c3[x][y][z] += c2[x][y];
+                for (std::size_t x = 0; x < L; ++x)
+                    c2[x][z] += c1[x];
+                ++c1[z];
+            }
+
+            void pop(std::size_t z)
+            {
+                --c1[z];
+                for (std::size_t y = 0; y < L; ++y)
+                    c2[z][y] -= c1[y];
+            }
+        };
+
+        /**
+         * @brief The events of a link stream, one per time interval starting at its lower bound.
+         *
+         * The events are numbered in chronological order, ties being broken by the order of the
+         * edges. Self loops are ignored. The events of each unordered vertex pair are stored in
+         * pair_events[pair_offsets[p] ... pair_offsets[p+1]), the events of each vertex in
+         * vertex_events[vertex_offsets[v] ... vertex_offsets[v+1]), both in chronological order.
+         */
+        struct event_sequence
+        {
+            std::vector<time_t> time;
+            std::vector<std::size_t> source, target;
+            std::vector<std::pair<std::size_t, std::size_t>> pairs; ///< (u, v), u < v, sorted
+            std::vector<std::size_t> pair_offsets, pair_events;
+            std::vector<std::size_t> vertex_offsets, vertex_events;
+        };
+
+        template<typename DirectedS>
+        event_sequence make_event_sequence(LinkStreamBase<DirectedS> &g)
+        {
+            auto n = static_cast<std::size_t>(g.num_vertices());
+            std::vector<std::tuple<time_t, std::size_t, std::size_t>> events;
+            for (auto it = g.edges().first; it != g.edges().second; ++it) {
+                auto e = g.edge_endpoint(*it);
+                if (e.first == e.second)
+                    continue;
+                auto tis = g.edge_tinterval_set(*it);
+                for (auto ti = tis.begin(); ti != tis.end(); ++ti)
+                    events.emplace_back(ti->lower(), e.first, e.second);
+            }
+            std::stable_sort(events.begin(), events.end(), [](const auto &x, const auto &y) {
+                return std::get<0>(x) < std::get<0>(y);
+            });
+
+            event_sequence seq;
+            auto m = events.size();
+            seq.time.resize(m);
+            seq.source.resize(m);
+            seq.target.resize(m);
+            std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> keys(m);
+            seq.vertex_offsets.assign(n + 1, 0);
+            for (std::size_t i = 0; i < m; ++i) {
+                std::tie(seq.time[i], seq.source[i], seq.target[i]) = events[i];
+                auto u = std::min(seq.source[i], seq.target[i]), v = std::max(seq.source[i], seq.target[i]);
+                keys[i] = std::make_tuple(u, v, i);
+                ++seq.vertex_offsets[u + 1];
+                ++seq.vertex_offsets[v + 1];
+            }
+            events.clear();
+            events.shrink_to_fit();
+
+            ///< events of every vertex pair
+            std::sort(keys.begin(), keys.end());
+            seq.pair_events.resize(m);
+            seq.pair_offsets.push_back(0);
+            for (std::size_t i = 0; i < m; ++i) {
+                auto pair = std::make_pair(std::get<0>(keys[i]), std::get<1>(keys[i]));
+                if (seq.pairs.empty() || seq.pairs.back() != pair) {
+                    if (!seq.pairs.empty())
+                        seq.pair_offsets.push_back(i);
+                    seq.pairs.push_back(pair);
+                }
+                seq.pair_events[i] = std::get<2>(keys[i]);
+            }
+            if (!seq.pairs.empty())
+                seq.pair_offsets.push_back(m);
+
+            ///< events of every vertex, bucketed with a counting sort
+            for (std::size_t v = 0; v < n; ++v)
+                seq.vertex_offsets[v + 1] += seq.vertex_offsets[v];
+            seq.vertex_events.resize(2 * m);
+            std::vector<std::size_t> position(seq.vertex_offsets.begin(), seq.vertex_offsets.end() - 1);
+            for (std::size_t i = 0; i < m; ++i) {
+                seq.vertex_events[position[seq.source[i]]++] = i;
+                seq.vertex_events[position[seq.target[i]]++] = i;
+            }
+            return seq;
+        }
+
+        /**
+         * @brief Sum of the per-thread counts.
+         */
+        inline motif_counts merge_counts(const std::vector<motif_counts> &work)
+        {
+            motif_counts total{};
+            for (auto &w : work)
+                for (std::size_t k = 0; k < total.size(); ++k)
+                    total[k] += w[k];
+            return total;
+        }
+
+        /**
+         * @brief Motifs on 2 vertices, all the events of a motif are on the same vertex pair.
+         *
+         * The events of every pair are labeled by their direction and counted with a sliding window,
+         * in parallel over the pairs.
+         */
+        inline motif_counts two_vertex_motifs(const event_sequence &seq, time_t delta)
+        {
+            std::vector<motif_counts> work(num_threads(), motif_counts{});
+            parallel_for_threads(0, seq.pairs.size(), [&](std::size_t p, unsigned tid) {
+                auto first = seq.pair_offsets[p], last = seq.pair_offsets[p + 1];
+                if (last - first < 3)
+                    return;
+                auto u = seq.pairs[p].first;
+                sequence_counter<2> counter;
+                auto label = [&](std::size_t i) { return seq.source[seq.pair_events[i]] == u ? 0 : 1; };
+                for (auto start = first, k = first; k < last; ++k) {
+                    auto t = seq.time[seq.pair_events[k]];
+                    for (; seq.time[seq.pair_events[start]] + delta < t; ++start)
+                        counter.pop(label(start));
+                    counter.push(label(k));
+                }
+                ///< label 0 is u -> v, label 1 is v -> u
+                auto v = seq.pairs[p].second;
+                for (int x = 0; x < 2; ++x) {
+                    auto a = x == 0 ? u : v, b = x == 0 ? v : u;
+                    for (int y = 0; y < 2; ++y)
+                        for (int z = 0; z < 2; ++z)
+                            work[tid][6 * motif_code(a, b, y == 0 ? u : v, y == 0 ? v : u) +
+                                      motif_code(a, b, z == 0 ? u : v, z == 0 ? v : u)] += counter.c3[x][y][z];
+                }
+            }, 256);
+            return merge_counts(work);
+        }
+
+        /**
+         * @brief Motifs on 3 vertices whose events are on two vertex pairs sharing a center vertex.
+         *
+         * For every center the events are swept in chronological order (Paranjape et al.,
+         * algorithm 2). With d the direction of an event (0 out of the center, 1 into the center),
+         * the window keeps for every neighbor x the number of events cnt[x][d], the number of pairs
+         * of events both with x, same[x][d1][d2], and the sums of the number of events inserted
+         * before and after each event of x, so that the number of pairs of events (i, j), i < j, with
+         * one or the other on x, is obtained in O(1) when a new event arrives. The centers are
+         * processed in parallel.
+         */
+        inline motif_counts star_motifs(const event_sequence &seq, time_t delta, std::size_t n)
+        {
+            constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+            typedef std::array<std::array<std::uint64_t, 2>, 2> counter2;
+            struct workspace
+            {
+                std::vector<std::size_t> local;                 ///< vertex -> neighbor index of the center
+                std::vector<std::array<std::uint64_t, 2>> cnt;
+                std::vector<counter2> same, after, before;
+                motif_counts counts{};
+            };
+            std::vector<workspace> work(num_threads());
+
+            parallel_for_threads(0, n, [&](std::size_t c, unsigned tid) {
+                auto first = seq.vertex_offsets[c], last = seq.vertex_offsets[c + 1];
+                if (last - first < 3)
+                    return;
+                auto &w = work[tid];
+                if (w.local.empty())
+                    w.local.assign(n, npos);
+
+                std::vector<std::size_t> neighbors;
+                for (auto i = first; i < last; ++i) {
+                    auto e = seq.vertex_events[i];
+                    auto x = seq.source[e] == c ? seq.target[e] : seq.source[e];
+                    if (w.local[x] == npos) {
+                        w.local[x] = neighbors.size();
+                        neighbors.push_back(x);
+                    }
+                }
+                auto k = neighbors.size();
+                w.cnt.assign(k, {0, 0});
+                w.same.assign(k, counter2{});
+                w.after.assign(k, counter2{});
+                w.before.assign(k, counter2{});
+                counter2 same_total{};
+                std::array<std::uint64_t, 2> inserted{0, 0}, removed{0, 0};
+                std::vector<std::array<std::uint64_t, 2>> stamp(last - first);
+                ///< (x, x, y), (x, y, x) and (x, y, y) triples by direction
+                std::array<std::array<std::array<std::array<std::uint64_t, 2>, 2>, 2>, 3> star{};
+
+                auto neighbor = [&](std::size_t i) {
+                    auto e = seq.vertex_events[i];
+                    return w.local[seq.source[e] == c ? seq.target[e] : seq.source[e]];
+                };
+                auto direction = [&](std::size_t i) { return seq.source[seq.vertex_events[i]] == c ? 0 : 1; };
+
+                for (auto start = first, i = first; i < last; ++i) {
+                    auto t = seq.time[seq.vertex_events[i]];
+                    for (; seq.time[seq.vertex_events[start]] + delta < t; ++start) {
+                        auto x = neighbor(start);
+                        auto d = direction(start);
+                        --w.cnt[x][d];
+                        for (int d2 = 0; d2 < 2; ++d2) {
+                            w.same[x][d][d2] -= w.cnt[x][d2];
+                            same_total[d][d2] -= w.cnt[x][d2];
+                            w.after[x][d][d2] -= stamp[start - first][d2] + (d2 == d ? 1 : 0);
+                            w.before[x][d][d2] -= stamp[start - first][d2];
+                        }
+                        ++removed[d];
+                    }
+
+                    auto y = neighbor(i);
+                    auto dk = direction(i);
+                    for (int d1 = 0; d1 < 2; ++d1) {
+                        for (int d2 = 0; d2 < 2; ++d2) {
+                            ///< pairs (i1, i2) with i1 on y, and with i2 on y
+                            auto first_on_y = w.cnt[y][d1] * inserted[d2] - w.after[y][d1][d2];
+                            auto second_on_y = w.before[y][d2][d1] - w.cnt[y][d2] * removed[d1];
+                            star[0][d1][d2][dk] += same_total[d1][d2] - w.same[y][d1][d2];
+                            star[1][d1][d2][dk] += first_on_y - w.same[y][d1][d2];
+                            star[2][d1][d2][dk] += second_on_y - w.same[y][d1][d2];
+                        }
+                    }
+
+                    stamp[i - first] = inserted;
+                    for (int d1 = 0; d1 < 2; ++d1) {
+                        w.same[y][d1][dk] += w.cnt[y][d1];
+                        same_total[d1][dk] += w.cnt[y][d1];
+                    }
+                    ++w.cnt[y][dk];
+                    ++inserted[dk];
+                    for (int d2 = 0; d2 < 2; ++d2) {
+                        w.after[y][dk][d2] += inserted[d2];
+                        w.before[y][dk][d2] += stamp[i - first][d2];
+                    }
+                }
+                for (auto x : neighbors)
+                    w.local[x] = npos;
+
+                ///< center 0, the neighbors of the first event and of the other event are 1 and 2
+                auto oriented = [](std::size_t x, int d) {
+                    return d == 0 ? std::make_pair(std::size_t(0), x) : std::make_pair(x, std::size_t(0));
+                };
+                const std::size_t pattern[3][3] = {{1, 1, 2}, {1, 2, 1}, {1, 2, 2}};
+                for (int p = 0; p < 3; ++p) {
+                    for (int d1 = 0; d1 < 2; ++d1) {
+                        auto e1 = oriented(pattern[p][0], d1);
+                        for (int d2 = 0; d2 < 2; ++d2) {
+                            auto e2 = oriented(pattern[p][1], d2);
+                            for (int d3 = 0; d3 < 2; ++d3) {
+                                auto e3 = oriented(pattern[p][2], d3);
+                                w.counts[6 * motif_code(e1.first, e1.second, e2.first, e2.second) +
+                                         motif_code(e1.first, e1.second, e3.first, e3.second)] += star[p][d1][d2][d3];
+                            }
+                        }
+                    }
+                }
+            }, 64);
+
+            motif_counts total{};
+            for (auto &w : work)
+                for (std::size_t k = 0; k < total.size(); ++k)
+                    total[k] += w.counts[k];
+            return total;
+        }
+
+        /**
+         * @brief Motifs whose 3 events are on the 3 vertex pairs of a triangle.
+         *
+         * The triangles of the static graph are listed with the edges oriented by increasing degree.
+         * The events of the 3 pairs of every triangle are merged and counted with a sliding window
+         * over the 6 (pair, direction) labels, in parallel over the first vertex of the triangles.
+         */
+        inline motif_counts triangle_motifs(const event_sequence &seq, time_t delta, std::size_t n)
+        {
+            constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+            ///< static graph, an edge is oriented from the lower to the higher (degree, id)
+            std::vector<std::size_t> degree(n, 0);
+            for (auto &p : seq.pairs) {
+                ++degree[p.first];
+                ++degree[p.second];
+            }
+            auto lower = [&degree](std::size_t u, std::size_t v) {
+                return degree[u] < degree[v] || (degree[u] == degree[v] && u < v);
+            };
+            std::vector<std::size_t> offsets(n + 1, 0);
+            for (auto &p : seq.pairs)
+                ++offsets[(lower(p.first, p.second) ? p.first : p.second) + 1];
+            for (std::size_t v = 0; v < n; ++v)
+                offsets[v + 1] += offsets[v];
+            std::vector<std::pair<std::size_t, std::size_t>> out(seq.pairs.size()); ///< (neighbor, pair id)
+            {
+                std::vector<std::size_t> position(offsets.begin(), offsets.end() - 1);
+                for (std::size_t p = 0; p < seq.pairs.size(); ++p) {
+                    auto u = seq.pairs[p].first, v = seq.pairs[p].second;
+                    if (lower(u, v))
+                        out[position[u]++] = std::make_pair(v, p);
+                    else
+                        out[position[v]++] = std::make_pair(u, p);
+                }
+            }
+
+            struct workspace
+            {
+                std::vector<std::size_t> mark; ///< out-neighbor of the current vertex -> pair id
+                std::vector<std::pair<std::size_t, std::size_t>> events; ///< (event, label)
+                motif_counts counts{};
+            };
+            std::vector<workspace> work(num_threads());
+
+            parallel_for_threads(0, n, [&](std::size_t u, unsigned tid) {
+                if (offsets[u] == offsets[u + 1])
+                    return;
+                auto &w = work[tid];
+                if (w.mark.empty())
+                    w.mark.assign(n, npos);
+                for (auto i = offsets[u]; i < offsets[u + 1]; ++i)
+                    w.mark[out[i].first] = out[i].second;
+
+                for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+                    auto v = out[i].first;
+                    for (auto j = offsets[v]; j < offsets[v + 1]; ++j) {
+                        auto x = out[j].first;
+                        if (w.mark[x] == npos)
+                            continue;
+                        ///< the triangle (u, v, x) and its pairs
+                        const std::size_t pair[3] = {out[i].second, w.mark[x], out[j].second};
+                        w.events.clear();
+                        for (std::size_t q = 0; q < 3; ++q) {
+                            auto lo = seq.pairs[pair[q]].first;
+                            for (auto k = seq.pair_offsets[pair[q]]; k < seq.pair_offsets[pair[q] + 1]; ++k) {
+                                auto e = seq.pair_events[k];
+                                w.events.emplace_back(e, 2 * q + (seq.source[e] == lo ? 0 : 1));
+                            }
+                        }
+                        if (w.events.size() < 3)
+                            continue;
+                        std::sort(w.events.begin(), w.events.end());
+
+                        sequence_counter<6> counter;
+                        for (std::size_t start = 0, k = 0; k < w.events.size(); ++k) {
+                            auto t = seq.time[w.events[k].first];
+                            for (; seq.time[w.events[start].first] + delta < t; ++start)
+                                counter.pop(w.events[start].second);
+                            counter.push(w.events[k].second);
+                        }
+
+                        auto endpoint = [&](std::size_t label) {
+                            auto &p = seq.pairs[pair[label / 2]];
+                            return label % 2 == 0 ? p : std::make_pair(p.second, p.first);
+                        };
+                        for (std::size_t l1 = 0; l1 < 6; ++l1) {
+                            auto e1 = endpoint(l1);
+                            for (std::size_t l2 = 0; l2 < 6; ++l2) {
+                                if (l2 / 2 == l1 / 2)
+                                    continue;
+                                auto e2 = endpoint(l2);
+                                for (std::size_t l3 = 0; l3 < 6; ++l3) {
+                                    if (l3 / 2 == l1 / 2 || l3 / 2 == l2 / 2)
+                                        continue;
+                                    auto e3 = endpoint(l3);
+                                    w.counts[6 * motif_code(e1.first, e1.second, e2.first, e2.second) +
+                                             motif_code(e1.first, e1.second, e3.first, e3.second)] +=
+                                            counter.c3[l1][l2][l3];
+                                }
+                            }
+                        }
+                    }
+                }
+                for (auto i = offsets[u]; i < offsets[u + 1]; ++i)
+                    w.mark[out[i].first] = npos;
+            }, 16);
+
+            motif_counts total{};
+            for (auto &w : work)
+                for (std::size_t k = 0; k < total.size(); ++k)
+                    total[k] += w.counts[k];
+            return total;
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Number of delta-temporal motifs with 3 events on 2 or 3 vertices (Paranjape et al.).
+     *
+     * Every time interval of an edge is an event at its lower bound. A motif instance is a sequence
+     * of 3 events, in chronological order (ties broken by the order of the edges), spanning at most
+     * delta, connected and on at most 3 vertices. The vertices of an instance are named a, b by its
+     * first event a -> b and c for the third vertex, and the instance is counted in the cell
+     * (code(e2), code(e3)) of a 6 x 6 matrix, with the codes 0 = a->b, 1 = b->a, 2 = a->c, 3 = c->a,
+     * 4 = b->c, 5 = c->b.
+     *
+     * For an undirected link stream the direction of the events is dropped and the counts are
+     * folded into a 3 x 3 matrix indexed by the vertex pair of the second and third event, 0 = ab,
+     * 1 = ac, 2 = bc, a being the vertex of the first event shared with the second one when the
+     * second event is on another pair. Only the cells (ab, ab), (ab, ac), (ac, ab), (ac, ac) and
+     * (ac, bc) can be non zero.
+     *
+     * The 2 vertex motifs, the stars and the triangles are counted separately by sliding windows
+     * over the time-sorted events, in parallel over the vertex pairs, the centers and the
+     * triangles. Self loops are ignored.
+     *
+     * @param g link stream or directed link stream
+     * @param delta maximum time between the first and the last event of a motif
+     * @return the 6 x 6 (directed) or 3 x 3 (undirected) matrix of counts
+     */
+    template<typename DirectedS>
+    MatrixXd temporal_motifs(LinkStreamBase<DirectedS> &g, time_t delta)
+    {
+        if (delta < 0)
+            throw LinkStreamBaseException("delta must be non negative");
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        auto seq = detail::make_event_sequence(g);
+        auto two = detail::two_vertex_motifs(seq, delta);
+        auto star = detail::star_motifs(seq, delta, n);
+        auto triangle = detail::triangle_motifs(seq, delta, n);
+
+        if (g.is_directed()) {
+            MatrixXd counts = MatrixXd::Zero(6, 6);
+            for (int i = 0; i < 6; ++i)
+                for (int j = 0; j < 6; ++j)
+                    counts(i, j) = static_cast<double>(two[6 * i + j] + star[6 * i + j] + triangle[6 * i + j]);
+            return counts;
+        }
+
+        MatrixXd counts = MatrixXd::Zero(3, 3);
+        for (int i = 0; i < 6; ++i) {
+            for (int j = 0; j < 6; ++j) {
+                ///< ab, ac, bc, then a is the vertex shared by the first two events
+                int p2 = i / 2, p3 = j / 2;
+                if (p2 == 2)
+                    p2 = 1, p3 = p3 == 0 ? 0 : 3 - p3;
+                else if (p2 == 0 && p3 == 2)
+                    p3 = 1;
+                counts(p2, p3) += static_cast<double>(two[6 * i + j] + star[6 * i + j] + triangle[6 * i + j]);
+            }
+        }
+        return counts;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_TEMPORAL_MOTIFS_HPP
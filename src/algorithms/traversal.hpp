@@ -0,0 +1,183 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       traversal.hpp
+/// @brief      Breadth first traversals and unweighted shortest paths
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_TRAVERSAL_HPP
+#define BSTREAM_TRAVERSAL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GraphType.hpp"
+#include "CSR.hpp"
+#include "parallel.hpp"
+
+namespace boost::bstream
+{
+    namespace detail
+    {
+        /**
+         * @brief Direction-optimizing breadth first search (Beamer et al.) from a set of sources.
+         *
+         * Each level is expanded top-down from the frontier, or bottom-up by letting every unvisited
+         * vertex look for a parent among its in-neighbors. The search switches to bottom-up when the
+         * edges of the frontier exceed 1/alpha of the unexplored edges and back to top-down when the
+         * frontier holds less than 1/beta of the vertices. Both directions run in parallel.
+         *
+         * @param out out-adjacency
+         * @param in in-adjacency, the same as out for undirected graphs
+         * @param sources vertices at distance 0
+         * @return the number of hops from the closest source, -1 for unreachable vertices
+         */
+        inline std::vector<std::int64_t>
+        direction_optimizing_bfs(const CSRGraph &out, const CSRGraph &in, const std::vector<std::size_t> &sources)
+        {
+            const std::size_t alpha = 14, beta = 24;
+            auto n = out.num_vertices;
+            std::vector<std::atomic<std::int64_t>> dist(n);
+            for (auto &d : dist)
+                d.store(-1, std::memory_order_relaxed);
+
+            std::vector<std::size_t> frontier;
+            for (auto s : sources) {
+                if (dist[s].load(std::memory_order_relaxed) == -1) {
+                    dist[s].store(0, std::memory_order_relaxed);
+                    frontier.push_back(s);
+                }
+            }
+
+            std::vector<std::vector<std::size_t>> next(num_threads());
+            std::size_t unexplored = out.targets.size();
+            bool bottom_up = false;
+            for (std::int64_t level = 0; !frontier.empty(); ++level) {
+                std::size_t frontier_edges = 0;
+                for (auto v : frontier)
+                    frontier_edges += out.degree(v);
+                unexplored -= std::min(unexplored, frontier_edges);
+                if (!bottom_up && frontier_edges > unexplored / alpha)
+                    bottom_up = true;
+                else if (bottom_up && frontier.size() < n / beta)
+                    bottom_up = false;
+
+                for (auto &buffer : next)
+                    buffer.clear();
+                if (bottom_up) {
+                    parallel_for_threads(0, n, [&](std::size_t v, unsigned tid) {
+                        if (dist[v].load(std::memory_order_relaxed) != -1)
+                            return;
+                        for (auto i = in.offsets[v]; i < in.offsets[v + 1]; ++i) {
+                            if (dist[in.targets[i]].load(std::memory_order_relaxed) == level) {
+                                dist[v].store(level + 1, std::memory_order_relaxed);
+                                next[tid].push_back(v);
+                                break;
+                            }
+                        }
+                    }, 1024);
+                } else {
+                    parallel_for_threads(0, frontier.size(), [&](std::size_t k, unsigned tid) {
+                        auto v = frontier[k];
+                        for (auto i = out.offsets[v]; i < out.offsets[v + 1]; ++i) {
+                            auto u = out.targets[i];
+                            std::int64_t unvisited = -1;
+                            if (dist[u].load(std::memory_order_relaxed) == -1 &&
+                                dist[u].compare_exchange_strong(unvisited, level + 1, std::memory_order_relaxed))
+                                next[tid].push_back(u);
+                        }
+                    }, 64);
+                }
+
+                frontier.clear();
+                for (auto &buffer : next)
+                    frontier.insert(frontier.end(), buffer.begin(), buffer.end());
+            }
+
+            std::vector<std::int64_t> res(n);
+            for (std::size_t v = 0; v < n; ++v)
+                res[v] = dist[v].load(std::memory_order_relaxed);
+            return res;
+        }
+
+        template<typename DirectedS>
+        void check_sources(GraphBase<DirectedS> &g, const std::vector<std::size_t> &sources)
+        {
+            for (auto s : sources) {
+                if (s >= static_cast<std::size_t>(g.num_vertices()))
+                    throw GraphBaseException("the vertex " + std::to_string(s) + " doesn't exist");
+            }
+        }
+    } // end namespace detail
+
+    /**
+     * @brief Hop distance from the closest of several sources to every vertex.
+     * @param g graph
+     * @param sources vector of vertex_t
+     * @return the distance of each vertex indexed by vertex_t, -1 if it is not reachable
+     */
+    template<typename DirectedS>
+    std::vector<std::int64_t> multi_source_bfs(GraphBase<DirectedS> &g, const std::vector<std::size_t> &sources)
+    {
+        detail::check_sources(g, sources);
+        auto out = make_csr(g);
+        if (!g.is_directed())
+            return detail::direction_optimizing_bfs(out, out, sources);
+        auto in = transpose(out);
+        return detail::direction_optimizing_bfs(out, in, sources);
+    }
+
+    /**
+     * @brief Hop distance from the source to every vertex, following the edges direction.
+     * @param g graph
+     * @param source vertex_t
+     * @return the distance of each vertex indexed by vertex_t, -1 if it is not reachable
+     */
+    template<typename DirectedS>
+    std::vector<std::int64_t> bfs(GraphBase<DirectedS> &g, std::size_t source)
+    {
+        return multi_source_bfs(g, std::vector<std::size_t>{source});
+    }
+
+    /**
+     * @brief One of the shortest paths (in number of hops) from s to t.
+     * @param g graph
+     * @param s source vertex_t
+     * @param t target vertex_t
+     * @return the vertices of the path from s to t, empty if t is not reachable from s
+     */
+    template<typename DirectedS>
+    std::vector<std::size_t> shortest_path(GraphBase<DirectedS> &g, std::size_t s, std::size_t t)
+    {
+        detail::check_sources(g, {s, t});
+        auto out = make_csr(g);
+        auto in = g.is_directed() ? transpose(out) : out;
+        auto dist = detail::direction_optimizing_bfs(out, in, {s});
+        if (dist[t] == -1)
+            return {};
+
+        ///< walk back from t through in-neighbors one hop closer to s
+        std::vector<std::size_t> path{t};
+        for (auto v = t; v != s;) {
+            for (auto i = in.offsets[v]; i < in.offsets[v + 1]; ++i) {
+                if (dist[in.targets[i]] == dist[v] - 1) {
+                    v = in.targets[i];
+                    break;
+                }
+            }
+            path.push_back(v);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_TRAVERSAL_HPP
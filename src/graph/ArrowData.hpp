@@ -0,0 +1,702 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       ArrowData.hpp
+/// @brief      Import and export of link streams through the Arrow C data interface
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_ARROWDATA_HPP
+#define BSTREAM_ARROWDATA_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "LinkStreamBase.hpp"
+
+///**************************************************************************************************
+///
+///  ABI of the Arrow C data and stream interfaces, https://arrow.apache.org/docs/format/CDataInterface.html
+///
+///**************************************************************************************************
+
+extern "C" {
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema
+{
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+    void (*release)(struct ArrowSchema *);
+    void *private_data;
+};
+
+struct ArrowArray
+{
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+    void (*release)(struct ArrowArray *);
+    void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream
+{
+    int (*get_schema)(struct ArrowArrayStream *, struct ArrowSchema *out);
+    int (*get_next)(struct ArrowArrayStream *, struct ArrowArray *out);
+    const char *(*get_last_error)(struct ArrowArrayStream *);
+    void (*release)(struct ArrowArrayStream *);
+    void *private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
+}
+
+namespace boost::bstream
+{
+    /**
+     * @brief Names of the columns of the contacts (s, t, b, e) in an Arrow record batch.
+     */
+    struct arrow_columns
+    {
+        std::string source = "src";
+        std::string target = "dst";
+        std::string begin = "begin";
+        std::string end = "end";
+    };
+
+    namespace detail
+    {
+        ///**********************************************************************************************
+        ///
+        ///  Export
+        ///
+        ///**********************************************************************************************
+
+        /**
+         * @brief Strings and children owned by an exported ArrowSchema.
+         */
+        struct arrow_schema_data
+        {
+            std::string format, name;
+            std::vector<ArrowSchema> children;
+            std::vector<ArrowSchema *> child_pointers;
+            ArrowSchema dictionary;
+        };
+
+        inline void release_schema(ArrowSchema *schema)
+        {
+            auto data = static_cast<arrow_schema_data *>(schema->private_data);
+            ///< the consumer may have moved a child out, leaving it released
+            for (auto child : data->child_pointers)
+                if (child->release != nullptr)
+                    child->release(child);
+            if (schema->dictionary != nullptr && schema->dictionary->release != nullptr)
+                schema->dictionary->release(schema->dictionary);
+            delete data;
+            schema->release = nullptr;
+        }
+
+        inline arrow_schema_data *make_schema(ArrowSchema *schema, const std::string &format, const std::string &name,
+                                              std::size_t n_children)
+        {
+            auto data = new arrow_schema_data{format, name, std::vector<ArrowSchema>(n_children), {}, {}};
+            for (auto &child : data->children)
+                data->child_pointers.push_back(&child);
+            schema->format = data->format.c_str();
+            schema->name = data->name.c_str();
+            schema->metadata = nullptr;
+            schema->flags = 0;
+            schema->n_children = static_cast<int64_t>(n_children);
+            schema->children = n_children > 0 ? data->child_pointers.data() : nullptr;
+            schema->dictionary = nullptr;
+            schema->release = &release_schema;
+            schema->private_data = data;
+            return data;
+        }
+
+        /**
+         * @brief Buffers and children owned by an exported ArrowArray. The buffers are shared
+         * between the arrays that use them, the dictionary of the labels by both vertex columns.
+         */
+        struct arrow_array_data
+        {
+            std::vector<std::shared_ptr<const void>> owners;
+            std::vector<const void *> buffers;
+            std::vector<ArrowArray> children;
+            std::vector<ArrowArray *> child_pointers;
+            ArrowArray dictionary;
+        };
+
+        inline void release_array(ArrowArray *array)
+        {
+            auto data = static_cast<arrow_array_data *>(array->private_data);
+            for (auto child : data->child_pointers)
+                if (child->release != nullptr)
+                    child->release(child);
+            if (array->dictionary != nullptr && array->dictionary->release != nullptr)
+                array->dictionary->release(array->dictionary);
+            delete data;
+            array->release = nullptr;
+        }
+
+        /**
+         * @brief Fill array with the given buffers (nullptr for an absent validity bitmap), kept
+         * alive by owners until the array is released.
+         */
+        inline arrow_array_data *make_array(ArrowArray *array, int64_t length, std::vector<const void *> buffers,
+                                            std::vector<std::shared_ptr<const void>> owners, std::size_t n_children)
+        {
+            auto data = new arrow_array_data{std::move(owners), std::move(buffers), std::vector<ArrowArray>(n_children),
+                                             {}, {}};
+            for (auto &child : data->children)
+                data->child_pointers.push_back(&child);
+            array->length = length;
+            array->null_count = 0;
+            array->offset = 0;
+            array->n_buffers = static_cast<int64_t>(data->buffers.size());
+            array->n_children = static_cast<int64_t>(n_children);
+            array->buffers = data->buffers.data();
+            array->children = n_children > 0 ? data->child_pointers.data() : nullptr;
+            array->dictionary = nullptr;
+            array->release = &release_array;
+            array->private_data = data;
+            return data;
+        }
+
+        /**
+         * @brief Schema of the contacts, struct<src, dst, begin, end>. The vertices are the int64
+         * vertex_t, dictionary encoded by their labels unless the labels are numeric.
+         */
+        inline void export_contact_schema(ArrowSchema *schema, bool numeric, const arrow_columns &columns)
+        {
+            auto data = make_schema(schema, "+s", "", 4);
+            const std::string *names[4] = {&columns.source, &columns.target, &columns.begin, &columns.end};
+            for (std::size_t c = 0; c < 4; ++c) {
+                auto child = make_schema(data->child_pointers[c], "l", *names[c], 0);
+                if (c < 2 && !numeric) {
+                    make_schema(&child->dictionary, "U", "", 0);
+                    data->child_pointers[c]->dictionary = &child->dictionary;
+                }
+            }
+        }
+
+        ///**********************************************************************************************
+        ///
+        ///  Import
+        ///
+        ///**********************************************************************************************
+
+        /**
+         * @brief Release an imported Arrow structure when leaving the scope, also on error.
+         */
+        template<typename T>
+        struct arrow_release_guard
+        {
+            T *object;
+
+            ~arrow_release_guard()
+            {
+                if (object != nullptr && object->release != nullptr)
+                    object->release(object);
+            }
+        };
+
+        /**
+         * @brief Read access to an integer, timestamp, duration or date column of an Arrow array.
+         */
+        class arrow_integers
+        {
+        public:
+            arrow_integers(const ArrowSchema *schema, const ArrowArray *array, std::int64_t offset,
+                           std::int64_t length, const std::string &column) : offset(offset + array->offset)
+            {
+                std::string format(schema->format);
+                if (format == "c" || format == "C")
+                    width = 1;
+                else if (format == "s" || format == "S")
+                    width = 2;
+                else if (format == "i" || format == "I" || format == "tdD")
+                    width = 4;
+                else if (format == "l" || format == "L" || format == "tdm" || format.rfind("ts", 0) == 0 ||
+                         format.rfind("tD", 0) == 0)
+                    width = 8;
+                else
+                    throw LinkStreamBaseException("the column " + column + " of Arrow format " + format +
+                                                  " is not an integer column");
+                is_unsigned = format == "C" || format == "S" || format == "I" || format == "L";
+                check_nulls(array, offset, length, "the column " + column);
+                data = static_cast<const char *>(array->buffers[1]);
+            }
+
+            std::int64_t operator[](std::int64_t i) const
+            {
+                auto p = data + (offset + i) * width;
+                switch (width) {
+                    case 1:
+                        return is_unsigned ? load<std::uint8_t>(p) : load<std::int8_t>(p);
+                    case 2:
+                        return is_unsigned ? load<std::uint16_t>(p) : load<std::int16_t>(p);
+                    case 4:
+                        return is_unsigned ? load<std::uint32_t>(p) : load<std::int32_t>(p);
+                    default:
+                        auto value = load<std::int64_t>(p);
+                        if (is_unsigned && value < 0)
+                            throw LinkStreamBaseException("an Arrow uint64 value does not fit in int64");
+                        return value;
+                }
+            }
+
+            /**
+             * @brief Throw if one of the length values of the array from the position offset is null.
+             */
+            static void check_nulls(const ArrowArray *array, std::int64_t offset, std::int64_t length,
+                                    const std::string &what)
+            {
+                if (array->null_count == 0 || array->buffers[0] == nullptr)
+                    return;
+                auto bits = static_cast<const std::uint8_t *>(array->buffers[0]);
+                for (auto i = array->offset + offset; i < array->offset + offset + length; ++i)
+                    if (!(bits[i >> 3] & (1u << (i & 7))))
+                        throw LinkStreamBaseException(what + " contains null values");
+            }
+
+        private:
+            template<typename T>
+            static std::int64_t load(const char *p)
+            {
+                T value;
+                std::memcpy(&value, p, sizeof(T));
+                return static_cast<std::int64_t>(value);
+            }
+
+            std::int64_t offset;
+            const char *data = nullptr;
+            std::size_t width = 8;
+            bool is_unsigned = false;
+        };
+
+        /**
+         * @brief Read access to a utf8 ("u"), large utf8 ("U") or utf8 view ("vu") column.
+         */
+        class arrow_strings
+        {
+        public:
+            arrow_strings(const ArrowSchema *schema, const ArrowArray *array, std::int64_t offset,
+                          std::int64_t length, const std::string &column) : array(array),
+                                                                            offset(offset + array->offset),
+                                                                            format(schema->format)
+            {
+                if (format != "u" && format != "U" && format != "vu")
+                    throw LinkStreamBaseException("the column " + column + " of Arrow format " + format +
+                                                  " is not a string column");
+                arrow_integers::check_nulls(array, offset, length, "the column " + column);
+            }
+
+            static bool is_string(const ArrowSchema *schema)
+            {
+                std::string format(schema->format);
+                return format == "u" || format == "U" || format == "vu";
+            }
+
+            std::string_view operator[](std::int64_t i) const
+            {
+                i += offset;
+                if (format == "u") {
+                    auto offsets = static_cast<const std::int32_t *>(array->buffers[1]);
+                    return {static_cast<const char *>(array->buffers[2]) + offsets[i],
+                            static_cast<std::size_t>(offsets[i + 1] - offsets[i])};
+                }
+                if (format == "U") {
+                    auto offsets = static_cast<const std::int64_t *>(array->buffers[1]);
+                    return {static_cast<const char *>(array->buffers[2]) + offsets[i],
+                            static_cast<std::size_t>(offsets[i + 1] - offsets[i])};
+                }
+                ///< a view holds its length then the string itself up to 12 bytes, or a prefix, the
+                ///< index of a variadic data buffer and the position in it
+                auto view = static_cast<const char *>(array->buffers[1]) + 16 * i;
+                std::int32_t length, buffer, position;
+                std::memcpy(&length, view, 4);
+                if (length <= 12)
+                    return {view + 4, static_cast<std::size_t>(length)};
+                std::memcpy(&buffer, view + 8, 4);
+                std::memcpy(&position, view + 12, 4);
+                return {static_cast<const char *>(array->buffers[2 + buffer]) + position,
+                        static_cast<std::size_t>(length)};
+            }
+
+        private:
+            const ArrowArray *array;
+            std::int64_t offset;
+            std::string format;
+        };
+
+        /**
+         * @brief Map the values of a vertex column to vertex_t, creating the missing vertices.
+         *
+         * Strings are labels. Integers are vertex ids in numeric label mode, and otherwise labels
+         * written in decimal. Every distinct value is looked up once.
+         */
+        template<typename DirectedS>
+        class arrow_vertex_resolver
+        {
+        public:
+            typedef typename LinkStreamBase<DirectedS>::vertex_t vertex_t;
+
+            explicit arrow_vertex_resolver(LinkStreamBase<DirectedS> &g) : g(g)
+            {};
+
+            vertex_t label(std::string_view label)
+            {
+                auto it = by_label.find(label);
+                if (it != by_label.end())
+                    return it->second;
+                ///< the keys point into the Arrow buffers, alive until the end of the import
+                auto v = resolve(std::string(label));
+                by_label.emplace(label, v);
+                return v;
+            }
+
+            vertex_t integer(std::int64_t value)
+            {
+                if (g.numeric_labels()) {
+                    if (value < 0)
+                        throw LinkStreamBaseException("a vertex id cannot be negative");
+                    auto v = static_cast<vertex_t>(value);
+                    if (!g.has_vertex(v))
+                        g.add_vertex(std::to_string(value));
+                    return v;
+                }
+                auto it = by_integer.find(value);
+                if (it != by_integer.end())
+                    return it->second;
+                auto v = resolve(std::to_string(value));
+                by_integer.emplace(value, v);
+                return v;
+            }
+
+        private:
+            vertex_t resolve(const std::string &label)
+            {
+                return g.has_vertex(label) ? g.vertex(label) : g.add_vertex(label);
+            }
+
+            LinkStreamBase<DirectedS> &g;
+            std::unordered_map<std::string_view, vertex_t> by_label;
+            std::unordered_map<std::int64_t, vertex_t> by_integer;
+        };
+
+        /**
+         * @brief Vertices of the rows of a vertex column, plain or dictionary encoded.
+         */
+        template<typename DirectedS>
+        std::vector<typename LinkStreamBase<DirectedS>::vertex_t>
+        arrow_vertices(const ArrowSchema *schema, const ArrowArray *array, std::int64_t offset, std::int64_t length,
+                       arrow_vertex_resolver<DirectedS> &resolver, const std::string &column)
+        {
+            typedef typename LinkStreamBase<DirectedS>::vertex_t vertex_t;
+            std::vector<vertex_t> res(static_cast<std::size_t>(length));
+            if (schema->dictionary != nullptr) {
+                ///< the dictionary entries are resolved on first use, a dictionary may be shared by
+                ///< several columns and hold values that do not appear in this one
+                arrow_integers indices(schema, array, offset, length, column);
+                auto dictionary = array->dictionary;
+                std::vector<vertex_t> entries(static_cast<std::size_t>(dictionary->length));
+                std::vector<bool> resolved(entries.size(), false);
+                bool strings = arrow_strings::is_string(schema->dictionary);
+                for (std::int64_t i = 0; i < length; ++i) {
+                    auto k = indices[i];
+                    if (k < 0 || k >= dictionary->length)
+                        throw LinkStreamBaseException("the column " + column + " has an index out of its dictionary");
+                    if (!resolved[k]) {
+                        if (strings)
+                            entries[k] = resolver.label(arrow_strings(schema->dictionary, dictionary, k, 1, column)[0]);
+                        else
+                            entries[k] = resolver.integer(arrow_integers(schema->dictionary, dictionary, k, 1, column)[0]);
+                        resolved[k] = true;
+                    }
+                    res[i] = entries[k];
+                }
+            } else if (arrow_strings::is_string(schema)) {
+                arrow_strings labels(schema, array, offset, length, column);
+                for (std::int64_t i = 0; i < length; ++i)
+                    res[i] = resolver.label(labels[i]);
+            } else {
+                arrow_integers ids(schema, array, offset, length, column);
+                for (std::int64_t i = 0; i < length; ++i)
+                    res[i] = resolver.integer(ids[i]);
+            }
+            return res;
+        }
+
+        /**
+         * @brief Append the contacts of a record batch, a struct array with the columns named in
+         * columns, to contacts.
+         */
+        template<typename DirectedS>
+        void arrow_batch_contacts(const ArrowSchema *schema, const ArrowArray *array, const arrow_columns &columns,
+                                  arrow_vertex_resolver<DirectedS> &resolver,
+                                  std::vector<typename LinkStreamBase<DirectedS>::contact_t> &contacts)
+        {
+            if (std::string(schema->format) != "+s")
+                throw LinkStreamBaseException("an Arrow record batch must be a struct array");
+            arrow_integers::check_nulls(array, 0, array->length, "the record batch");
+            const std::string *names[4] = {&columns.source, &columns.target, &columns.begin, &columns.end};
+            std::int64_t index[4];
+            for (std::size_t c = 0; c < 4; ++c) {
+                index[c] = -1;
+                for (std::int64_t k = 0; k < schema->n_children; ++k)
+                    if (schema->children[k]->name != nullptr && *names[c] == schema->children[k]->name)
+                        index[c] = k;
+                if (index[c] < 0)
+                    throw LinkStreamBaseException("the Arrow record batch has no column " + *names[c]);
+            }
+            ///< the offset of a struct array applies to its children
+            auto offset = array->offset, length = array->length;
+            auto sources = arrow_vertices(schema->children[index[0]], array->children[index[0]], offset, length,
+                                          resolver, columns.source);
+            auto targets = arrow_vertices(schema->children[index[1]], array->children[index[1]], offset, length,
+                                          resolver, columns.target);
+            arrow_integers begins(schema->children[index[2]], array->children[index[2]], offset, length, columns.begin);
+            arrow_integers ends(schema->children[index[3]], array->children[index[3]], offset, length, columns.end);
+            contacts.reserve(contacts.size() + static_cast<std::size_t>(length));
+            for (std::int64_t i = 0; i < length; ++i) {
+                auto b = static_cast<time_t>(begins[i]), e = static_cast<time_t>(ends[i]);
+                if (b >= e)
+                    throw LinkStreamBaseException("the contact " + std::to_string(i) + " of the Arrow record "
+                                                                                       "batch ends before it begins");
+                contacts.emplace_back(sources[i], targets[i], b, e);
+            }
+        }
+
+        /**
+         * @brief Insert the imported contacts, a link stream without edges taking the time span of
+         * the contacts as definition, as read_csv does, and other link streams extending theirs.
+         */
+        template<typename DirectedS>
+        void add_arrow_contacts(LinkStreamBase<DirectedS> &g,
+                                std::vector<typename LinkStreamBase<DirectedS>::contact_t> &contacts)
+        {
+            if (contacts.empty())
+                return;
+            auto t_begin = std::numeric_limits<time_t>::max(), t_end = std::numeric_limits<time_t>::min();
+            if (g.num_edges() > 0)
+                std::tie(t_begin, t_end) = g.definition();
+            for (auto &c : contacts) {
+                t_begin = std::min(t_begin, std::get<2>(c));
+                t_end = std::max(t_end, std::get<3>(c));
+            }
+            g.set_definition(t_begin, t_end);
+            g.add_edges_w_time(contacts);
+        }
+
+        /**
+         * @brief Single-batch stream over an exported array.
+         */
+        struct arrow_stream_data
+        {
+            bool numeric;
+            arrow_columns columns;
+            ArrowArray batch;
+            std::string error;
+        };
+    } // end namespace detail
+
+    /**
+     * @brief Export the contacts of a link stream as an Arrow record batch.
+     *
+     * The batch has one row (src, dst, begin, end) per time interval of every edge, edge by edge in
+     * the order of g.edges(). The vertex columns hold the int64 vertex_t, dictionary encoded by the
+     * large utf8 labels of the vertices unless the link stream is in numeric label mode. The
+     * columns are built once and owned by the array, the consumer reading them without copy until
+     * it calls the release callbacks.
+     *
+     * @param g link stream
+     * @param schema receives the schema, released by the consumer
+     * @param array receives the record batch, released by the consumer
+     * @param columns names of the columns
+     */
+    template<typename DirectedS>
+    void export_arrow(LinkStreamBase<DirectedS> &g, ArrowSchema *schema, ArrowArray *array,
+                      const arrow_columns &columns = arrow_columns())
+    {
+        auto sources = std::make_shared<std::vector<std::int64_t>>();
+        auto targets = std::make_shared<std::vector<std::int64_t>>();
+        auto begins = std::make_shared<std::vector<std::int64_t>>();
+        auto ends = std::make_shared<std::vector<std::int64_t>>();
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto e = g.edge_endpoint(*it);
+            auto tis = g.edge_tinterval_set(*it);
+            for (auto ti = tis.begin(); ti != tis.end(); ++ti) {
+                sources->push_back(static_cast<std::int64_t>(e.first));
+                targets->push_back(static_cast<std::int64_t>(e.second));
+                begins->push_back(static_cast<std::int64_t>(ti->lower()));
+                ends->push_back(static_cast<std::int64_t>(ti->upper()));
+            }
+        }
+        auto length = static_cast<int64_t>(sources->size());
+
+        ///< the labels in the order of the vertices, shared by the dictionaries of the two columns
+        std::shared_ptr<std::vector<std::int64_t>> label_offsets;
+        std::shared_ptr<std::string> label_data;
+        auto n = static_cast<std::size_t>(g.num_vertices());
+        if (!g.numeric_labels()) {
+            label_offsets = std::make_shared<std::vector<std::int64_t>>(1, 0);
+            label_data = std::make_shared<std::string>();
+            for (std::size_t v = 0; v < n; ++v) {
+                label_data->append(g.label(v));
+                label_offsets->push_back(static_cast<std::int64_t>(label_data->size()));
+            }
+        }
+
+        detail::export_contact_schema(schema, g.numeric_labels(), columns);
+        auto data = detail::make_array(array, length, {nullptr}, {}, 4);
+        std::shared_ptr<std::vector<std::int64_t>> values[4] = {sources, targets, begins, ends};
+        for (std::size_t c = 0; c < 4; ++c) {
+            auto child = detail::make_array(data->child_pointers[c], length, {nullptr, values[c]->data()},
+                                            {values[c]}, 0);
+            if (c < 2 && label_offsets) {
+                detail::make_array(&child->dictionary, static_cast<int64_t>(n),
+                                   {nullptr, label_offsets->data(), label_data->data()}, {label_offsets, label_data},
+                                   0);
+                data->child_pointers[c]->dictionary = &child->dictionary;
+            }
+        }
+    }
+
+    /**
+     * @brief Export the contacts of a link stream as an Arrow stream of a single record batch,
+     * laid out as by export_arrow.
+     */
+    template<typename DirectedS>
+    void export_arrow(LinkStreamBase<DirectedS> &g, ArrowArrayStream *stream,
+                      const arrow_columns &columns = arrow_columns())
+    {
+        auto data = new detail::arrow_stream_data{g.numeric_labels(), columns, {}, {}};
+        ArrowSchema schema;
+        export_arrow(g, &schema, &data->batch, columns);
+        schema.release(&schema);
+        stream->get_schema = [](ArrowArrayStream *self, ArrowSchema *out) {
+            auto data = static_cast<detail::arrow_stream_data *>(self->private_data);
+            detail::export_contact_schema(out, data->numeric, data->columns);
+            return 0;
+        };
+        stream->get_next = [](ArrowArrayStream *self, ArrowArray *out) {
+            ///< the batch is moved out on the first call, a released array marks the end
+            auto data = static_cast<detail::arrow_stream_data *>(self->private_data);
+            *out = data->batch;
+            data->batch.release = nullptr;
+            return 0;
+        };
+        stream->get_last_error = [](ArrowArrayStream *self) {
+            return static_cast<detail::arrow_stream_data *>(self->private_data)->error.c_str();
+        };
+        stream->release = [](ArrowArrayStream *self) {
+            auto data = static_cast<detail::arrow_stream_data *>(self->private_data);
+            if (data->batch.release != nullptr)
+                data->batch.release(&data->batch);
+            delete data;
+            self->release = nullptr;
+        };
+        stream->private_data = data;
+    }
+
+    /**
+     * @brief Add the contacts of an Arrow record batch to a link stream.
+     *
+     * The batch is a struct array with the columns source, target, begin and end, in any order
+     * among other columns. The vertex columns hold utf8, large utf8 or utf8 view labels, or
+     * integers, dictionary encoded or not. Integers are vertex ids in numeric label mode and labels
+     * otherwise, the missing vertices are created. The time columns hold integers, timestamps,
+     * durations or dates, read in their own unit. A link stream without edges takes the time span
+     * of the contacts as definition, the definition of the others is extended to them. The
+     * function takes the ownership of schema and array and releases them.
+     *
+     * @param g link stream
+     * @param schema schema of the record batch
+     * @param array record batch
+     * @param columns names of the columns
+     */
+    template<typename DirectedS>
+    void import_arrow(LinkStreamBase<DirectedS> &g, ArrowSchema *schema, ArrowArray *array,
+                      const arrow_columns &columns = arrow_columns())
+    {
+        detail::arrow_release_guard<ArrowSchema> schema_guard{schema};
+        detail::arrow_release_guard<ArrowArray> array_guard{array};
+        std::vector<typename LinkStreamBase<DirectedS>::contact_t> contacts;
+        detail::arrow_vertex_resolver<DirectedS> resolver(g);
+        detail::arrow_batch_contacts(schema, array, columns, resolver, contacts);
+        detail::add_arrow_contacts(g, contacts);
+    }
+
+    /**
+     * @brief Add the contacts of all the record batches of an Arrow stream to a link stream, as
+     * import_arrow does for one batch. The contacts are inserted at once after the last batch.
+     * The function takes the ownership of the stream and releases it.
+     */
+    template<typename DirectedS>
+    void import_arrow(LinkStreamBase<DirectedS> &g, ArrowArrayStream *stream,
+                      const arrow_columns &columns = arrow_columns())
+    {
+        detail::arrow_release_guard<ArrowArrayStream> stream_guard{stream};
+        ArrowSchema schema;
+        if (stream->get_schema(stream, &schema) != 0)
+            throw LinkStreamBaseException(std::string("Arrow stream error: ") + stream->get_last_error(stream));
+        detail::arrow_release_guard<ArrowSchema> schema_guard{&schema};
+        std::vector<typename LinkStreamBase<DirectedS>::contact_t> contacts;
+        detail::arrow_vertex_resolver<DirectedS> resolver(g);
+        ///< the batches are kept until the end, the labels resolved so far point into them
+        std::vector<std::unique_ptr<ArrowArray, void (*)(ArrowArray *)>> batches;
+        while (true) {
+            std::unique_ptr<ArrowArray, void (*)(ArrowArray *)> batch(new ArrowArray(), [](ArrowArray *a) {
+                if (a->release != nullptr)
+                    a->release(a);
+                delete a;
+            });
+            batch->release = nullptr;
+            if (stream->get_next(stream, batch.get()) != 0)
+                throw LinkStreamBaseException(std::string("Arrow stream error: ") + stream->get_last_error(stream));
+            if (batch->release == nullptr)
+                break;
+            detail::arrow_batch_contacts(&schema, batch.get(), columns, resolver, contacts);
+            batches.push_back(std::move(batch));
+        }
+        detail::add_arrow_contacts(g, contacts);
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_ARROWDATA_HPP
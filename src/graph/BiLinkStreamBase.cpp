@@ -17,23 +17,37 @@ namespace boost::bstream
     template<typename DirectedS>
     int BiLinkStreamBase<DirectedS>::num_top_vertices()
     {
-        int num = 0;
-        for (auto it = this->vertices().first; it != this->vertices().second; ++it) {
-            if (this->group(*it) == GraphBase<DirectedS>::bipartite::top)
-                num++;
-        }
-        return num;
+        return static_cast<int>(partition.size(vertex_group::top));
     }
 
     template<typename DirectedS>
     int BiLinkStreamBase<DirectedS>::num_bottom_vertices()
     {
-        int num = 0;
-        for (auto it = this->vertices().first; it != this->vertices().second; ++it) {
-            if (this->group(*it) == GraphBase<DirectedS>::bipartite::bottom)
-                num++;
-        }
-        return num;
+        return static_cast<int>(partition.size(vertex_group::bottom));
+    }
+
+    template<typename DirectedS>
+    void BiLinkStreamBase<DirectedS>::clear()
+    {
+        LinkStreamBase<DirectedS>::clear();
+        partition.clear();
+    }
+
+    template<typename DirectedS>
+    void BiLinkStreamBase<DirectedS>::copy_graph(const GraphBase<DirectedS> &g)
+    {
+        LinkStreamBase<DirectedS>::copy_graph(g);
+        partition.rebuild(*this);
+    }
+
+    template<typename DirectedS>
+    void BiLinkStreamBase<DirectedS>::assign_edges(std::size_t n,
+                                     const std::vector<std::pair<typename GraphBase<DirectedS>::vertex_t,
+                                             typename GraphBase<DirectedS>::vertex_t>> &edges,
+                                     bool labels)
+    {
+        GraphBase<DirectedS>::assign_edges(n, edges, labels);
+        partition.rebuild(*this);
     }
 
     template<typename DirectedS>
@@ -43,11 +57,11 @@ namespace boost::bstream
         os << *this << std::endl;
         auto e_iterator = this->edges();
         for(auto it=e_iterator.first; it != e_iterator.second; ++it){
-            auto s = boost::source(*it, this->G);
-            auto t = boost::target(*it, this->G);
+            auto s = boost::source(*it, this->graph());
+            auto t = boost::target(*it, this->graph());
             auto s_name = this->label(s);
             auto t_name = this->label(t);
-            os << "\t" << this->TimeIntervalSetVertexMap[*it] << " x "
+            os << "\t" << this->intervals(*it) << " x "
                  << "(" << s << "," << t << ")" ;
             if(!s_name.empty() && !t_name.empty())
                 os << " with name (" << s_name << "," << t_name << ")" ;
@@ -98,6 +112,21 @@ namespace boost::bstream
         return LinkStreamBase<DirectedS>::add_edge_w_time(s, t, b, e);
     }
 
+    template<typename DirectedS>
+    void BiLinkStreamBase<DirectedS>::add_edges_w_time(std::vector<typename LinkStreamBase<DirectedS>::contact_t> &contacts)
+    {
+        for (auto &c : contacts) {
+            auto s = std::get<0>(c), t = std::get<1>(c);
+            if (!this->has_vertex(s) || !this->has_vertex(t))
+                throw BiLinkStreamBaseException("Missing vertex");
+            if (this->group(s) == this->group(t) or this->group(s) == 0 or this->group(t) == 0) {
+                std::string msg = "Vertices (" + this->label(s) + " and " + this->label(t) + ") belong to the same group";
+                throw BiLinkStreamBaseException(msg);
+            }
+        }
+        LinkStreamBase<DirectedS>::add_edges_w_time(contacts);
+    }
+
     ///**************************************************************************************************
     ///
     ///  Vertex methods
@@ -109,28 +138,29 @@ namespace boost::bstream
     BiLinkStreamBase<DirectedS>::add_vertex_w_group(int group, const std::string &label)
     {
         auto v = this->add_vertex(label);
-        this->G[v].group = group;
+        this->mutable_graph()[v].group = group;
+        partition.add(v, group);
         return v;
     }
 
     template<typename DirectedS>
     int BiLinkStreamBase<DirectedS>::group(const typename GraphBase<DirectedS>::vertex_t &v)
     {
-        return this->G[v].group;
+        return this->graph()[v].group;
     }
 
     template<typename DirectedS>
     int BiLinkStreamBase<DirectedS>::group(const std::string &v)
     {
-        return this->G[this->vertex(v)].group;
+        return this->graph()[this->vertex(v)].group;
     }
 
     template<typename DirectedS>
     void BiLinkStreamBase<DirectedS>::clear_vertex_w_group(vertex_group group)
     {
-        auto labels = this->labels();
-        for (auto it = labels.begin(); it != labels.end(); ++it) {
-            auto v = this->vertex(*it);
+        // removing a vertex only renumbers the vertices that follow it
+        for (auto n = this->num_vertices(); n > 0; --n) {
+            typename GraphBase<DirectedS>::vertex_t v = n - 1;
             if (this->group(v) == vertex_group::null)
                 throw BiLinkStreamBaseException("Malformed Bipartie Graph");
             if (this->group(v) == group) {
@@ -139,32 +169,55 @@ namespace boost::bstream
         }
     }
 
+    template<typename DirectedS>
+    void BiLinkStreamBase<DirectedS>::remove_vertex(const std::string &v)
+    {
+        LinkStreamBase<DirectedS>::remove_vertex(v);
+        partition.rebuild(*this);
+    }
+
+    template<typename DirectedS>
+    const std::vector<typename GraphBase<DirectedS>::vertex_t> &
+    BiLinkStreamBase<DirectedS>::group_vertices(int group)
+    {
+        if (group != vertex_group::top && group != vertex_group::bottom)
+            throw BiLinkStreamBaseException("Unkown group");
+        return partition.members(group);
+    }
+
+    template<typename DirectedS>
+    std::size_t BiLinkStreamBase<DirectedS>::group_id(const typename GraphBase<DirectedS>::vertex_t &v)
+    {
+        auto id = partition.local(v);
+        if (id == GroupIndex::npos)
+            throw BiLinkStreamBaseException("the vertex " + std::to_string(v) + " doesn't belong to any group");
+        return id;
+    }
+
     template<typename DirectedS>
     std::map<time_t, int> BiLinkStreamBase<DirectedS>::instantaneous_group_degree(vertex_group group)
     {
         std::map<time_t, int> inst_degree ;
         std::map<time_t, int> cum_inst_degree ;
 
-        for(auto v = this->vertices().first; v != this->vertices().second; ++v) {
-            if(this->group(*v) == group) {
-                for (auto it = this->neighbors(*v).first; it != this->neighbors(*v).second; ++it) {
-                    auto e = this->edge(*v, *it);
-                    for (auto ti = this->TimeIntervalSetVertexMap[e.first].begin();
-                        ti != this->TimeIntervalSetVertexMap[e.first].end(); ++ti) {
-                        auto map_it_lower = inst_degree.find((*ti).lower());
-
-                        if (map_it_lower != inst_degree.end()) {
-                            ++inst_degree[(*ti).lower()];
-                        } else {
-                            inst_degree.insert(std::make_pair((*ti).lower(), +1));
-                        }
-
-                        auto map_it_upper = inst_degree.find((*ti).upper());
-                        if (map_it_upper != inst_degree.end()) {
-                            --inst_degree[(*ti).upper()];
-                        } else {
-                            inst_degree.insert(std::make_pair((*ti).upper(), -1));
-                        }
+        for(auto v = partition.members(group).begin(); v != partition.members(group).end(); ++v) {
+            for (auto it = this->neighbors(*v).first; it != this->neighbors(*v).second; ++it) {
+                auto e = this->edge(*v, *it);
+                auto edge_tis = this->intervals(e.first);
+                for (auto ti = edge_tis.begin(); ti != edge_tis.end(); ++ti) {
+                    auto map_it_lower = inst_degree.find((*ti).lower());
+
+                    if (map_it_lower != inst_degree.end()) {
+                        ++inst_degree[(*ti).lower()];
+                    } else {
+                        inst_degree.insert(std::make_pair((*ti).lower(), +1));
+                    }
+
+                    auto map_it_upper = inst_degree.find((*ti).upper());
+                    if (map_it_upper != inst_degree.end()) {
+                        --inst_degree[(*ti).upper()];
+                    } else {
+                        inst_degree.insert(std::make_pair((*ti).upper(), -1));
                     }
                 }
             }
@@ -17,6 +17,7 @@
 
 #include "GraphBase.hpp"
 #include "LinkStreamBase.hpp"
+#include "GroupIndex.hpp"
 #include "TimeIntervalSet.hpp"
 
 namespace boost::bstream
@@ -65,6 +66,15 @@ namespace boost::bstream
 
         std::string print_edges();
 
+        virtual void clear();
+
+        virtual void copy_graph(const GraphBase<DirectedS> &g);
+
+        virtual void assign_edges(std::size_t n,
+                                  const std::vector<std::pair<typename GraphBase<DirectedS>::vertex_t,
+                                          typename GraphBase<DirectedS>::vertex_t>> &edges,
+                                  bool labels = true);
+
         ///**************************************************************************************************
         ///
         ///  Vertex methods
@@ -81,6 +91,22 @@ namespace boost::bstream
 
         virtual void clear_vertex_w_group(vertex_group group);
 
+        void remove_vertex(const std::string &v);
+
+        /**
+         * @brief Vertices of a group, indexed by their group id.
+         * @param group vertex_group::top or vertex_group::bottom
+         * @return vector of vertex_t
+         */
+        const std::vector<typename GraphBase<DirectedS>::vertex_t> &group_vertices(int group);
+
+        /**
+         * @brief Dense index of a vertex within its group (top id or bottom id).
+         * @param v vertex_t
+         * @return group id between 0 and the size of the group
+         */
+        std::size_t group_id(const typename GraphBase<DirectedS>::vertex_t &v);
+
         ///**************************************************************************************************
         ///
         ///  Edge methods
@@ -97,12 +123,17 @@ namespace boost::bstream
                 const std::string &t,
                 time_t b, time_t e);
 
+        void add_edges_w_time(std::vector<typename LinkStreamBase<DirectedS>::contact_t> &contacts);
+
         friend std::ostream &operator<<(std::ostream &out, BiLinkStreamBase &l)
         {
             out << "BiLinkStream(|V|=" << l.num_vertices() << ", |E|=" << l.num_edges()
                 << ", T=" << l.interval_def << ")";
             return out;
         }
+
+    protected:
+        GroupIndex partition; ///< top id / bottom id <-> vertex_t
     };
 } // end namespace boost::bstream
 
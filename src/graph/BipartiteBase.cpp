@@ -24,23 +24,13 @@ namespace boost::bstream
     template<typename DirectedS>
     int BipartiteBase<DirectedS>::num_top_vertices()
     {
-        int num = 0;
-        for (auto it = this->vertices().first; it != this->vertices().second; ++it) {
-            if (this->group(*it) == GraphBase<DirectedS>::bipartite::top)
-                num++;
-        }
-        return num;
+        return static_cast<int>(partition.size(vertex_group::top));
     }
 
     template<typename DirectedS>
     int BipartiteBase<DirectedS>::num_bottom_vertices()
     {
-        int num = 0;
-        for (auto it = this->vertices().first; it != this->vertices().second; ++it) {
-            if (this->group(*it) == GraphBase<DirectedS>::bipartite::bottom)
-                num++;
-        }
-        return num;
+        return static_cast<int>(partition.size(vertex_group::bottom));
     }
 
     template<typename DirectedS>
@@ -53,23 +43,38 @@ namespace boost::bstream
     MatrixXd BipartiteBase<DirectedS>::adjacency()
     {
         MatrixXd m = Eigen::MatrixXd::Zero(this->num_top_vertices(), this->num_bottom_vertices());
-        int t = 0, b = 0;
-        for (auto i = this->vertices().first; i != this->vertices().second; ++i) {
-            if (this->group(*i) == GraphBase<DirectedS>::bipartite::top) {
-                b = 0;
-                for (auto j = this->vertices().first; j != this->vertices().second; ++j) {
-                    if (this->group(*j) == GraphBase<DirectedS>::bipartite::bottom) {
-                        if (this->has_edge(*i, *j))
-                            m(t, b) = 1;
-                        b++;
-                    }
-                }
-                t++;
-            }
+        auto &top = partition.members(vertex_group::top);
+        for (std::size_t t = 0; t < top.size(); ++t) {
+            for (auto j = this->neighbors(top[t]).first; j != this->neighbors(top[t]).second; ++j)
+                m(t, partition.local(*j)) = 1;
         }
         return m;
     }
 
+    template<typename DirectedS>
+    void BipartiteBase<DirectedS>::clear()
+    {
+        GraphBase<DirectedS>::clear();
+        partition.clear();
+    }
+
+    template<typename DirectedS>
+    void BipartiteBase<DirectedS>::copy_graph(const GraphBase<DirectedS> &g)
+    {
+        GraphBase<DirectedS>::copy_graph(g);
+        partition.rebuild(*this);
+    }
+
+    template<typename DirectedS>
+    void BipartiteBase<DirectedS>::assign_edges(std::size_t n,
+                                     const std::vector<std::pair<typename GraphBase<DirectedS>::vertex_t,
+                                             typename GraphBase<DirectedS>::vertex_t>> &edges,
+                                     bool labels)
+    {
+        GraphBase<DirectedS>::assign_edges(n, edges, labels);
+        partition.rebuild(*this);
+    }
+
     ///**************************************************************************************************
     ///
     ///  Vertex method
@@ -81,28 +86,29 @@ namespace boost::bstream
     BipartiteBase<DirectedS>::add_vertex_w_group(int group, const std::string &label)
     {
         auto v = GraphBase<DirectedS>::add_vertex(label);
-        this->G[v].group = group;
+        this->mutable_graph()[v].group = group;
+        partition.add(v, group);
         return v;
     }
 
     template<typename DirectedS>
     int BipartiteBase<DirectedS>::group(const typename GraphBase<DirectedS>::vertex_t &v)
     {
-        return this->G[v].group;
+        return this->graph()[v].group;
     }
 
     template<typename DirectedS>
     int BipartiteBase<DirectedS>::group(const std::string &v)
     {
-        return this->G[this->vertex(v)].group;
+        return this->graph()[this->vertex(v)].group;
     }
 
     template<typename DirectedS>
     void BipartiteBase<DirectedS>::clear_vertex_w_group(vertex_group group)
     {
-        auto labels = this->labels();
-        for (auto it = labels.begin(); it != labels.end(); ++it) {
-            auto v = this->vertex(*it);
+        // removing a vertex only renumbers the vertices that follow it
+        for (auto n = this->num_vertices(); n > 0; --n) {
+            typename GraphBase<DirectedS>::vertex_t v = n - 1;
             if (this->group(v) == vertex_group::null)
                 throw BipartiteBaseException("Malformed Bipartie Graph");
             if (this->group(v) == group) {
@@ -111,6 +117,38 @@ namespace boost::bstream
         }
     }
 
+    template<typename DirectedS>
+    void BipartiteBase<DirectedS>::remove_vertex(const typename GraphBase<DirectedS>::vertex_t &v)
+    {
+        GraphBase<DirectedS>::remove_vertex(v);
+        partition.rebuild(*this);
+    }
+
+    template<typename DirectedS>
+    void BipartiteBase<DirectedS>::remove_vertex(const std::string &label)
+    {
+        GraphBase<DirectedS>::remove_vertex(label);
+        partition.rebuild(*this);
+    }
+
+    template<typename DirectedS>
+    const std::vector<typename GraphBase<DirectedS>::vertex_t> &
+    BipartiteBase<DirectedS>::group_vertices(int group)
+    {
+        if (group != vertex_group::top && group != vertex_group::bottom)
+            throw BipartiteBaseException("Unkown group");
+        return partition.members(group);
+    }
+
+    template<typename DirectedS>
+    std::size_t BipartiteBase<DirectedS>::group_id(const typename GraphBase<DirectedS>::vertex_t &v)
+    {
+        auto id = partition.local(v);
+        if (id == GroupIndex::npos)
+            throw BipartiteBaseException("the vertex " + std::to_string(v) + " doesn't belong to any group");
+        return id;
+    }
+
     ///**************************************************************************************************
     ///
     ///  Edge method
@@ -17,6 +17,7 @@
 #include <Eigen/Core>
 
 #include "GraphBase.hpp"
+#include "GroupIndex.hpp"
 
 namespace boost::bstream
 {
@@ -57,6 +58,15 @@ namespace boost::bstream
 
         virtual double density();
 
+        virtual void clear();
+
+        virtual void copy_graph(const GraphBase<DirectedS> &g);
+
+        virtual void assign_edges(std::size_t n,
+                                  const std::vector<std::pair<typename GraphBase<DirectedS>::vertex_t,
+                                          typename GraphBase<DirectedS>::vertex_t>> &edges,
+                                  bool labels = true);
+
         ///**************************************************************************************************
         ///
         ///  Vertex method
@@ -72,6 +82,24 @@ namespace boost::bstream
 
         virtual void clear_vertex_w_group(vertex_group group);
 
+        virtual void remove_vertex(const typename GraphBase<DirectedS>::vertex_t &v);
+
+        virtual void remove_vertex(const std::string &label);
+
+        /**
+         * @brief Vertices of a group, indexed by their group id.
+         * @param group vertex_group::top or vertex_group::bottom
+         * @return vector of vertex_t
+         */
+        const std::vector<typename GraphBase<DirectedS>::vertex_t> &group_vertices(int group);
+
+        /**
+         * @brief Dense index of a vertex within its group (top id or bottom id).
+         * @param v vertex_t
+         * @return group id between 0 and the size of the group
+         */
+        std::size_t group_id(const typename GraphBase<DirectedS>::vertex_t &v);
+
         ///**************************************************************************************************
         ///
         ///  Edge method
@@ -93,6 +121,8 @@ namespace boost::bstream
             return out;
         }
 
+    protected:
+        GroupIndex partition; ///< top id / bottom id <-> vertex_t
 
     };
 } // end namespace boost::bstream
@@ -0,0 +1,161 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       CSR.hpp
+/// @brief      Compressed sparse row view of a graph used by the algorithms
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_CSR_HPP
+#define BSTREAM_CSR_HPP
+
+#include <vector>
+
+#include "GraphBase.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @brief Read-only compressed sparse row copy of the adjacency of a graph.
+     *
+     * The neighbors of the vertex v are targets[offsets[v]] ... targets[offsets[v+1] - 1].
+     * edge_ids[i] is the rank of the edge behind targets[i] in the order of g.edges(), so that
+     * per-edge data (time intervals, weights) can be stored in a plain vector.
+     */
+    struct CSRGraph
+    {
+        std::size_t num_vertices = 0;
+        std::size_t num_edges = 0;
+        std::vector<std::size_t> offsets;
+        std::vector<std::size_t> targets;
+        std::vector<std::size_t> edge_ids;
+
+        std::size_t degree(std::size_t v) const
+        {
+            return offsets[v + 1] - offsets[v];
+        };
+    };
+
+    /**
+     * @brief Build the CSR view of a graph.
+     *
+     * An undirected edge appears in the adjacency of both end points, a self loop only once. For
+     * directed graphs only the out-edges are stored unless symmetrize is true, in which case every
+     * edge is also stored in the adjacency of its target.
+     *
+     * @param g graph
+     * @param symmetrize store the directed edges in both directions
+     * @return the CSR view, vertices are indexed by their vertex_t
+     */
+    template<typename DirectedS>
+    CSRGraph make_csr(GraphBase<DirectedS> &g, bool symmetrize = false)
+    {
+        CSRGraph csr;
+        csr.num_vertices = static_cast<std::size_t>(g.num_vertices());
+        bool both = !g.is_directed() || symmetrize;
+
+        std::vector<std::pair<std::size_t, std::size_t>> endpoints;
+        endpoints.reserve(static_cast<std::size_t>(g.num_edges()));
+        csr.offsets.assign(csr.num_vertices + 1, 0);
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto e = g.edge_endpoint(*it);
+            endpoints.emplace_back(e.first, e.second);
+            ++csr.offsets[e.first + 1];
+            if (both && e.first != e.second)
+                ++csr.offsets[e.second + 1];
+        }
+        csr.num_edges = endpoints.size();
+        for (std::size_t v = 0; v < csr.num_vertices; ++v)
+            csr.offsets[v + 1] += csr.offsets[v];
+
+        csr.targets.resize(csr.offsets[csr.num_vertices]);
+        csr.edge_ids.resize(csr.offsets[csr.num_vertices]);
+        std::vector<std::size_t> position(csr.offsets.begin(), csr.offsets.end() - 1);
+        for (std::size_t id = 0; id < endpoints.size(); ++id) {
+            auto s = endpoints[id].first, t = endpoints[id].second;
+            auto p = position[s]++;
+            csr.targets[p] = t;
+            csr.edge_ids[p] = id;
+            if (both && s != t) {
+                p = position[t]++;
+                csr.targets[p] = s;
+                csr.edge_ids[p] = id;
+            }
+        }
+        return csr;
+    }
+
+    /**
+     * @brief Build the top x bottom biadjacency of a bipartite graph in CSR form.
+     *
+     * The rows are the top ids and the targets the bottom ids of g (see group_id), so that
+     * num_vertices is the number of top vertices. edge_ids follows the order of g.edges() as in
+     * make_csr.
+     *
+     * @param g Bipartite or BiLinkStream
+     * @return the CSR biadjacency
+     */
+    template<typename Bip>
+    CSRGraph make_biadjacency(Bip &g)
+    {
+        CSRGraph csr;
+        csr.num_vertices = g.group_vertices(vertex_group::top).size();
+
+        std::vector<std::pair<std::size_t, std::size_t>> endpoints;
+        endpoints.reserve(static_cast<std::size_t>(g.num_edges()));
+        csr.offsets.assign(csr.num_vertices + 1, 0);
+        for (auto it = g.edges().first; it != g.edges().second; ++it) {
+            auto e = g.edge_endpoint(*it);
+            if (g.group(e.first) != vertex_group::top)
+                std::swap(e.first, e.second);
+            endpoints.emplace_back(g.group_id(e.first), g.group_id(e.second));
+            ++csr.offsets[endpoints.back().first + 1];
+        }
+        csr.num_edges = endpoints.size();
+        for (std::size_t v = 0; v < csr.num_vertices; ++v)
+            csr.offsets[v + 1] += csr.offsets[v];
+
+        csr.targets.resize(csr.num_edges);
+        csr.edge_ids.resize(csr.num_edges);
+        std::vector<std::size_t> position(csr.offsets.begin(), csr.offsets.end() - 1);
+        for (std::size_t id = 0; id < endpoints.size(); ++id) {
+            auto p = position[endpoints[id].first]++;
+            csr.targets[p] = endpoints[id].second;
+            csr.edge_ids[p] = id;
+        }
+        return csr;
+    }
+
+    /**
+     * @brief Reverse all the edges of a CSR view, the neighbors of v become its in-neighbors.
+     */
+    inline CSRGraph transpose(const CSRGraph &csr)
+    {
+        CSRGraph t;
+        t.num_vertices = csr.num_vertices;
+        t.num_edges = csr.num_edges;
+        t.offsets.assign(csr.num_vertices + 1, 0);
+        for (auto v : csr.targets)
+            ++t.offsets[v + 1];
+        for (std::size_t v = 0; v < csr.num_vertices; ++v)
+            t.offsets[v + 1] += t.offsets[v];
+
+        t.targets.resize(csr.targets.size());
+        t.edge_ids.resize(csr.edge_ids.size());
+        std::vector<std::size_t> position(t.offsets.begin(), t.offsets.end() - 1);
+        for (std::size_t v = 0; v < csr.num_vertices; ++v) {
+            for (auto i = csr.offsets[v]; i < csr.offsets[v + 1]; ++i) {
+                auto p = position[csr.targets[i]]++;
+                t.targets[p] = v;
+                t.edge_ids[p] = csr.edge_ids[i];
+            }
+        }
+        return t;
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_CSR_HPP
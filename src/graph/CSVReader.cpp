@@ -1,10 +1,19 @@
 //
 // Created by Vincent Gauthier on 07/04/2018.
 //
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <ctime>
 #include <limits>
+#include <mutex>
+#include <thread>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/lzma.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
 
 #include "CSVReader.hpp"
 #include "utils.hpp"
@@ -12,30 +21,186 @@
 
 namespace boost::bstream
 {
+    namespace
+    {
+        const std::size_t chunk_size = 1 << 20; ///< bytes handed to the parser at once
+        const std::size_t queue_capacity = 4;   ///< chunks read ahead of the parser
+
+        enum class compression
+        {
+            none, gzip, xz, zstd
+        };
+
+        /**
+         * @brief Compression format of a file, from its magic number.
+         */
+        compression detect_compression(std::ifstream &file)
+        {
+            unsigned char magic[6] = {0, 0, 0, 0, 0, 0};
+            file.read(reinterpret_cast<char *>(magic), sizeof(magic));
+            file.clear();
+            file.seekg(0);
+            if (magic[0] == 0x1f && magic[1] == 0x8b)
+                return compression::gzip;
+            if (magic[0] == 0xfd && magic[1] == '7' && magic[2] == 'z' && magic[3] == 'X' && magic[4] == 'Z' &&
+                magic[5] == 0)
+                return compression::xz;
+            if (magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd)
+                return compression::zstd;
+            return compression::none;
+        }
+
+        /**
+         * @brief Bounded queue of chunks between the reading thread and the parser.
+         */
+        class chunk_queue
+        {
+        public:
+            /**
+             * @brief Wait for a free slot, false if the parser gave up.
+             */
+            bool push(std::string &&chunk)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                not_full.wait(lock, [this] { return chunks.size() < queue_capacity || closed; });
+                if (closed)
+                    return false;
+                chunks.push_back(std::move(chunk));
+                not_empty.notify_one();
+                return true;
+            }
+
+            /**
+             * @brief Wait for the next chunk, false once the file is read entirely.
+             */
+            bool pop(std::string &chunk)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                not_empty.wait(lock, [this] { return !chunks.empty() || finished; });
+                if (chunks.empty())
+                    return false;
+                chunk = std::move(chunks.front());
+                chunks.pop_front();
+                not_full.notify_one();
+                return true;
+            }
+
+            /**
+             * @brief End of the file, with the error raised by the reading thread if any.
+             */
+            void finish(const std::string &what = "")
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished = true;
+                error = what;
+                not_empty.notify_one();
+            }
+
+            void close()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                closed = true;
+                not_full.notify_one();
+            }
+
+            std::string error;
+
+        private:
+            std::mutex mutex;
+            std::condition_variable not_full, not_empty;
+            std::deque<std::string> chunks;
+            bool finished = false, closed = false;
+        };
+
+        void read_chunks(std::ifstream file, compression format, chunk_queue &queue)
+        {
+            try {
+                boost::iostreams::filtering_istream in;
+                if (format == compression::gzip)
+                    in.push(boost::iostreams::gzip_decompressor());
+                else if (format == compression::xz)
+                    in.push(boost::iostreams::lzma_decompressor());
+                else if (format == compression::zstd)
+                    in.push(boost::iostreams::zstd_decompressor());
+                in.push(file);
+                ///< the errors of the decompressors are rethrown instead of only setting badbit
+                in.exceptions(std::ios_base::badbit);
+                while (in) {
+                    std::string chunk(chunk_size, '\0');
+                    in.read(&chunk[0], static_cast<std::streamsize>(chunk.size()));
+                    chunk.resize(static_cast<std::size_t>(in.gcount()));
+                    if (!chunk.empty() && !queue.push(std::move(chunk)))
+                        break;
+                }
+                queue.finish();
+            } catch (const std::exception &e) {
+                queue.finish(e.what());
+            }
+        }
+    }
+
     std::vector<std::vector<std::string>>
     CSVReader::read(const std::string &path)
     {
-        std::string line;
-        std::ifstream file(path, std::ios::in);
         std::vector<std::vector<std::string>> nodeIds;
+        this->read(path, [&nodeIds](const std::vector<std::string_view> &tokens) {
+            nodeIds.emplace_back(tokens.begin(), tokens.end());
+        });
+        return nodeIds;
+    }
+
+    void
+    CSVReader::read(const std::string &path, const row_callback &row)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
 
         if (file.fail())
             throw CSVReaderException("Could not open file");
 
-        while(!file.eof()) {
-            getline(file, line);
-            if (!line.empty()) {
-                if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) != 0){
-                    auto tokens = split(line, this->delimiter);
-                    if (tokens.size() >= 2) {
-                        nodeIds.push_back(tokens);
-                    }else{
-                        throw CSVReaderException("Corrupted CVS file");
+        std::vector<std::string_view> tokens;
+        auto parse = [&](const char *first, const char *last) {
+            if (first == last)
+                return;
+            std::string_view line(first, static_cast<std::size_t>(last - first));
+            if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) != 0) {
+                split(line, this->delimiter, tokens);
+                if (tokens.size() >= 2) {
+                    row(tokens);
+                } else {
+                    throw CSVReaderException("Corrupted CVS file");
+                }
+            }
+        };
+
+        auto format = detect_compression(file);
+        chunk_queue queue;
+        std::thread reader(read_chunks, std::move(file), format, std::ref(queue));
+        try {
+            ///< a line may span two chunks, its beginning is kept in pending
+            std::string chunk, pending;
+            while (queue.pop(chunk)) {
+                const char *begin = chunk.data(), *end = chunk.data() + chunk.size();
+                for (auto it = std::find(begin, end, '\n'); it != end; it = std::find(begin, end, '\n')) {
+                    if (pending.empty()) {
+                        parse(begin, it);
+                    } else {
+                        pending.append(begin, it);
+                        parse(pending.data(), pending.data() + pending.size());
+                        pending.clear();
                     }
+                    begin = it + 1;
                 }
+                pending.append(begin, end);
             }
+            if (queue.error.empty())
+                parse(pending.data(), pending.data() + pending.size());
+        } catch (...) {
+            queue.close();
+            reader.join();
+            throw;
         }
-        return nodeIds;
+        reader.join();
+        if (!queue.error.empty())
+            throw CSVReaderException("Could not decompress file: " + queue.error);
     }
 }
-
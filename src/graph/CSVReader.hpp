@@ -13,7 +13,9 @@
 #ifndef BSTREAM_TSVREADER_HPP
 #define BSTREAM_TSVREADER_HPP
 
+#include <functional>
 #include <string>
+#include <string_view>
 #include <map>
 #include <stdexcept>
 #include <boost/graph/detail/edge.hpp>
@@ -38,6 +40,8 @@ namespace boost::bstream
         std::string commentPrefix;
         char delimiter;
     public:
+        typedef std::function<void(const std::vector<std::string_view> &)> row_callback;
+
         /**
          * @brief   Initialize a CSVReader.
          * @param   commentPrefix Character use define a comment in the edge file.
@@ -48,10 +52,27 @@ namespace boost::bstream
 
         /**
          * @brief   Read a edge file.
+         *
+         * A file compressed with gzip, xz or zstd is detected from its first bytes and decompressed
+         * on the fly, without temporary file. The file is read, and decompressed, by a separate
+         * thread handing chunks to the parser through a bounded queue, so that the reading and
+         * the parsing overlap.
+         *
          * @param   path File path of the edge file to be read.
          * @return  Graph
          */
         std::vector<std::vector<std::string>> read(const std::string &path);
+
+        /**
+         * @brief   Read a edge file row by row, without storing it.
+         *
+         * The file is read as by read(path), row is called with the fields of every row in the order
+         * of the file. The fields are views of the line, only valid during the call.
+         *
+         * @param   path File path of the edge file to be read.
+         * @param   row Function called with the fields of every row.
+         */
+        void read(const std::string &path, const row_callback &row);
     };
 
 } // end namspace boost::bstream
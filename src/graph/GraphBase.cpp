@@ -9,6 +9,7 @@
 ///
 ///-------------------------------------------------------------------------------------------------
 
+#include <charconv>
 #include <tuple>
 #include <string>
 #include <boost/graph/adjacency_list.hpp>
@@ -29,15 +30,12 @@ namespace boost::bstream
 
     template<typename DirectedS>
     GraphBase<DirectedS>::GraphBase(const GraphBase<DirectedS> &g)
-    {
-        boost::copy_graph(g.G, this->G);
-        this->m = g.m;
-        this->label_map = g.label_map;
-        this->vertex_set = g.vertex_set;
-    }
+            : shared_adjacency(g.shared_adjacency), shared_labels(g.shared_labels), m(g.m), numeric(g.numeric),
+              numeric_gap(g.numeric_gap)
+    {}
 
     template<typename DirectedS>
-    GraphBase<DirectedS>::GraphBase(int num_vertex): m(0)
+    GraphBase<DirectedS>::GraphBase(int num_vertex): GraphBase()
     {
         for (auto i = 0; i < num_vertex; ++i)
             this->add_vertex();
@@ -67,7 +65,96 @@ namespace boost::bstream
     template<typename DirectedS>
     void GraphBase<DirectedS>::clear()
     {
-        this->G.clear();
+        this->shared_adjacency = std::make_shared<Adjacency>();
+        this->shared_labels = std::make_shared<LabelIndex>();
+        this->m = 0;
+    }
+
+    template<typename DirectedS>
+    typename GraphBase<DirectedS>::Adjacency &GraphBase<DirectedS>::mutable_graph()
+    {
+        if (this->shared_adjacency.use_count() > 1) {
+            auto shared = this->shared_adjacency;
+            const auto &G = *shared;
+            auto g = std::make_shared<Adjacency>(boost::num_vertices(G));
+            for (auto it = boost::vertices(G).first; it != boost::vertices(G).second; ++it)
+                (*g)[*it] = G[*it];
+            std::vector<std::pair<edge_t, edge_t>> moved;
+            moved.reserve(boost::num_edges(G));
+            for (auto it = boost::edges(G).first; it != boost::edges(G).second; ++it) {
+                auto e = boost::add_edge(boost::source(*it, G), boost::target(*it, G), G[*it], *g).first;
+                moved.emplace_back(*it, e);
+            }
+            this->shared_adjacency = g;
+            this->relocate_edges(moved);
+        }
+        return *this->shared_adjacency;
+    }
+
+    template<typename DirectedS>
+    typename GraphBase<DirectedS>::LabelIndex &GraphBase<DirectedS>::mutable_label_index()
+    {
+        if (this->shared_labels.use_count() > 1)
+            this->shared_labels = std::make_shared<LabelIndex>(*this->shared_labels);
+        return *this->shared_labels;
+    }
+
+    template<typename DirectedS>
+    bool GraphBase<DirectedS>::numeric_labels() const
+    {
+        return this->numeric;
+    }
+
+    template<typename DirectedS>
+    void GraphBase<DirectedS>::set_numeric_labels(bool numeric)
+    {
+        if (numeric == this->numeric)
+            return;
+        if (numeric) {
+            for (auto it = this->vertices().first; it != this->vertices().second; ++it) {
+                if (!graph()[*it].label.empty() && graph()[*it].label != std::to_string(*it))
+                    throw GraphBaseException("the vertex label: \"" + graph()[*it].label + "\" is not its vertex id");
+            }
+        }
+        auto &G = this->mutable_graph();
+        auto &index = this->mutable_label_index();
+        if (numeric) {
+            for (auto it = boost::vertices(G).first; it != boost::vertices(G).second; ++it)
+                std::string().swap(G[*it].label);
+            index.label_map.clear();
+            index.vertex_set.clear();
+        } else {
+            for (auto it = boost::vertices(G).first; it != boost::vertices(G).second; ++it) {
+                G[*it].label = std::to_string(*it);
+                index.label_map.emplace(G[*it].label, *it);
+                index.vertex_set.emplace_hint(index.vertex_set.end(), *it);
+            }
+            this->m = static_cast<int>(boost::num_vertices(G));
+        }
+        this->numeric = numeric;
+    }
+
+    template<typename DirectedS>
+    std::size_t GraphBase<DirectedS>::max_numeric_gap() const
+    {
+        return this->numeric_gap;
+    }
+
+    template<typename DirectedS>
+    void GraphBase<DirectedS>::set_max_numeric_gap(std::size_t gap)
+    {
+        this->numeric_gap = gap;
+    }
+
+    template<typename DirectedS>
+    bool GraphBase<DirectedS>::parse_label(const std::string &label, GraphBase<DirectedS>::vertex_t &v)
+    {
+        // the decimal string of a vertex_t has no sign and no leading zero
+        if (label.empty() || (label.size() > 1 && label[0] == '0'))
+            return false;
+        auto last = label.data() + label.size();
+        auto res = std::from_chars(label.data(), last, v);
+        return res.ec == std::errc() && res.ptr == last;
     }
 
     template<typename DirectedS>
@@ -78,7 +165,7 @@ namespace boost::bstream
         for (auto i = this->vertices().first; i != this->vertices().second; ++i) {
             for (auto j = this->vertices().first; j != this->vertices().second; ++j) {
                 if (this->has_edge(*i, *j))
-                    m(*i, *j) = 1;
+                    m(*i, *j) = this->edge_weight(*i, *j);
             }
         }
         return m;
@@ -87,48 +174,75 @@ namespace boost::bstream
     template<typename DirectedS>
     void GraphBase<DirectedS>::copy_graph(const GraphBase<DirectedS> &g)
     {
-        boost::copy_graph(g.G, this->G);
+        this->shared_adjacency = g.shared_adjacency;
+        this->shared_labels = g.shared_labels;
         this->m = g.m;
-        this->label_map = g.label_map;
-        this->vertex_set = g.vertex_set;
+        this->numeric = g.numeric;
+        this->numeric_gap = g.numeric_gap;
     }
 
     template<typename DirectedS>
     void GraphBase<DirectedS>::copy_adjacency(const GraphBase<DirectedS>::Adjacency &g)
     {
-        boost::copy_graph(g, this->G);
+        auto &G = this->mutable_graph();
+        boost::copy_graph(g, G);
         this->m = boost::num_vertices(g);
-        this->label_map.clear();
-        this->vertex_set.clear();
+        this->shared_labels = std::make_shared<LabelIndex>();
+        if (this->numeric)
+            return;
         for (auto it = boost::vertices(G).first; it != boost::vertices(G).second; ++it) {
             std::string label = std::to_string(*it);
-            this->label_map.insert(std::pair<std::string, vertex_t>(label, *it));
-            this->vertex_set.insert(*it);
+            this->shared_labels->label_map.insert(std::pair<std::string, vertex_t>(label, *it));
+            this->shared_labels->vertex_set.insert(*it);
         }
     }
 
     template<typename DirectedS>
-    typename GraphBase<DirectedS>::vertex_t &
+    void GraphBase<DirectedS>::assign_edges(std::size_t n, const std::vector<std::pair<vertex_t, vertex_t>> &edges,
+                                            bool labels)
+    {
+        for (auto &e : edges) {
+            if (e.first >= n || e.second >= n)
+                throw GraphBaseException("Vertex must exist");
+        }
+        this->shared_adjacency = std::make_shared<Adjacency>(edges.begin(), edges.end(), n);
+        this->shared_labels = std::make_shared<LabelIndex>();
+        this->m = static_cast<int>(n);
+        if (this->numeric)
+            return;
+        auto &G = *this->shared_adjacency;
+        auto &index = *this->shared_labels;
+        for (vertex_t v = 0; v < n; ++v) {
+            index.vertex_set.emplace_hint(index.vertex_set.end(), v);
+            if (labels) {
+                G[v].label = std::to_string(v);
+                index.label_map.emplace(G[v].label, v);
+            }
+        }
+    }
+
+    template<typename DirectedS>
+    typename GraphBase<DirectedS>::vertex_t
     GraphBase<DirectedS>::operator[](const std::string &label)
     {
         if (!has_vertex(label)) {
             std::string msg = "the vertex label: \"" + label + "\" doesn't exist";
             throw GraphBaseException(msg);
         } else {
-            return label_map[label];
+            return this->vertex(label);
         }
 
     }
 
     template<typename DirectedS>
-    std::string &
+    const std::string
     GraphBase<DirectedS>::operator[](const typename GraphBase<DirectedS>::vertex_t &v)
     {
         if (!has_vertex(v)) {
             std::string msg = "the vertex id: \"" + std::to_string(v) + "\" doesn't exist";
             throw GraphBaseException(msg);
         } else {
-            return this->G[v].label;
+            return this->label(v);
         }
     }
 
@@ -138,8 +252,8 @@ namespace boost::bstream
         std::ostringstream os;
         os << *this;
         for (auto it = this->edges().first; it != this->edges().second; ++it) {
-            auto s = boost::source(*it, this->G);
-            auto t = boost::target(*it, this->G);
+            auto s = boost::source(*it, this->graph());
+            auto t = boost::target(*it, this->graph());
             auto s_name = this->label(s);
             auto t_name = this->label(t);
             os << "\t" << "(" << s << "," << t << ")";
@@ -160,18 +274,38 @@ namespace boost::bstream
     typename GraphBase<DirectedS>::vertex_t
     GraphBase<DirectedS>::add_vertex(const std::string label)
     {
+        auto &G = this->mutable_graph();
+        if (this->numeric) {
+            if (label.empty())
+                return boost::add_vertex(VertexBaseProperty("", bipartite::null), G);
+            vertex_t v;
+            if (!parse_label(label, v))
+                throw GraphBaseException("the vertex label: \"" + label + "\" is not a vertex id");
+            if (v < boost::num_vertices(G))
+                throw GraphBaseException("Vertex label is not unique");
+            if (v - boost::num_vertices(G) > this->numeric_gap)
+                throw GraphBaseException("the vertex id " + label + " would add " +
+                                         std::to_string(v - boost::num_vertices(G)) +
+                                         " missing vertices, more than the maximum numeric gap of " +
+                                         std::to_string(this->numeric_gap));
+            while (boost::num_vertices(G) < v)
+                boost::add_vertex(VertexBaseProperty("", bipartite::null), G);
+            return boost::add_vertex(VertexBaseProperty("", bipartite::null), G);
+        }
+
         std::string name;
         if (label.empty())
             name = to_string(m);
         else
             name = label;
 
-        if (label_map.find(name) != label_map.end())
+        if (label_index().label_map.find(name) != label_index().label_map.end())
             throw GraphBaseException("Vertex label is not unique");
         auto vp = VertexBaseProperty(name, bipartite::null);
         auto v = boost::add_vertex(vp, G);
-        label_map.insert(make_pair(name, v));
-        vertex_set.insert(v);
+        auto &index = this->mutable_label_index();
+        index.label_map.insert(make_pair(name, v));
+        index.vertex_set.insert(v);
         m++;
         return v;
     }
@@ -180,19 +314,25 @@ namespace boost::bstream
     typename GraphBase<DirectedS>::vertex_t
     GraphBase<DirectedS>::vertex(const std::string label)
     {
-        return label_map[label];
+        vertex_t v;
+        if (this->numeric)
+            return parse_label(label, v) && v < boost::num_vertices(graph()) ? v : vertex_t();
+        auto it = label_index().label_map.find(label);
+        return it != label_index().label_map.end() ? it->second : vertex_t();
     }
 
     template<typename DirectedS>
     double GraphBase<DirectedS>::num_vertices()
     {
-        return boost::num_vertices(G);
+        return boost::num_vertices(graph());
     }
 
     template<typename DirectedS>
     std::string GraphBase<DirectedS>::label(const GraphBase::vertex_t &v) const
     {
-        return G[v].label;
+        if (this->numeric)
+            return std::to_string(v);
+        return graph()[v].label;
     }
 
     template<typename DirectedS>
@@ -200,7 +340,12 @@ namespace boost::bstream
     GraphBase<DirectedS>::labels() const
     {
         std::vector<std::string> labels;
-        for (auto it = label_map.begin(); it != label_map.end(); ++it)
+        if (this->numeric) {
+            for (auto it = boost::vertices(graph()).first; it != boost::vertices(graph()).second; ++it)
+                labels.push_back(std::to_string(*it));
+            return labels;
+        }
+        for (auto it = label_index().label_map.begin(); it != label_index().label_map.end(); ++it)
             labels.push_back(it->first);
         return labels;
     }
@@ -209,55 +354,57 @@ namespace boost::bstream
     template<typename DirectedS>
     bool GraphBase<DirectedS>::has_vertex(const GraphBase::vertex_t &v)
     {
-        return vertex_set.find(v) != vertex_set.end();
+        if (this->numeric)
+            return v < boost::num_vertices(graph());
+        return label_index().vertex_set.find(v) != label_index().vertex_set.end();
     }
 
     template<typename DirectedS>
     bool GraphBase<DirectedS>::has_vertex(const std::string &label)
     {
-        return label_map.find(label) != label_map.end();
+        if (this->numeric) {
+            vertex_t v;
+            return parse_label(label, v) && v < boost::num_vertices(graph());
+        }
+        return label_index().label_map.find(label) != label_index().label_map.end();
     }
 
 
     template<typename DirectedS>
     void GraphBase<DirectedS>::remove_vertex(const std::string &label)
     {
-        auto v = this->vertex(label);
-        if (this->has_vertex(v)) {
-            boost::clear_vertex(v, G);
-            boost::remove_vertex(v, G);
-        }
-
-        label_map.clear();
-        vertex_set.clear();
-        for (auto it = this->vertices().first; it != this->vertices().second; ++it) {
-            vertex_set.insert(*it);
-            label_map.insert(make_pair(G[*it].label, *it));
-        }
-
+        if (this->has_vertex(label))
+            GraphBase<DirectedS>::remove_vertex(this->vertex(label));
     }
 
     template<typename DirectedS>
     void GraphBase<DirectedS>::remove_vertex(const GraphBase<DirectedS>::vertex_t &v)
     {
         if (this->has_vertex(v)) {
+            auto &G = this->mutable_graph();
             boost::clear_vertex(v, G);
             boost::remove_vertex(v, G);
         }
 
-        label_map.clear();
-        vertex_set.clear();
+        this->shared_labels = std::make_shared<LabelIndex>();
+        if (this->numeric)
+            return;
         for (auto it = this->vertices().first; it != this->vertices().second; ++it) {
-            vertex_set.insert(*it);
-            label_map.insert(make_pair(G[*it].label, *it));
+            this->shared_labels->vertex_set.insert(*it);
+            this->shared_labels->label_map.insert(make_pair(graph()[*it].label, *it));
         }
     }
 
     template<typename DirectedS>
     void GraphBase<DirectedS>::clear_vertices()
     {
+        if (this->numeric) {
+            while (boost::num_vertices(graph()) > 0)
+                this->remove_vertex(this->label(boost::num_vertices(graph()) - 1));
+            return;
+        }
         std::set<std::string> labels;
-        for (auto it = label_map.begin(); it != label_map.end(); ++it)
+        for (auto it = label_index().label_map.begin(); it != label_index().label_map.end(); ++it)
             labels.insert(it->first);
 
         for (auto it = labels.begin(); it != labels.end(); ++it)
@@ -267,44 +414,44 @@ namespace boost::bstream
     template<typename DirectedS>
     double GraphBase<DirectedS>::degree(const GraphBase<DirectedS>::vertex_t &v)
     {
-        return static_cast<double>(boost::degree(v, G));
+        return static_cast<double>(boost::degree(v, graph()));
     }
 
     template<typename DirectedS>
     double GraphBase<DirectedS>::degree(const std::string &v)
     {
-        return static_cast<double>(boost::degree(vertex(v), G));
+        return static_cast<double>(boost::degree(vertex(v), graph()));
     }
 
     template<typename DirectedS>
     double GraphBase<DirectedS>::in_degree(const GraphBase<DirectedS>::vertex_t &v)
     {
-        return static_cast<double>(boost::in_degree(v, G));
+        return static_cast<double>(boost::in_degree(v, graph()));
     }
 
     template<typename DirectedS>
     double GraphBase<DirectedS>::in_degree(const std::string &v)
     {
-        return static_cast<double>(boost::in_degree(vertex(v), G));
+        return static_cast<double>(boost::in_degree(vertex(v), graph()));
     }
 
     template<typename DirectedS>
     double GraphBase<DirectedS>::out_degree(const GraphBase<DirectedS>::vertex_t &v)
     {
-        return static_cast<double>(boost::out_degree(v, G));
+        return static_cast<double>(boost::out_degree(v, graph()));
     }
 
     template<typename DirectedS>
     double GraphBase<DirectedS>::out_degree(const std::string &v)
     {
-        return static_cast<double>(boost::out_degree(vertex(v), G));
+        return static_cast<double>(boost::out_degree(vertex(v), graph()));
     }
 
     template<typename DirectedS>
     std::pair<typename GraphBase<DirectedS>::vertex_iterator, typename GraphBase<DirectedS>::vertex_iterator>
     GraphBase<DirectedS>::vertices()
     {
-        return boost::vertices(G);
+        return boost::vertices(graph());
     }
 
     template<typename DirectedS>
@@ -348,9 +495,9 @@ namespace boost::bstream
         // test if vertices at the end of edge exist
         if (has_vertex(s) && has_vertex(t)) {
             // we check if edge already exist
-            std::tie(e, ok) = boost::edge(s, t, G);
+            std::tie(e, ok) = boost::edge(s, t, graph());
             if (!ok) {
-                tie(e, ok) = boost::add_edge(s, t, G);
+                tie(e, ok) = boost::add_edge(s, t, this->mutable_graph());
                 if (!ok)
                     throw GraphBaseException("Unable to add the edge");
             }
@@ -384,54 +531,51 @@ namespace boost::bstream
     template<typename DirectedS>
     double GraphBase<DirectedS>::num_edges()
     {
-        return static_cast<double>(boost::num_edges(G));
+        return static_cast<double>(boost::num_edges(graph()));
     }
 
     template<typename DirectedS>
     bool
     GraphBase<DirectedS>::has_edge(const GraphBase<DirectedS>::vertex_t &s, const GraphBase<DirectedS>::vertex_t &t)
     {
-        return boost::edge(s, t, G).second;
+        return boost::edge(s, t, graph()).second;
     }
 
     template<typename DirectedS>
     bool GraphBase<DirectedS>::has_edge(const std::string &s, const std::string &t)
     {
-        return boost::edge(vertex(s), vertex(t), G).second;
+        return boost::edge(vertex(s), vertex(t), graph()).second;
     }
 
     template<typename DirectedS>
     void
     GraphBase<DirectedS>::remove_edge(const GraphBase<DirectedS>::vertex_t &s, const GraphBase<DirectedS>::vertex_t &t)
     {
-        GraphBase<DirectedS>::edge_t e;
-        bool exist;
-        std::tie(e, exist) = boost::edge(s, t, G);
-        if (exist)
-            boost::remove_edge(e, G);
+        if (boost::edge(s, t, graph()).second) {
+            auto &G = this->mutable_graph();
+            boost::remove_edge(boost::edge(s, t, G).first, G);
+        }
     }
 
     template<typename DirectedS>
     void GraphBase<DirectedS>::remove_edge(const std::string &s, const std::string &t)
     {
-        edge_t e;
-        bool exist;
-        std::tie(e, exist) = boost::edge(vertex(s), vertex(t), G);
-        if (exist)
-            boost::remove_edge(e, G);
+        GraphBase<DirectedS>::remove_edge(vertex(s), vertex(t));
     }
 
     template<typename DirectedS>
     void GraphBase<DirectedS>::remove_edge(const GraphBase<DirectedS>::edge_t &e)
     {
-        boost::remove_edge(e, G);
+        ///< e may belong to the adjacency shared with another graph
+        GraphBase<DirectedS>::remove_edge(boost::source(e, graph()), boost::target(e, graph()));
     }
 
     template<typename DirectedS>
     void GraphBase<DirectedS>::clear_edges()
     {
+        auto &G = this->mutable_graph();
         vertex_iterator vit, vit_end;
-        for (tie(vit, vit_end) = this->vertices(); vit != vit_end; ++vit) {
+        for (tie(vit, vit_end) = boost::vertices(G); vit != vit_end; ++vit) {
             boost::clear_vertex(*vit, G);
         }
     }
@@ -440,21 +584,21 @@ namespace boost::bstream
     pair<typename GraphBase<DirectedS>::edge_iterator, typename GraphBase<DirectedS>::edge_iterator>
     GraphBase<DirectedS>::edges()
     {
-        return boost::edges(G);
+        return boost::edges(graph());
     }
 
     template<typename DirectedS>
     pair<typename GraphBase<DirectedS>::adjacency_iterator, typename GraphBase<DirectedS>::adjacency_iterator>
     GraphBase<DirectedS>::neighbors(const GraphBase::vertex_t &v)
     {
-        return boost::adjacent_vertices(v, G);
+        return boost::adjacent_vertices(v, graph());
     }
 
     template<typename DirectedS>
     pair<typename GraphBase<DirectedS>::adjacency_iterator, typename GraphBase<DirectedS>::adjacency_iterator>
     GraphBase<DirectedS>::neighbors(const std::string &v)
     {
-        return boost::adjacent_vertices(vertex(v), G);
+        return boost::adjacent_vertices(vertex(v), graph());
     }
 
     template<typename DirectedS>
@@ -471,25 +615,65 @@ namespace boost::bstream
     std::pair<typename GraphBase<DirectedS>::edge_t, bool>
     GraphBase<DirectedS>::edge(const GraphBase::vertex_t &s, const GraphBase::vertex_t &t)
     {
-        return boost::edge(s, t, this->G);
+        return boost::edge(s, t, this->graph());
     }
 
     template<typename DirectedS>
     std::pair<typename GraphBase<DirectedS>::edge_t, bool>
     GraphBase<DirectedS>::edge(const std::string &s, const std::string &t)
     {
-        return boost::edge(this->vertex(s), this->vertex(t), this->G);
+        return boost::edge(this->vertex(s), this->vertex(t), this->graph());
     }
 
     template<typename DirectedS>
     std::pair<typename GraphBase<DirectedS>::vertex_t, typename GraphBase<DirectedS>::vertex_t>
     GraphBase<DirectedS>::edge_endpoint(const typename GraphBase<DirectedS>::edge_t &e)
     {
-        auto source = boost::source(e, this->G);
-        auto target = boost::target(e, this->G);
+        auto source = boost::source(e, this->graph());
+        auto target = boost::target(e, this->graph());
         return std::make_pair(source, target);
     }
 
+    template<typename DirectedS>
+    double GraphBase<DirectedS>::edge_weight(const GraphBase<DirectedS>::vertex_t &s,
+                                             const GraphBase<DirectedS>::vertex_t &t)
+    {
+        edge_t e;
+        bool exist;
+        std::tie(e, exist) = boost::edge(s, t, graph());
+        if (!exist)
+            throw GraphBaseException("the edge (" + std::to_string(s) + "," + std::to_string(t) + ") doesn't exist");
+        return graph()[e].weight;
+    }
+
+    template<typename DirectedS>
+    double GraphBase<DirectedS>::edge_weight(const std::string &s, const std::string &t)
+    {
+        return this->edge_weight(vertex(s), vertex(t));
+    }
+
+    template<typename DirectedS>
+    double GraphBase<DirectedS>::edge_weight(const GraphBase<DirectedS>::edge_t &e)
+    {
+        return graph()[e].weight;
+    }
+
+    template<typename DirectedS>
+    void GraphBase<DirectedS>::set_edge_weight(const GraphBase<DirectedS>::vertex_t &s,
+                                               const GraphBase<DirectedS>::vertex_t &t, double weight)
+    {
+        if (!boost::edge(s, t, graph()).second)
+            throw GraphBaseException("the edge (" + std::to_string(s) + "," + std::to_string(t) + ") doesn't exist");
+        auto &G = this->mutable_graph();
+        G[boost::edge(s, t, G).first].weight = weight;
+    }
+
+    template<typename DirectedS>
+    void GraphBase<DirectedS>::set_edge_weight(const std::string &s, const std::string &t, double weight)
+    {
+        this->set_edge_weight(vertex(s), vertex(t), weight);
+    }
+
 
     template
     class GraphBase<boost::undirectedS>;
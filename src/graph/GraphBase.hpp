@@ -16,8 +16,11 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/labeled_graph.hpp>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <set>
+#include <utility>
+#include <vector>
 #include <Eigen/Core>
 
 #include "GraphAbstract.hpp"
@@ -46,8 +49,26 @@ namespace boost::bstream
         std::string label;
     };
 
+    class EdgeBaseProperty
+    {
+    public:
+        EdgeBaseProperty() : weight(1.0)
+        {};
+
+        EdgeBaseProperty(double weight) : weight(weight)
+        {};
+
+        double weight;
+    };
+
     /**
      * @brief class basegraph
+     *
+     * The adjacency and the label index are shared by the copies of a graph (copy constructor,
+     * copy_graph) and each of them is duplicated the first time one of the copies modifies it, so
+     * that copying a graph is O(1). Iterators and edge_t obtained before modifying a graph that
+     * shares its adjacency still refer to the shared adjacency.
+     *
      * @tparam DirectedS
      */
     template<typename DirectedS>
@@ -58,7 +79,8 @@ namespace boost::bstream
                 listS,
                 vecS,
                 DirectedS,
-                VertexBaseProperty
+                VertexBaseProperty,
+                EdgeBaseProperty
         > Adjacency;
 
         typedef graph_traits<Adjacency> traits;
@@ -82,7 +104,10 @@ namespace boost::bstream
         ///
         ///**************************************************************************************************
 
-        GraphBase() : m(0)
+        static constexpr std::size_t default_max_numeric_gap = std::size_t(1) << 20; ///< see set_max_numeric_gap
+
+        GraphBase() : shared_adjacency(std::make_shared<Adjacency>()), shared_labels(std::make_shared<LabelIndex>()),
+                      m(0), numeric(false), numeric_gap(default_max_numeric_gap)
         {};
 
         GraphBase(const GraphBase<DirectedS> &g);
@@ -109,6 +134,53 @@ namespace boost::bstream
 
         virtual void copy_adjacency(const Adjacency &g);
 
+        /**
+         * @brief Replace the content of the graph by n vertices and a list of edges.
+         *
+         * The adjacency is built in one pass from the edge list, without going through add_edge nor
+         * an intermediate graph. The edges must be distinct and their end points lower than n.
+         *
+         * @param n number of vertices
+         * @param edges vector of (source, target) vertex_t
+         * @param labels if false the vertices get no label and cannot be looked up by label
+         */
+        virtual void assign_edges(std::size_t n, const std::vector<std::pair<vertex_t, vertex_t>> &edges,
+                                  bool labels = true);
+
+        /**
+         * @brief Return true if the graph is in numeric label mode.
+         * @return boolean
+         */
+        bool numeric_labels() const;
+
+        /**
+         * @brief Switch the numeric label mode on or off.
+         *
+         * In numeric label mode the label of a vertex is the decimal string of its vertex_t, computed
+         * on demand, and no label index is stored. Looking up a label parses it, and adding the vertex
+         * "k" beyond the last vertex also adds the missing vertices in between, so that integer-keyed
+         * datasets keep their ids, at most max_numeric_gap() of them at once so that a stray large id
+         * throws instead of allocating every vertex up to it. As vertex_t are renumbered when a vertex
+         * is removed, the labels of the following vertices change too. The mode can only be switched on
+         * if every vertex is unlabeled or labeled by its vertex_t, switching it off stores the labels.
+         *
+         * @param numeric
+         */
+        void set_numeric_labels(bool numeric);
+
+        /**
+         * @brief Maximum number of missing vertices added by a single numeric label.
+         * @return the gap, default_max_numeric_gap unless set
+         */
+        std::size_t max_numeric_gap() const;
+
+        /**
+         * @brief Set the maximum number of missing vertices added by a single numeric label, adding
+         * a vertex further away throws a GraphBaseException.
+         * @param gap
+         */
+        void set_max_numeric_gap(std::size_t gap);
+
         MatrixXd adjacency();
 
         void read_csv(std::string path, char delimiter = ',');
@@ -131,11 +203,21 @@ namespace boost::bstream
 
         void clear_edges();
 
-        void clear();
+        /**
+         * @brief Remove every vertex and edge, virtual so that the derived classes reset their own
+         * state through a GraphBase reference.
+         */
+        virtual void clear();
 
-        virtual vertex_t &operator[](const std::string &label);
+        /**
+         * @brief The vertex_t of a label, returned by value.
+         */
+        virtual vertex_t operator[](const std::string &label);
 
-        virtual std::string &operator[](const vertex_t &v);
+        /**
+         * @brief The label of a vertex, a read-only copy since the label index could not follow a write.
+         */
+        virtual const std::string operator[](const vertex_t &v);
 
         ///**************************************************************************************************
         ///
@@ -222,6 +304,22 @@ namespace boost::bstream
 
         virtual std::pair<vertex_t, vertex_t> edge_endpoint(const edge_t &e);
 
+        /**
+         * @brief weight of an edge, 1 unless it was set with set_edge_weight
+         * @param s
+         * @param t
+         * @return double
+         */
+        virtual double edge_weight(const vertex_t &s, const vertex_t &t);
+
+        virtual double edge_weight(const std::string &s, const std::string &t);
+
+        virtual double edge_weight(const edge_t &e);
+
+        virtual void set_edge_weight(const vertex_t &s, const vertex_t &t, double weight);
+
+        virtual void set_edge_weight(const std::string &s, const std::string &t, double weight);
+
         /**
          * @brief test if the edge (u,v) exist
          * @param s
@@ -260,17 +358,53 @@ namespace boost::bstream
         }
 
     protected:
+        struct LabelIndex
+        {
+            std::map<std::string, vertex_t> label_map;
+            std::set<vertex_t, std::less<vertex_t>> vertex_set;
+        };
+
         /**
-         * Adjacency list of the graph
+         * Adjacency list of the graph, shared with the copies of the graph
          */
-        Adjacency G;
-        std::map<std::string, vertex_t> label_map;
-        std::set<vertex_t, std::less<vertex_t>> vertex_set;
+        std::shared_ptr<Adjacency> shared_adjacency;
+        std::shared_ptr<LabelIndex> shared_labels;
         int m; //!< next vertex_id
+        bool numeric; //!< labels are implicit decimal vertex_t, label_map and vertex_set are empty
+        std::size_t numeric_gap; //!< maximum number of missing vertices added by a numeric label
 
         virtual void remove_edge(const edge_t &e);
 
         virtual void remove_vertex(const vertex_t &v);
+
+        const Adjacency &graph() const
+        {
+            return *shared_adjacency;
+        };
+
+        /**
+         * @brief The adjacency for writing, it is first copied if it is shared with another graph.
+         */
+        Adjacency &mutable_graph();
+
+        const LabelIndex &label_index() const
+        {
+            return *shared_labels;
+        };
+
+        LabelIndex &mutable_label_index();
+
+        /**
+         * @brief Called when the adjacency is copied by mutable_graph, with the pairs (old edge_t, new
+         * edge_t) of every edge, so that the data keyed by edge_t can follow.
+         */
+        virtual void relocate_edges(const std::vector<std::pair<edge_t, edge_t>> &)
+        {};
+
+        /**
+         * @brief Parse a numeric label, true if it is the decimal string of some vertex_t.
+         */
+        static bool parse_label(const std::string &label, vertex_t &v);
     };
 
 } // end namespace boost::bstream
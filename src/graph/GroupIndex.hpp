@@ -0,0 +1,104 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       GroupIndex.hpp
+/// @brief      Dense per-group vertex indices of bipartite graphs
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_GROUPINDEX_HPP
+#define BSTREAM_GROUPINDEX_HPP
+
+#include <limits>
+#include <vector>
+
+#include "GraphAbstract.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @brief Partition of the vertices of a bipartite graph into a top and a bottom index space.
+     *
+     * The top vertices are numbered 0 .. num_top-1 and the bottom vertices 0 .. num_bottom-1 in the
+     * order in which they were added. members(group)[id] gives the vertex_t of a group id and
+     * local(v) the group id of a vertex_t, both in O(1). The vertices without group are not indexed.
+     * Since removing a vertex renumbers the vertex_t of the graph, the owner rebuilds the index with
+     * rebuild() after a removal.
+     */
+    class GroupIndex
+    {
+    public:
+        typedef std::size_t vertex_t;
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * @brief Register the vertex v, v must be the last vertex added to the graph.
+         */
+        void add(vertex_t v, int group)
+        {
+            if (v >= local_id.size())
+                local_id.resize(v + 1, npos);
+            if (group == vertex_group::top) {
+                local_id[v] = top.size();
+                top.push_back(v);
+            } else if (group == vertex_group::bottom) {
+                local_id[v] = bottom.size();
+                bottom.push_back(v);
+            }
+        }
+
+        /**
+         * @brief Recompute the index from the group of every vertex of g.
+         */
+        template<typename Graph>
+        void rebuild(Graph &g)
+        {
+            clear();
+            for (auto v = g.vertices().first; v != g.vertices().second; ++v)
+                add(*v, g.group(*v));
+        }
+
+        void clear()
+        {
+            top.clear();
+            bottom.clear();
+            local_id.clear();
+        }
+
+        /**
+         * @brief vertex_t of the vertices of a group, indexed by their group id.
+         */
+        const std::vector<vertex_t> &members(int group) const
+        {
+            return group == vertex_group::top ? top : bottom;
+        }
+
+        std::size_t size(int group) const
+        {
+            if (group == vertex_group::top)
+                return top.size();
+            if (group == vertex_group::bottom)
+                return bottom.size();
+            return 0;
+        }
+
+        /**
+         * @brief Group id of the vertex v, npos if v has no group.
+         */
+        std::size_t local(vertex_t v) const
+        {
+            return v < local_id.size() ? local_id[v] : npos;
+        }
+
+    private:
+        std::vector<vertex_t> top;          ///< top id -> vertex_t
+        std::vector<vertex_t> bottom;       ///< bottom id -> vertex_t
+        std::vector<std::size_t> local_id;  ///< vertex_t -> top or bottom id
+    };
+} // end namespace boost::bstream
+
+#endif //BSTREAM_GROUPINDEX_HPP
@@ -10,17 +10,50 @@
 ///-------------------------------------------------------------------------------------------------
 
 
+#include <algorithm>
+#include <charconv>
+#include <deque>
 #include <limits>
 #include <map>
+#include <unordered_map>
 #include <boost/icl/interval_set.hpp>
 
 #include "LinkStreamBase.hpp"
 #include "CSVReader.hpp"
+#include "parallel.hpp"
 
 using namespace std;
 
 namespace boost::bstream
 {
+    namespace
+    {
+        ///< rounding toward -infinity and +infinity, the timestamps may be negative
+        time_t floor_div(time_t t, time_t unit)
+        {
+            return t / unit - (t % unit < 0);
+        }
+
+        time_t ceil_div(time_t t, time_t unit)
+        {
+            return t / unit + (t % unit > 0);
+        }
+
+        time_t parse_time(std::string_view field)
+        {
+            while (!field.empty() && field.front() == ' ')
+                field.remove_prefix(1);
+            time_t t = 0;
+            auto res = std::from_chars(field.data(), field.data() + field.size(), t);
+            if (res.ec != std::errc())
+                throw LinkStreamBaseException("Invalid timestamp: " + std::string(field));
+            return t;
+        }
+
+        ///< an interval is a node of a red-black tree: color, parent and children pointers, bounds
+        const std::size_t interval_node_bytes = 4 * sizeof(void *) + sizeof(TimeInterval);
+    }
+
     ///**************************************************************************************************
     ///
     ///  Constructor
@@ -38,7 +71,7 @@ namespace boost::bstream
     {}
 
     template<typename DirectedS>
-    LinkStreamBase<DirectedS>::LinkStreamBase(time_t b, time_t e)
+    LinkStreamBase<DirectedS>::LinkStreamBase(time_t b, time_t e) : shared_intervals(std::make_shared<IntervalMap>())
     {
         interval_def = make_time_interval(b, e);
     }
@@ -74,6 +107,74 @@ namespace boost::bstream
         interval_def = make_time_interval(t1, t2);
     }
 
+    template<typename DirectedS>
+    void LinkStreamBase<DirectedS>::copy_graph(const GraphBase<DirectedS> &g)
+    {
+        GraphBase<DirectedS>::copy_graph(g);
+        auto l = dynamic_cast<const LinkStreamBase<DirectedS> *>(&g);
+        if (l != nullptr) {
+            this->shared_intervals = l->shared_intervals;
+            this->shared_compressed = l->shared_compressed;
+            this->interval_def = l->interval_def;
+        } else {
+            this->shared_intervals = std::make_shared<IntervalMap>();
+            this->shared_compressed.reset();
+        }
+    }
+
+    template<typename DirectedS>
+    void LinkStreamBase<DirectedS>::clear()
+    {
+        GraphBase<DirectedS>::clear();
+        this->shared_intervals = std::make_shared<IntervalMap>();
+        this->shared_compressed.reset();
+    }
+
+    template<typename DirectedS>
+    TimeIntervalSet
+    LinkStreamBase<DirectedS>::intervals(const typename LinkStreamBase<DirectedS>::edge_t &e) const
+    {
+        if (shared_compressed) {
+            auto it = shared_compressed->find(e);
+            return it != shared_compressed->end() ? it->second.to_time_interval_set() : TimeIntervalSet();
+        }
+        auto it = shared_intervals->find(e);
+        return it != shared_intervals->end() ? it->second : TimeIntervalSet();
+    }
+
+    template<typename DirectedS>
+    typename LinkStreamBase<DirectedS>::IntervalMap &LinkStreamBase<DirectedS>::mutable_intervals()
+    {
+        if (shared_compressed)
+            decompress_intervals();
+        else if (shared_intervals.use_count() > 1)
+            shared_intervals = std::make_shared<IntervalMap>(*shared_intervals);
+        return *shared_intervals;
+    }
+
+    template<typename DirectedS>
+    void LinkStreamBase<DirectedS>::relocate_edges(const std::vector<std::pair<typename LinkStreamBase<DirectedS>::edge_t,
+            typename LinkStreamBase<DirectedS>::edge_t>> &moved)
+    {
+        if (shared_compressed) {
+            auto compressed = std::make_shared<CompressedIntervalMap>();
+            for (auto &p : moved) {
+                auto it = shared_compressed->find(p.first);
+                if (it != shared_compressed->end())
+                    compressed->emplace(p.second, it->second);
+            }
+            shared_compressed = compressed;
+            return;
+        }
+        auto relocated = std::make_shared<IntervalMap>();
+        for (auto &p : moved) {
+            auto it = shared_intervals->find(p.first);
+            if (it != shared_intervals->end())
+                relocated->emplace(p.second, it->second);
+        }
+        shared_intervals = relocated;
+    }
+
     template<typename DirectedS>
     std::string LinkStreamBase<DirectedS>::print_edges()
     {
@@ -81,11 +182,11 @@ namespace boost::bstream
         os << *this << endl;
         auto e_iterator = this->edges();
         for (auto it = e_iterator.first; it != e_iterator.second; ++it) {
-            auto s = boost::source(*it, this->G);
-            auto t = boost::target(*it, this->G);
+            auto s = boost::source(*it, this->graph());
+            auto t = boost::target(*it, this->graph());
             auto s_name = this->label(s);
             auto t_name = this->label(t);
-            os << "\t" << TimeIntervalSetVertexMap[*it] << " x "
+            os << "\t" << this->intervals(*it) << " x "
                  << "(" << s << "," << t << ")";
             if (!s_name.empty() && !t_name.empty())
                 os << " with name (" << s_name << "," << t_name << ")";
@@ -100,7 +201,7 @@ namespace boost::bstream
         auto edge_it = this->edges();
         double sum = 0;
         for (auto it = edge_it.first; it != edge_it.second; ++it)
-            sum += TimeIntervalSetVertexMap[*it].length();
+            sum += this->edge_tinterval_length(*it);
         return sum / (interval_def.upper() - interval_def.lower());
     }
 
@@ -109,7 +210,7 @@ namespace boost::bstream
     {
         double sumL = 0.0;
         for (auto it = this->edges().first; it != this->edges().second; ++it)
-            sumL += TimeIntervalSetVertexMap[*it].length();
+            sumL += this->edge_tinterval_length(*it);
         auto temp = sumL /
                     (this->num_vertices() * (this->num_vertices() - 1) * (interval_def.upper() - interval_def.lower()));
         if (this->is_directed())
@@ -121,28 +222,212 @@ namespace boost::bstream
     template<typename DirectedS>
     void LinkStreamBase<DirectedS>::read_csv(std::string path, char delimiter)
     {
-        auto cvs = CSVReader(delimiter);
-        auto graph = cvs.read(path);
-        time_t min_interval = std::numeric_limits<time_t>::max();
-        time_t max_interval = 0;
-        for (auto edge_it = graph.begin(); edge_it != graph.end(); ++edge_it) {
-            if (min_interval > std::stoull((*edge_it)[2]))
-                min_interval = std::stoull((*edge_it)[2]);
-            if (max_interval < std::stoull((*edge_it)[3]))
-                max_interval = std::stoull((*edge_it)[3]);
+        csv_options options;
+        options.delimiter = delimiter;
+        this->read_csv(path, options);
+    }
+
+    template<typename DirectedS>
+    void LinkStreamBase<DirectedS>::read_csv(const std::string &path, const csv_options &options)
+    {
+        if (options.time_unit < 1)
+            throw LinkStreamBaseException("the time unit must be at least 1");
+        auto columns = std::max({options.source, options.target, options.begin, options.end}) + 1;
+
+        ///< labels of the kept rows, stored once, the keys viewing the stored labels
+        std::deque<std::string> labels;
+        std::unordered_map<std::string_view, std::size_t> ids;
+        auto intern = [&](std::string_view label) {
+            auto it = ids.find(label);
+            if (it != ids.end())
+                return it->second;
+            labels.emplace_back(label);
+            return ids.emplace(labels.back(), labels.size() - 1).first->second;
+        };
+
+        std::vector<std::tuple<std::size_t, std::size_t, time_t, time_t>> rows;
+        bool header = options.header;
+        CSVReader(options.delimiter).read(path, [&](const std::vector<std::string_view> &fields) {
+            if (header) {
+                header = false;
+                return;
+            }
+            if (fields.size() < columns)
+                throw LinkStreamBaseException("Missing column in " + path);
+
+            ///< cheapest filters first, the labels are only stored for the kept rows
+            auto b = floor_div(parse_time(fields[options.begin]), options.time_unit);
+            auto e = ceil_div(parse_time(fields[options.end]), options.time_unit);
+            if (b >= e)
+                throw LinkStreamBaseException("Empty contact in " + path);
+            if (e - b < options.min_duration)
+                return;
+            b = std::max(b, options.window_begin);
+            e = std::min(e, options.window_end);
+            if (b >= e)
+                return;
+            auto s = fields[options.source], t = fields[options.target];
+            if (!options.deny.empty() && (options.deny.count(s) > 0 || options.deny.count(t) > 0))
+                return;
+            if (!options.allow.empty() && (options.allow.count(s) == 0 || options.allow.count(t) == 0))
+                return;
+            rows.emplace_back(intern(s), intern(t), b, e);
+        });
+        if (rows.empty())
+            return;
+
+        auto t_begin = std::numeric_limits<time_t>::max(), t_end = std::numeric_limits<time_t>::min();
+        if (boost::num_edges(this->graph()) > 0)
+            std::tie(t_begin, t_end) = this->definition();
+        for (auto &r : rows) {
+            t_begin = std::min(t_begin, std::get<2>(r));
+            t_end = std::max(t_end, std::get<3>(r));
+        }
+        this->set_definition(t_begin, t_end);
+
+        ///< a contact with a new vertex is added by add_edge_w_time, which creates its vertices
+        std::vector<typename LinkStreamBase<DirectedS>::vertex_t> vertices(labels.size());
+        std::vector<bool> resolved(labels.size(), false);
+        auto resolve = [&](std::size_t id) {
+            if (!resolved[id] && this->has_vertex(labels[id])) {
+                vertices[id] = this->vertex(labels[id]);
+                resolved[id] = true;
+            }
+            return resolved[id];
+        };
+        std::vector<contact_t> contacts;
+        contacts.reserve(rows.size());
+        for (auto &r : rows) {
+            auto s = std::get<0>(r), t = std::get<1>(r);
+            bool known = resolve(s);
+            known = resolve(t) && known;
+            if (known) {
+                contacts.emplace_back(vertices[s], vertices[t], std::get<2>(r), std::get<3>(r));
+            } else {
+                this->add_edge_w_time(labels[s], labels[t], std::get<2>(r), std::get<3>(r));
+                resolve(s);
+                resolve(t);
+            }
         }
+        rows.clear();
+        rows.shrink_to_fit();
+        this->add_edges_w_time(contacts);
+        if (options.compress)
+            this->compress_intervals();
+    }
 
-        this->set_definition(min_interval, max_interval);
+    template<typename DirectedS>
+    coarsening_summary LinkStreamBase<DirectedS>::coarsen(time_t resolution, time_t max_gap, bool compress)
+    {
+        if (resolution < 1)
+            throw LinkStreamBaseException("the resolution of the coarsening must be at least 1");
+        if (max_gap < 0)
+            throw LinkStreamBaseException("the maximum gap of the coarsening must be positive");
+
+        auto upper = interval_def.upper() == TimeIntervalSet::infinity ? TimeIntervalSet::infinity
+                                                                        : ceil_div(interval_def.upper(), resolution);
+        interval_def = TimeInterval(floor_div(interval_def.lower(), resolution), upper);
+
+        std::vector<TimeIntervalSet *> sets;
+        auto &intervals = this->mutable_intervals();
+        sets.reserve(intervals.size());
+        for (auto &p : intervals)
+            sets.push_back(&p.second);
+
+        std::vector<std::size_t> before(sets.size()), after(sets.size());
+        parallel_for(0, sets.size(), [&](std::size_t i) {
+            ///< the icl set is sorted, the coarse intervals are built in order and merged on the fly
+            TimeIntervalSet::time_interval_set coarse;
+            time_t lo = 0, hi = 0;
+            bool open = false;
+            for (auto ti = sets[i]->begin(); ti != sets[i]->end(); ++ti) {
+                auto b = floor_div(ti->lower(), resolution), e = ceil_div(ti->upper(), resolution);
+                if (open && b - hi < max_gap) {
+                    hi = std::max(hi, e);
+                    continue;
+                }
+                if (open)
+                    coarse.add(coarse.end(), TimeInterval(lo, hi));
+                lo = b;
+                hi = e;
+                open = true;
+            }
+            if (open)
+                coarse.add(coarse.end(), TimeInterval(lo, hi));
+            before[i] = sets[i]->size();
+            *sets[i] = TimeIntervalSet(interval_def, coarse);
+            after[i] = sets[i]->size();
+        });
+
+        coarsening_summary res{0, 0, 0};
+        for (std::size_t i = 0; i < sets.size(); ++i) {
+            res.intervals_before += before[i];
+            res.intervals_after += after[i];
+        }
+        res.bytes_reclaimed = (res.intervals_before - res.intervals_after) * interval_node_bytes;
+        if (compress)
+            this->compress_intervals();
+        return res;
+    }
 
-        time_t tb, te;
-        for (auto edge_it = graph.begin(); edge_it != graph.end(); ++edge_it) {
-            tb = std::stoull((*edge_it)[2]);
-            te = std::stoull((*edge_it)[3]);
-            this->add_edge_w_time((*edge_it)[0], (*edge_it)[1], tb, te);
+    template<typename DirectedS>
+    compression_summary LinkStreamBase<DirectedS>::compress_intervals()
+    {
+        compression_summary res{0, 0, 0};
+        if (shared_compressed) {
+            for (auto &p : *shared_compressed) {
+                res.intervals += p.second.size();
+                res.bytes_before += sizeof(TimeIntervalSet) + p.second.size() * interval_node_bytes;
+                res.bytes_after += p.second.memory_usage();
+            }
+            return res;
         }
 
-        graph.clear();
-        graph.shrink_to_fit();
+        ///< the map is built serially with empty sets, then the sets are filled in parallel
+        auto compressed = std::make_shared<CompressedIntervalMap>();
+        std::vector<std::pair<const TimeIntervalSet *, CompressedTimeIntervalSet *>> sets;
+        sets.reserve(shared_intervals->size());
+        for (auto &p : *shared_intervals)
+            sets.emplace_back(&p.second, &compressed->emplace_hint(compressed->end(), p.first,
+                                                                   CompressedTimeIntervalSet())->second);
+        std::vector<std::size_t> sizes(sets.size()), bytes(sets.size());
+        parallel_for(0, sets.size(), [&](std::size_t i) {
+            *sets[i].second = CompressedTimeIntervalSet(*sets[i].first);
+            sizes[i] = sets[i].first->size();
+            bytes[i] = sets[i].second->memory_usage();
+        });
+        for (std::size_t i = 0; i < sets.size(); ++i) {
+            res.intervals += sizes[i];
+            res.bytes_before += sizeof(TimeIntervalSet) + sizes[i] * interval_node_bytes;
+            res.bytes_after += bytes[i];
+        }
+        ///< the interval sets are freed here unless a copy of the link stream still shares them
+        shared_compressed = compressed;
+        shared_intervals.reset();
+        return res;
+    }
+
+    template<typename DirectedS>
+    void LinkStreamBase<DirectedS>::decompress_intervals()
+    {
+        if (!shared_compressed)
+            return;
+        auto decoded = std::make_shared<IntervalMap>();
+        std::vector<std::pair<const CompressedTimeIntervalSet *, TimeIntervalSet *>> sets;
+        sets.reserve(shared_compressed->size());
+        for (auto &p : *shared_compressed)
+            sets.emplace_back(&p.second, &decoded->emplace_hint(decoded->end(), p.first, TimeIntervalSet())->second);
+        parallel_for(0, sets.size(), [&](std::size_t i) {
+            *sets[i].second = sets[i].first->to_time_interval_set();
+        });
+        shared_intervals = decoded;
+        shared_compressed.reset();
+    }
+
+    template<typename DirectedS>
+    bool LinkStreamBase<DirectedS>::has_compressed_intervals() const
+    {
+        return static_cast<bool>(shared_compressed);
     }
 
 
@@ -164,12 +449,12 @@ namespace boost::bstream
 
         typename GraphBase<DirectedS>::edge_t e_exist;
         bool ok;
-        std::tie(e_exist, ok) = boost::edge(s, t, this->G);
+        std::tie(e_exist, ok) = boost::edge(s, t, this->graph());
         if (ok) {
             return e_exist;
         } else {
             auto e = GraphBase<DirectedS>::add_edge(s, t);
-            TimeIntervalSetVertexMap[e].append(interval_def.lower(), interval_def.upper());
+            this->mutable_intervals()[e].append(interval_def.lower(), interval_def.upper());
             return e;
         }
     }
@@ -202,13 +487,13 @@ namespace boost::bstream
             throw LinkStreamBaseException(msg.str());
         }
 
-        tie(edge_exist, ok) = boost::edge(s, t, this->G);
+        tie(edge_exist, ok) = boost::edge(s, t, this->graph());
         if (ok) {
-            TimeIntervalSetVertexMap[edge_exist].append(b, e);
+            this->mutable_intervals()[edge_exist].append(b, e);
             return edge_exist;
         } else {
             auto edge = GraphBase<DirectedS>::add_edge(s, t);
-            TimeIntervalSetVertexMap[edge].append(b, e);
+            this->mutable_intervals()[edge].append(b, e);
             return edge;
         }
     }
@@ -238,14 +523,15 @@ namespace boost::bstream
             this->add_vertex(t);
 
         ///< add edge
-        auto e = boost::edge(this->vertex(s), this->vertex(t), this->G);
+        auto e = boost::edge(this->vertex(s), this->vertex(t), this->graph());
         if (!e.second) {
             auto new_edge = GraphBase<DirectedS>::add_edge(s, t);
-            TimeIntervalSetVertexMap[new_edge] = tis;
+            this->mutable_intervals()[new_edge] = tis;
             return new_edge;
         } else {
+            auto &edge_tis = this->mutable_intervals()[e.first];
             for (auto tis_it = tis.begin(); tis_it != tis.end(); ++tis_it) {
-                TimeIntervalSetVertexMap[e.first].append(tis_it->lower(), tis_it->upper());
+                edge_tis.append(tis_it->lower(), tis_it->upper());
             }
             return e.first;
         }
@@ -264,27 +550,86 @@ namespace boost::bstream
             throw LinkStreamBaseException("Missing vertex");
 
         ///< add edge
-        auto e = boost::edge(s, t, this->G);
+        auto e = boost::edge(s, t, this->graph());
         if (!e.second) {
             auto new_edge = GraphBase<DirectedS>::add_edge(s, t);
-            TimeIntervalSetVertexMap[new_edge] = tis;
+            this->mutable_intervals()[new_edge] = tis;
             return new_edge;
         } else {
+            auto &edge_tis = this->mutable_intervals()[e.first];
             for (auto tis_it = tis.begin(); tis_it != tis.end(); ++tis_it) {
-                TimeIntervalSetVertexMap[e.first].append(tis_it->lower(), tis_it->upper());
+                edge_tis.append(tis_it->lower(), tis_it->upper());
             }
             return e.first;
         }
 
     }
 
+    template<typename DirectedS>
+    void LinkStreamBase<DirectedS>::add_edges_w_time(std::vector<contact_t> &contacts)
+    {
+        for (auto &c : contacts) {
+            if (!this->has_vertex(std::get<0>(c)) || !this->has_vertex(std::get<1>(c)))
+                throw LinkStreamBaseException("Missing vertex");
+            if (!icl::contains(interval_def, make_time_interval(std::get<2>(c), std::get<3>(c)))) {
+                std::ostringstream msg;
+                msg << "Edge TimeInterval " << make_time_interval(std::get<2>(c), std::get<3>(c))
+                    << "is not contains inside " << interval_def << endl;
+                throw LinkStreamBaseException(msg.str());
+            }
+            ///< an undirected edge is stored once whatever the order of its end points
+            if (!this->is_directed() && std::get<1>(c) < std::get<0>(c))
+                std::swap(std::get<0>(c), std::get<1>(c));
+        }
+        std::sort(contacts.begin(), contacts.end());
+
+        ///< look the edges up first, the shared adjacency is only copied if an edge must be created
+        std::vector<typename LinkStreamBase<DirectedS>::edge_t> found;
+        bool missing = boost::num_edges(this->graph()) == 0 && !contacts.empty();
+        for (std::size_t i = 0; i < contacts.size() && !missing; ++i) {
+            if (i > 0 && std::get<0>(contacts[i]) == std::get<0>(contacts[i - 1]) &&
+                std::get<1>(contacts[i]) == std::get<1>(contacts[i - 1]))
+                continue;
+            auto e = boost::edge(std::get<0>(contacts[i]), std::get<1>(contacts[i]), this->graph());
+            missing = !e.second;
+            found.push_back(e.first);
+        }
+        if (!missing) {
+            auto &intervals = this->mutable_intervals();
+            for (std::size_t i = 0, k = 0; i < contacts.size(); ++k) {
+                auto s = std::get<0>(contacts[i]), t = std::get<1>(contacts[i]);
+                auto &tis = intervals[found[k]];
+                for (; i < contacts.size() && std::get<0>(contacts[i]) == s && std::get<1>(contacts[i]) == t; ++i)
+                    tis.append(std::get<2>(contacts[i]), std::get<3>(contacts[i]));
+            }
+            return;
+        }
+
+        ///< a link stream without edges cannot contain any of the new edges
+        auto &G = this->mutable_graph();
+        auto &intervals = this->mutable_intervals();
+        bool fresh = boost::num_edges(G) == 0;
+        for (std::size_t i = 0; i < contacts.size();) {
+            auto s = std::get<0>(contacts[i]), t = std::get<1>(contacts[i]);
+            typename LinkStreamBase<DirectedS>::edge_t e;
+            bool ok = false;
+            if (!fresh)
+                std::tie(e, ok) = boost::edge(s, t, G);
+            if (!ok)
+                std::tie(e, ok) = boost::add_edge(s, t, G);
+            auto &tis = intervals[e];
+            for (; i < contacts.size() && std::get<0>(contacts[i]) == s && std::get<1>(contacts[i]) == t; ++i)
+                tis.append(std::get<2>(contacts[i]), std::get<3>(contacts[i]));
+        }
+    }
+
     template<typename DirectedS>
     TimeIntervalSet
     LinkStreamBase<DirectedS>::edge_tinterval_set(const std::string &s, const std::string &t)
     {
         auto e = this->edge(s, t);
         if (e.second)
-            return TimeIntervalSetVertexMap[e.first];
+            return this->intervals(e.first);
         else
             throw LinkStreamBaseException("edge doesn't exist");
     }
@@ -296,7 +641,7 @@ namespace boost::bstream
     {
         auto e = this->edge(s, t);
         if (e.second)
-            return TimeIntervalSetVertexMap[e.first];
+            return this->intervals(e.first);
         else
             throw LinkStreamBaseException("edge doesn't exist");
     }
@@ -305,7 +650,7 @@ namespace boost::bstream
     TimeIntervalSet
     LinkStreamBase<DirectedS>::edge_tinterval_set(const typename LinkStreamBase<DirectedS>::edge_t &e)
     {
-        return TimeIntervalSetVertexMap[e];
+        return this->intervals(e);
     }
 
     template<typename DirectedS>
@@ -315,10 +660,15 @@ namespace boost::bstream
             const typename LinkStreamBase<DirectedS>::vertex_t &t,
             time_t b, time_t e)
     {
-        auto res = boost::edge(s, t, this->G);
+        auto res = boost::edge(s, t, this->graph());
+        if (res.second && shared_compressed) {
+            auto it = shared_compressed->find(res.first);
+            res.second = it != shared_compressed->end() && it->second.contains(b, e);
+            return res;
+        }
         if (res.second) {
-            auto edge_tis = TimeIntervalSetVertexMap[res.first];
-            if (edge_tis.contains(b, e)) {
+            auto it = shared_intervals->find(res.first);
+            if (it != shared_intervals->end() && it->second.contains(b, e)) {
                 return res;
             } else {
                 res.second = false;
@@ -341,8 +691,8 @@ namespace boost::bstream
         time_t sum = 0;
         auto n_it = this->neighbors(v);
         for (auto it = n_it.first; it != n_it.second; ++it) {
-            auto e = boost::edge(v, *it, this->G);
-            sum += TimeIntervalSetVertexMap[e.first].length();
+            auto e = boost::edge(v, *it, this->graph());
+            sum += this->edge_tinterval_length(e.first);
         }
         return static_cast<double>(sum) / this->definition_length();
     }
@@ -369,7 +719,8 @@ namespace boost::bstream
 
         for(auto it = this->neighbors(v).first; it != this->neighbors(v).second; ++it){
             auto e = this->edge(v, *it);
-            for(auto ti = TimeIntervalSetVertexMap[e.first].begin(); ti != TimeIntervalSetVertexMap[e.first ].end(); ++ti){
+            auto edge_tis = this->intervals(e.first);
+            for(auto ti = edge_tis.begin(); ti != edge_tis.end(); ++ti){
                 auto map_it_lower = inst_degree.find((*ti).lower());
 
                 if ( map_it_lower != inst_degree.end() ) {
@@ -407,10 +758,13 @@ namespace boost::bstream
     template<typename DirectedS>
     void LinkStreamBase<DirectedS>::remove_vertex(const std::string &v)
     {
+        if (!this->has_vertex(v))
+            return;
+        auto &intervals = this->mutable_intervals();
         for (auto it = this->neighbors(v).first; it != this->neighbors(v).second; ++it) {
             auto edge = this->edge(this->vertex(v), *it);
             if (edge.second) {
-                TimeIntervalSetVertexMap.erase(edge.first);
+                intervals.erase(edge.first);
             }
         }
         GraphBase<DirectedS>::remove_vertex(v);
@@ -419,7 +773,12 @@ namespace boost::bstream
     template<typename DirectedS>
     time_t LinkStreamBase<DirectedS>::edge_tinterval_length(const typename LinkStreamBase<DirectedS>::edge_t &e)
     {
-        return TimeIntervalSetVertexMap[e].length();
+        if (shared_compressed) {
+            auto it = shared_compressed->find(e);
+            return it != shared_compressed->end() ? it->second.length() : 0;
+        }
+        auto it = shared_intervals->find(e);
+        return it != shared_intervals->end() ? it->second.length() : 0;
     }
 
     template<typename DirectedS>
@@ -13,12 +13,19 @@
 #ifndef BSTREAM_LINKSTREAM_HPP
 #define BSTREAM_LINKSTREAM_HPP
 
+#include <functional>
+#include <limits>
 #include <map>
+#include <memory>
+#include <set>
 #include <ctime>
 #include <stdexcept>
+#include <tuple>
+#include <vector>
 
 #include "GraphBase.hpp"
 #include "TimeIntervalSet.hpp"
+#include "CompressedTimeIntervalSet.hpp"
 
 namespace boost::bstream
 {
@@ -29,6 +36,52 @@ namespace boost::bstream
         {};
     };
 
+    /**
+     * @brief Outcome of LinkStreamBase::coarsen.
+     */
+    struct coarsening_summary
+    {
+        std::size_t intervals_before; ///< number of time intervals of the edges before the coarsening
+        std::size_t intervals_after;  ///< number of time intervals of the edges after the coarsening
+        std::size_t bytes_reclaimed;  ///< estimate of the memory released by the merged intervals
+    };
+
+    /**
+     * @brief Outcome of LinkStreamBase::compress_intervals.
+     */
+    struct compression_summary
+    {
+        std::size_t intervals;    ///< number of time intervals of the edges
+        std::size_t bytes_before; ///< estimate of the memory of the interval sets
+        std::size_t bytes_after;  ///< memory of the compressed interval sets
+    };
+
+    /**
+     * @brief Columns and filters of LinkStreamBase::read_csv.
+     *
+     * The filters are applied to every row while the file is read, before its vertices and time
+     * interval are created. The timestamps are first divided by time_unit, the beginning rounded
+     * down and the end rounded up as by LinkStreamBase::coarsen, the contacts shorter than
+     * min_duration are then skipped and the others clipped to [window_begin, window_end). The
+     * times are all expressed in the time unit.
+     */
+    struct csv_options
+    {
+        char delimiter = ',';
+        std::size_t source = 0; ///< column of the source vertex
+        std::size_t target = 1; ///< column of the target vertex
+        std::size_t begin = 2;  ///< column of the beginning of the contact
+        std::size_t end = 3;    ///< column of the end of the contact
+        bool header = false;    ///< the first row, after the comments, holds the column names
+        time_t time_unit = 1;   ///< length of the time unit in the timestamps of the file
+        time_t window_begin = std::numeric_limits<time_t>::min(); ///< contacts are clipped to the window
+        time_t window_end = std::numeric_limits<time_t>::max();
+        time_t min_duration = 0;                  ///< shorter contacts are skipped
+        std::set<std::string, std::less<>> allow; ///< if not empty, only the contacts between these vertices are kept
+        std::set<std::string, std::less<>> deny;  ///< the contacts of these vertices are skipped
+        bool compress = false; ///< compress the time intervals after the load, see LinkStreamBase::compress_intervals
+    };
+
     template<typename DirectedS>
     class LinkStreamBase : public GraphBase<DirectedS>
     {
@@ -36,6 +89,9 @@ namespace boost::bstream
         static const int default_min_interval = 0;
         static const int default_max_interval = 1000; ///< default interval [default_min_interval, default_max_interval)
 
+        typedef std::tuple<typename GraphBase<DirectedS>::vertex_t, typename GraphBase<DirectedS>::vertex_t,
+                time_t, time_t> contact_t; ///< (s, t, b, e), the edge (s, t) is present during [b, e)
+
         ///**************************************************************************************************
         ///
         ///  Constructor
@@ -60,6 +116,18 @@ namespace boost::bstream
 
         void set_definition(const time_t t1, time_t t2);
 
+        /**
+         * @brief Share the adjacency of g, and its time intervals and definition if g is a link
+         * stream. The time intervals are keyed by the edge_t of the adjacency, a graph without time
+         * intervals leaves the link stream without any.
+         */
+        virtual void copy_graph(const GraphBase<DirectedS> &g);
+
+        /**
+         * @brief Remove every vertex and edge with their time intervals, the definition is kept.
+         */
+        virtual void clear();
+
         std::pair<time_t, time_t> definition() const;
 
         time_t definition_length();
@@ -72,6 +140,58 @@ namespace boost::bstream
 
         void read_csv(std::string path, char delimiter = ',');
 
+        /**
+         * @brief Read the contacts of an edge file, the rows rejected by the filters of options being
+         * skipped while the file is tokenized.
+         *
+         * Only the labels of the kept rows are stored, and the definition interval is extended to the
+         * hull of the kept contacts. The vertices are created as by add_edge_w_time, the contacts
+         * are then inserted at once.
+         *
+         * @param path file path of the edge file, possibly compressed
+         * @param options columns and filters
+         */
+        void read_csv(const std::string &path, const csv_options &options);
+
+        /**
+         * @brief Quantize the timestamps and merge the close contacts of every edge.
+         *
+         * The timestamps are expressed in units of resolution, an interval [b, e) becoming
+         * [floor(b / resolution), ceil(e / resolution)) so that no contact vanishes, e.g. a
+         * resolution of 10^9 turns nanoseconds into seconds. The contacts of an edge separated by a
+         * gap shorter than max_gap, in the new unit, are then merged. The definition interval is
+         * rounded outward the same way. The time intervals of the edges are rewritten in a single
+         * parallel pass.
+         *
+         * @param resolution length of the new time unit, at least 1
+         * @param max_gap gaps shorter than max_gap are filled, 0 only joins the touching contacts
+         * @param compress compress the coarse time intervals, see compress_intervals
+         * @return the number of time intervals before and after, and the memory reclaimed
+         */
+        coarsening_summary coarsen(time_t resolution, time_t max_gap = 0, bool compress = false);
+
+        /**
+         * @brief Replace the time intervals of every edge by their compressed form, in parallel,
+         * the interval sets being released.
+         *
+         * While compressed, edge_tinterval_length reads the block headers, is_edge_active decodes
+         * a single block and edge_tinterval_set decodes the intervals of one edge. The first change
+         * of the time intervals decodes them back, see decompress_intervals. The compressed
+         * intervals are shared by the copies of the link stream, a copy made before the compression
+         * keeps the interval sets alive.
+         *
+         * @return the number of time intervals and the memory of the edges before and after
+         */
+        compression_summary compress_intervals();
+
+        /**
+         * @brief Decode the compressed time intervals back into interval sets, in parallel,
+         * nothing is done if they are not compressed.
+         */
+        void decompress_intervals();
+
+        bool has_compressed_intervals() const;
+
         ///**************************************************************************************************
         ///
         ///  Vertex method
@@ -124,6 +244,16 @@ namespace boost::bstream
                         const typename LinkStreamBase<DirectedS>::vertex_t &t,
                         TimeIntervalSet &tis);
 
+        /**
+         * @brief Bulk insertion of a batch of contacts.
+         *
+         * All the contacts are checked before the link stream is modified. They are then sorted by
+         * vertex pair so that every edge is looked up or created once and its intervals are inserted
+         * in chronological order. The vector is reordered in place.
+         *
+         * @param contacts vector of (s, t, b, e) between existing vertices
+         */
+        virtual void add_edges_w_time(std::vector<contact_t> &contacts);
 
         virtual TimeIntervalSet edge_tinterval_set(const std::string &s, const std::string &t);
 
@@ -156,8 +286,29 @@ namespace boost::bstream
 
 
     protected:
+        typedef std::map<typename LinkStreamBase<DirectedS>::edge_t, TimeIntervalSet> IntervalMap;
+
+        typedef std::map<typename LinkStreamBase<DirectedS>::edge_t, CompressedTimeIntervalSet> CompressedIntervalMap;
+
         TimeInterval interval_def;
-        std::map<typename LinkStreamBase<DirectedS>::edge_t, TimeIntervalSet> TimeIntervalSetVertexMap;
+        std::shared_ptr<IntervalMap> shared_intervals; ///< time intervals of the edges, null while compressed
+        std::shared_ptr<const CompressedIntervalMap> shared_compressed; ///< compressed time intervals, null if not compressed
+
+        /**
+         * @brief Time intervals of the edge e, empty if e has none, decoded if they are compressed.
+         */
+        TimeIntervalSet intervals(const typename LinkStreamBase<DirectedS>::edge_t &e) const;
+
+        /**
+         * @brief The time intervals for writing, first decoded if they are compressed or copied if
+         * they are shared with another link stream. Since copying a shared adjacency
+         * rekeys them, the edges added or removed by a method must be changed before calling
+         * mutable_intervals.
+         */
+        IntervalMap &mutable_intervals();
+
+        void relocate_edges(const std::vector<std::pair<typename LinkStreamBase<DirectedS>::edge_t,
+                typename LinkStreamBase<DirectedS>::edge_t>> &moved);
     };
 }
 
@@ -36,6 +36,8 @@ PYBIND11_MODULE(pybstream, m) {
     digraph_interface(m);
     tinterval_interface(m);
     tintervalset_interface(m);
+    flattintervalset_interface(m);
+    compressedtintervalset_interface(m);
     bipartite_interface(m);
     linkstream_interface(m);
     bilinkstream_interface(m);
@@ -54,6 +54,10 @@ Base class for undirected graphs.
 
     bilinkstream.def("num_top_vertices", &bs::BiLinkStream::num_top_vertices);
     bilinkstream.def("num_bottom_vertices", &bs::BiLinkStream::num_bottom_vertices);
+    bilinkstream.def("group_vertices", &bs::BiLinkStream::group_vertices, py::arg("group"),
+                     "vertices of a group, indexed by their group id");
+    bilinkstream.def("group_id", &bs::BiLinkStream::group_id, py::arg("v"),
+                     "dense index of a vertex within its group (top id or bottom id)");
     bilinkstream.def("print_edges", &bs::BiLinkStream::print_edges);
 
     ///**************************************************************************************************
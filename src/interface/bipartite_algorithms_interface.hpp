@@ -54,6 +54,42 @@ void bipartite_algorithms_interface(py::module &m)
         Graph: A graph that is the projection onto the given nodes.
 
     )pbdoc");
+
+    py::enum_<bs::projection_weight>(m, "projection_weight")
+            .value("co_presence", bs::projection_weight::co_presence)
+            .value("shared_neighbors", bs::projection_weight::shared_neighbors)
+            .value("jaccard", bs::projection_weight::jaccard)
+            .value("overlap", bs::projection_weight::overlap);
+
+    m.def("weighted_projected_graph", [](bs::vertex_group projection_node, bs::BiLinkStream& b,
+                                         bs::projection_weight weight, time_t min_overlap, std::size_t top_k){
+        bs::projection_options options;
+        options.weight = weight;
+        options.min_overlap = min_overlap;
+        options.top_k = top_k;
+        bs::Graph *g = new bs::Graph();
+        bs::weighted_projected_graph(projection_node, b, *g, options);
+        return g;
+    }, py::arg("projection_node"), py::arg("Bipartite"), py::arg("weight") = bs::projection_weight::co_presence,
+          py::arg("min_overlap") = 0, py::arg("top_k") = 0, R"pbdoc(
+    Returns the weighted projection of a bipartite link stream onto one of its node sets.
+
+    Two nodes are connected in G if they are both linked to a common neighbor at the same time.
+    The pairs co-present less than min_overlap are dropped and, if top_k is non zero, only the
+    top_k heaviest edges of every node are kept.
+
+    Args:
+        projection_node (int): Group Nodes to project onto (the "bottom" nodes or the top nodes).
+        B (BiLinkStream): The input bipartite link stream.
+        weight (projection_weight): co_presence (total co-presence duration), shared_neighbors,
+            jaccard or overlap (co-presence duration over the union or the smallest presence).
+        min_overlap (int): minimal co-presence duration of an edge.
+        top_k (int): number of edges kept per node, 0 to keep them all.
+
+    Returns:
+        Graph: A weighted graph that is the projection onto the given nodes.
+
+    )pbdoc");
 }
 
 
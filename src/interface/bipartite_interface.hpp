@@ -37,6 +37,12 @@ void bipartite_interface(py::module &m)
     bipartite.def("add_edge", py::overload_cast<const std::string&, const std::string&>(&bs::Bipartite::add_edge));
     bipartite.def("group", py::overload_cast<const bs::Graph::vertex_t&>(&bs::Bipartite::group));
     bipartite.def("group", py::overload_cast<const std::string&>(&bs::Bipartite::group));
+    bipartite.def("num_top_vertices", &bs::Bipartite::num_top_vertices);
+    bipartite.def("num_bottom_vertices", &bs::Bipartite::num_bottom_vertices);
+    bipartite.def("group_vertices", &bs::Bipartite::group_vertices, py::arg("group"),
+                  "vertices of a group, indexed by their group id");
+    bipartite.def("group_id", &bs::Bipartite::group_id, py::arg("v"),
+                  "dense index of a vertex within its group (top id or bottom id)");
     
     bipartite.def("__repr__", [](bs::Bipartite &g) {
         std::ostringstream out;
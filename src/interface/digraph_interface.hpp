@@ -51,6 +51,10 @@ void digraph_interface(py::module &m)
     digraph.def("is_directed", &bs::DiGraph::is_directed);
     digraph.def("add_vertex", &bs::DiGraph::add_vertex, py::arg("name")="");
     digraph.def("label", &bs::DiGraph::label);
+    digraph.def("numeric_labels", &bs::DiGraph::numeric_labels);
+    digraph.def("set_numeric_labels", &bs::DiGraph::set_numeric_labels, py::arg("numeric"));
+    digraph.def("max_numeric_gap", &bs::DiGraph::max_numeric_gap);
+    digraph.def("set_max_numeric_gap", &bs::DiGraph::set_max_numeric_gap, py::arg("gap"));
     digraph.def("add_edge", py::overload_cast<const bs::DiGraph::vertex_t&, const bs::DiGraph::vertex_t&>(&bs::DiGraph::add_edge));
     digraph.def("add_edge", py::overload_cast<const std::string&, const std::string&>(&bs::DiGraph::add_edge));
     digraph.def("num_vertices", &bs::DiGraph::num_vertices);
@@ -63,6 +67,10 @@ void digraph_interface(py::module &m)
     digraph.def("in_degree", py::overload_cast<const bs::DiGraph::vertex_t&>(&bs::DiGraph::in_degree));
     digraph.def("out_degree", py::overload_cast<const std::string&>(&bs::DiGraph::out_degree));
     digraph.def("out_degree", py::overload_cast<const bs::DiGraph::vertex_t&>(&bs::DiGraph::out_degree));
+    digraph.def("edge_weight", py::overload_cast<const std::string&, const std::string&>(&bs::DiGraph::edge_weight));
+    digraph.def("edge_weight", py::overload_cast<const bs::DiGraph::vertex_t&, const bs::DiGraph::vertex_t&>(&bs::DiGraph::edge_weight));
+    digraph.def("set_edge_weight", py::overload_cast<const std::string&, const std::string&, double>(&bs::DiGraph::set_edge_weight));
+    digraph.def("set_edge_weight", py::overload_cast<const bs::DiGraph::vertex_t&, const bs::DiGraph::vertex_t&, double>(&bs::DiGraph::set_edge_weight));
     digraph.def("adjacency", &bs::DiGraph::adjacency);
     digraph.def("read_csv", &bs::DiGraph::read_csv,py::arg("path"), py::arg("delimiter")=',');
 
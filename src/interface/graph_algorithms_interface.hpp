@@ -0,0 +1,492 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       graph_algorithms_interface.hpp
+/// @brief      Python interface for the algorithms on static graphs
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_GRAPH_ALGORITHMS_INTERFACE_HPP
+#define BSTREAM_GRAPH_ALGORITHMS_INTERFACE_HPP
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+#include <pybind11/eigen.h>
+
+namespace py = pybind11;
+namespace bs = boost::bstream;
+
+#include "core.hpp"
+#include "components.hpp"
+#include "traversal.hpp"
+#include "centrality.hpp"
+#include "community.hpp"
+#include "spectral.hpp"
+#include "ndarray_interface.hpp"
+#include "GraphType.hpp"
+
+void graph_algorithms_interface(py::module &m)
+{
+    ///**************************************************************************************************
+    ///
+    ///  Core decomposition
+    ///
+    ///**************************************************************************************************
+
+    m.def("core_number", [](bs::Graph &g) {
+        return as_ndarray(bs::core_number(g));
+    }, py::arg("G"));
+
+    m.def("core_number", [](bs::DiGraph &g) {
+        return as_ndarray(bs::core_number(g));
+    }, py::arg("G"), R"pbdoc(
+    Returns the core number of each vertex.
+
+    The core number of a vertex is the largest k such as the vertex belongs to a subgraph in
+    which every vertex has at least k neighbors. Self loops are ignored and the edges of a
+    directed graph are taken in both directions.
+
+    Args:
+        G (Graph): graph or directed graph.
+
+    Returns:
+        numpy.ndarray: core number of each vertex, indexed by vertex id.
+    )pbdoc");
+
+    m.def("k_core", [](bs::Graph &g, std::size_t k) {
+        bs::Graph *c = new bs::Graph();
+        bs::k_core(g, k, *c);
+        return c;
+    }, py::arg("G"), py::arg("k"));
+
+    m.def("k_core", [](bs::DiGraph &g, std::size_t k) {
+        bs::DiGraph *c = new bs::DiGraph();
+        bs::k_core(g, k, *c);
+        return c;
+    }, py::arg("G"), py::arg("k"), R"pbdoc(
+    Returns the k-core of G, the maximal subgraph in which every vertex has at least k neighbors.
+
+    Args:
+        G (Graph): graph or directed graph.
+        k (int): minimum degree.
+
+    Returns:
+        Graph: the k-core of G.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Connected components
+    ///
+    ///**************************************************************************************************
+
+    m.def("connected_components", [](bs::Graph &g) {
+        return as_ndarray(bs::connected_components(g));
+    }, py::arg("G"));
+
+    m.def("connected_components", [](bs::DiGraph &g) {
+        return as_ndarray(bs::connected_components(g));
+    }, py::arg("G"), R"pbdoc(
+    Returns the connected components of G, the weakly connected components if G is directed.
+
+    Args:
+        G (Graph): graph or directed graph.
+
+    Returns:
+        numpy.ndarray: component of each vertex indexed by vertex id, the components are numbered
+        from 0 in the order of their first vertex.
+    )pbdoc");
+
+    m.def("number_connected_components", &bs::number_connected_components<boost::undirectedS>, py::arg("G"));
+    m.def("number_connected_components", &bs::number_connected_components<boost::bidirectionalS>, py::arg("G"),
+          R"pbdoc(
+    Returns the number of connected components of G, weakly connected if G is directed.
+    )pbdoc");
+
+    m.def("strongly_connected_components", [](bs::DiGraph &g) {
+        return as_ndarray(bs::strongly_connected_components(g));
+    }, py::arg("G"), R"pbdoc(
+    Returns the strongly connected components of a directed graph.
+
+    Args:
+        G (DiGraph): directed graph.
+
+    Returns:
+        numpy.ndarray: component of each vertex indexed by vertex id, the components are numbered
+        from 0 in the order of their first vertex.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Traversal and shortest paths
+    ///
+    ///**************************************************************************************************
+
+    m.def("bfs", [](bs::Graph &g, const std::string &source) {
+        return as_ndarray(bs::bfs(g, g.vertex(source)));
+    }, py::arg("G"), py::arg("source"));
+
+    m.def("bfs", [](bs::DiGraph &g, const std::string &source) {
+        return as_ndarray(bs::bfs(g, g.vertex(source)));
+    }, py::arg("G"), py::arg("source"), R"pbdoc(
+    Breadth first search from a vertex.
+
+    The levels are expanded top-down or bottom-up depending on the size of the frontier, in
+    parallel.
+
+    Args:
+        G (Graph): graph or directed graph.
+        source (str): label of the source vertex.
+
+    Returns:
+        numpy.ndarray: number of hops from the source to each vertex indexed by vertex id, -1 for
+        unreachable vertices.
+    )pbdoc");
+
+    m.def("multi_source_bfs", [](bs::Graph &g, const std::vector<std::string> &sources) {
+        std::vector<std::size_t> ids;
+        for (auto &label : sources)
+            ids.push_back(g.vertex(label));
+        return as_ndarray(bs::multi_source_bfs(g, ids));
+    }, py::arg("G"), py::arg("sources"));
+
+    m.def("multi_source_bfs", [](bs::DiGraph &g, const std::vector<std::string> &sources) {
+        std::vector<std::size_t> ids;
+        for (auto &label : sources)
+            ids.push_back(g.vertex(label));
+        return as_ndarray(bs::multi_source_bfs(g, ids));
+    }, py::arg("G"), py::arg("sources"), R"pbdoc(
+    Breadth first search from several vertices at once.
+
+    Args:
+        G (Graph): graph or directed graph.
+        sources (list): labels of the source vertices.
+
+    Returns:
+        numpy.ndarray: number of hops from the closest source to each vertex indexed by vertex id,
+        -1 for unreachable vertices.
+    )pbdoc");
+
+    m.def("shortest_path", [](bs::Graph &g, const std::string &s, const std::string &t) {
+        std::vector<std::string> path;
+        for (auto v : bs::shortest_path(g, g.vertex(s), g.vertex(t)))
+            path.push_back(g.label(v));
+        return path;
+    }, py::arg("G"), py::arg("source"), py::arg("target"));
+
+    m.def("shortest_path", [](bs::DiGraph &g, const std::string &s, const std::string &t) {
+        std::vector<std::string> path;
+        for (auto v : bs::shortest_path(g, g.vertex(s), g.vertex(t)))
+            path.push_back(g.label(v));
+        return path;
+    }, py::arg("G"), py::arg("source"), py::arg("target"), R"pbdoc(
+    Returns one of the shortest paths, in number of hops, from source to target.
+
+    Args:
+        G (Graph): graph or directed graph.
+        source (str): label of the first vertex.
+        target (str): label of the last vertex.
+
+    Returns:
+        list: labels of the vertices of the path, empty if target is not reachable.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Centrality
+    ///
+    ///**************************************************************************************************
+
+    m.def("betweenness_centrality", [](bs::Graph &g, bool normalized, std::size_t k, unsigned seed) {
+        return as_ndarray(bs::betweenness_centrality(g, normalized, k, seed));
+    }, py::arg("G"), py::arg("normalized") = true, py::arg("k") = 0, py::arg("seed") = 0);
+
+    m.def("betweenness_centrality", [](bs::DiGraph &g, bool normalized, std::size_t k, unsigned seed) {
+        return as_ndarray(bs::betweenness_centrality(g, normalized, k, seed));
+    }, py::arg("G"), py::arg("normalized") = true, py::arg("k") = 0, py::arg("seed") = 0, R"pbdoc(
+    Betweenness centrality of the vertices, computed in parallel over the sources.
+
+    Args:
+        G (Graph): graph or directed graph.
+        normalized (bool): divide by (n-1)(n-2), otherwise the values of undirected graphs
+            are halved, as in networkx.
+        k (int): if non zero, approximate the betweenness from k sources sampled uniformly.
+        seed (int): seed of the sampling.
+
+    Returns:
+        numpy.ndarray: betweenness of each vertex indexed by vertex id.
+    )pbdoc");
+
+    m.def("pagerank", [](bs::Graph &g, double alpha, double tol, std::size_t max_iter) {
+        bs::power_iteration_options options;
+        options.tolerance = tol;
+        options.max_iterations = max_iter;
+        return as_ndarray(bs::pagerank(g, alpha, options));
+    }, py::arg("G"), py::arg("alpha") = 0.85, py::arg("tol") = 1e-6, py::arg("max_iter") = 100);
+
+    m.def("pagerank", [](bs::DiGraph &g, double alpha, double tol, std::size_t max_iter) {
+        bs::power_iteration_options options;
+        options.tolerance = tol;
+        options.max_iterations = max_iter;
+        return as_ndarray(bs::pagerank(g, alpha, options));
+    }, py::arg("G"), py::arg("alpha") = 0.85, py::arg("tol") = 1e-6, py::arg("max_iter") = 100, R"pbdoc(
+    PageRank of the vertices, computed by power iteration with parallel sparse products.
+
+    The conventions are those of networkx: the walk follows the out-edges proportionally to
+    their weight and the vertices without out-edges jump uniformly.
+
+    Args:
+        G (Graph): graph or directed graph, with non negative weights.
+        alpha (float): damping factor.
+        tol (float): stop when the l1 change of the scores is below n * tol.
+        max_iter (int): maximum number of iterations, an exception is raised past it.
+
+    Returns:
+        numpy.ndarray: PageRank of each vertex indexed by vertex id.
+    )pbdoc");
+
+    m.def("personalized_pagerank", [](bs::Graph &g, const Eigen::MatrixXd &seeds, double alpha, double tol,
+                                      std::size_t max_iter) {
+        bs::power_iteration_options options;
+        options.tolerance = tol;
+        options.max_iterations = max_iter;
+        return bs::personalized_pagerank(g, seeds, alpha, options);
+    }, py::arg("G"), py::arg("seeds"), py::arg("alpha") = 0.85, py::arg("tol") = 1e-6, py::arg("max_iter") = 100);
+
+    m.def("personalized_pagerank", [](bs::DiGraph &g, const Eigen::MatrixXd &seeds, double alpha, double tol,
+                                      std::size_t max_iter) {
+        bs::power_iteration_options options;
+        options.tolerance = tol;
+        options.max_iterations = max_iter;
+        return bs::personalized_pagerank(g, seeds, alpha, options);
+    }, py::arg("G"), py::arg("seeds"), py::arg("alpha") = 0.85, py::arg("tol") = 1e-6, py::arg("max_iter") = 100,
+    R"pbdoc(
+    Personalized PageRank of several personalization vectors at once.
+
+    All the vectors are iterated together, every edge being read once per iteration for all
+    of them.
+
+    Args:
+        G (Graph): graph or directed graph, with non negative weights.
+        seeds (numpy.ndarray): n x k matrix whose columns are the personalization vectors,
+            indexed by vertex id, non negative and normalized to sum 1.
+        alpha (float): damping factor.
+        tol (float): stop when the l1 change of every column is below n * tol.
+        max_iter (int): maximum number of iterations, an exception is raised past it.
+
+    Returns:
+        numpy.ndarray: n x k matrix of the PageRank of each vertex for each column of seeds.
+    )pbdoc");
+
+    m.def("katz_centrality", [](bs::Graph &g, double alpha, double beta, bool normalized, double tol,
+                                std::size_t max_iter) {
+        bs::power_iteration_options options;
+        options.tolerance = tol;
+        options.max_iterations = max_iter;
+        return as_ndarray(bs::katz_centrality(g, alpha, beta, normalized, options));
+    }, py::arg("G"), py::arg("alpha") = 0.1, py::arg("beta") = 1.0, py::arg("normalized") = true,
+    py::arg("tol") = 1e-6, py::arg("max_iter") = 1000);
+
+    m.def("katz_centrality", [](bs::DiGraph &g, double alpha, double beta, bool normalized, double tol,
+                                std::size_t max_iter) {
+        bs::power_iteration_options options;
+        options.tolerance = tol;
+        options.max_iterations = max_iter;
+        return as_ndarray(bs::katz_centrality(g, alpha, beta, normalized, options));
+    }, py::arg("G"), py::arg("alpha") = 0.1, py::arg("beta") = 1.0, py::arg("normalized") = true,
+    py::arg("tol") = 1e-6, py::arg("max_iter") = 1000, R"pbdoc(
+    Katz centrality of the vertices, the fixed point of x = alpha A^T x + beta, computed by
+    power iteration with parallel sparse products (networkx conventions).
+
+    Args:
+        G (Graph): graph or directed graph, with non negative weights.
+        alpha (float): attenuation factor, smaller than the inverse of the largest eigenvalue
+            of the weighted adjacency matrix.
+        beta (float): weight given to every vertex.
+        normalized (bool): divide the scores by their euclidean norm.
+        tol (float): stop when the l1 change of the scores is below n * tol.
+        max_iter (int): maximum number of iterations, an exception is raised past it.
+
+    Returns:
+        numpy.ndarray: Katz centrality of each vertex indexed by vertex id.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Community detection
+    ///
+    ///**************************************************************************************************
+
+    m.def("louvain", [](bs::Graph &g, double resolution, bool refine, std::size_t max_levels) {
+        bs::louvain_options options;
+        options.resolution = resolution;
+        options.refine = refine;
+        options.max_levels = max_levels;
+        auto result = bs::louvain(g, options);
+        return py::make_tuple(as_ndarray(std::move(result.membership)), result.modularity);
+    }, py::arg("G"), py::arg("resolution") = 1.0, py::arg("refine") = true, py::arg("max_levels") = 32, R"pbdoc(
+    Communities of the vertices found by modularity maximization with the Louvain method,
+    computed in parallel.
+
+    Args:
+        G (Graph): graph, the edge weights must be non negative.
+        resolution (float): weight of the null model, larger values give smaller communities.
+        refine (bool): split the communities in connected parts between the levels (Leiden),
+            the communities returned are then connected.
+        max_levels (int): maximum number of aggregation levels.
+
+    Returns:
+        tuple: (membership, modularity), the community of each vertex indexed by vertex id,
+        numbered from 0, and the modularity of the partition.
+    )pbdoc");
+
+    m.def("modularity", [](bs::Graph &g, const std::vector<std::size_t> &membership, double resolution) {
+        return bs::modularity(g, membership, resolution);
+    }, py::arg("G"), py::arg("membership"), py::arg("resolution") = 1.0, R"pbdoc(
+    Modularity of a partition of the vertices, with the edge weights (networkx convention).
+
+    Args:
+        G (Graph): graph.
+        membership (list): community of each vertex indexed by vertex id, smaller than the
+            number of vertices.
+        resolution (float): weight of the null model.
+
+    Returns:
+        float: the modularity.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Spectral analysis
+    ///
+    ///**************************************************************************************************
+
+    py::enum_<bs::spectral_matrix>(m, "spectral_matrix")
+            .value("adjacency", bs::spectral_matrix::adjacency)
+            .value("laplacian", bs::spectral_matrix::laplacian)
+            .value("normalized_laplacian", bs::spectral_matrix::normalized_laplacian);
+
+    py::enum_<bs::spectrum_end>(m, "spectrum_end")
+            .value("largest", bs::spectrum_end::largest)
+            .value("smallest", bs::spectrum_end::smallest);
+
+    m.def("laplacian", [](bs::Graph &g) {
+        return bs::laplacian(g);
+    }, py::arg("G"), R"pbdoc(
+    Laplacian matrix D - A, D being the diagonal of the weighted degrees.
+
+    Args:
+        G (Graph): graph.
+
+    Returns:
+        scipy.sparse.csc_matrix: n x n Laplacian indexed by vertex id.
+    )pbdoc");
+
+    m.def("laplacian", [](bs::DiGraph &g) {
+        return bs::laplacian(g);
+    }, py::arg("G"), R"pbdoc(
+    Laplacian matrix D - A, D being the diagonal of the weighted out-degrees.
+
+    Args:
+        G (DiGraph): directed graph.
+
+    Returns:
+        scipy.sparse.csc_matrix: n x n Laplacian indexed by vertex id.
+    )pbdoc");
+
+    m.def("normalized_laplacian", [](bs::Graph &g) {
+        return bs::normalized_laplacian(g);
+    }, py::arg("G"), R"pbdoc(
+    Normalized Laplacian D^-1/2 (D - A) D^-1/2, null on the vertices of degree 0.
+
+    Args:
+        G (Graph): graph.
+
+    Returns:
+        scipy.sparse.csc_matrix: n x n normalized Laplacian indexed by vertex id.
+    )pbdoc");
+
+    m.def("normalized_laplacian", [](bs::DiGraph &g) {
+        return bs::normalized_laplacian(g);
+    }, py::arg("G"), R"pbdoc(
+    Normalized Laplacian D^-1/2 (D - A) D^-1/2 with the out-degrees, null on the vertices of
+    out-degree 0.
+
+    Args:
+        G (DiGraph): directed graph.
+
+    Returns:
+        scipy.sparse.csc_matrix: n x n normalized Laplacian indexed by vertex id.
+    )pbdoc");
+
+    m.def("eigenpairs", [](bs::Graph &g, std::size_t k, bs::spectral_matrix matrix, bs::spectrum_end end, double tol,
+                           std::size_t basis_size, std::uint64_t seed) {
+        bs::lanczos_options options;
+        options.tolerance = tol;
+        options.basis_size = basis_size;
+        options.seed = seed;
+        auto result = bs::graph_eigenpairs(g, k, matrix, end, options);
+        return py::make_tuple(result.values, result.vectors);
+    }, py::arg("G"), py::arg("k"), py::arg("matrix") = bs::spectral_matrix::adjacency,
+    py::arg("end") = bs::spectrum_end::largest, py::arg("tol") = 1e-8, py::arg("basis_size") = 0,
+    py::arg("seed") = 0, R"pbdoc(
+    Eigenpairs at one end of the spectrum of the adjacency or Laplacian matrix, computed by the
+    thick restart Lanczos method with parallel sparse products.
+
+    Args:
+        G (Graph): undirected graph.
+        k (int): number of eigenpairs.
+        matrix (spectral_matrix): adjacency, laplacian or normalized_laplacian.
+        end (spectrum_end): largest or smallest eigenvalues.
+        tol (float): residual of the eigenpairs relative to the largest eigenvalue found.
+        basis_size (int): number of Lanczos vectors kept in memory, 0 for max(2k + 1, 20).
+        seed (int): seed of the starting vector.
+
+    Returns:
+        tuple: (values, vectors), the k eigenvalues from the requested end and the n x k matrix
+        of the orthonormal eigenvectors indexed by vertex id.
+    )pbdoc");
+
+    m.def("algebraic_connectivity", [](bs::Graph &g, bool normalized, double tol) {
+        bs::lanczos_options options;
+        options.tolerance = tol;
+        return bs::algebraic_connectivity(g, normalized, options);
+    }, py::arg("G"), py::arg("normalized") = false, py::arg("tol") = 1e-8, R"pbdoc(
+    Algebraic connectivity, the second smallest eigenvalue of the Laplacian, 0 for a
+    disconnected graph.
+
+    Args:
+        G (Graph): undirected graph with at least 2 vertices.
+        normalized (bool): use the normalized Laplacian.
+        tol (float): tolerance of the Lanczos method.
+
+    Returns:
+        float: the algebraic connectivity.
+    )pbdoc");
+
+    m.def("spectral_embedding", [](bs::Graph &g, std::size_t dimension, double tol, std::uint64_t seed) {
+        bs::lanczos_options options;
+        options.tolerance = tol;
+        options.seed = seed;
+        return bs::spectral_embedding(g, dimension, options);
+    }, py::arg("G"), py::arg("dimension") = 2, py::arg("tol") = 1e-8, py::arg("seed") = 0, R"pbdoc(
+    Laplacian eigenmaps of the vertices (Belkin and Niyogi).
+
+    Args:
+        G (Graph): undirected graph with more than dimension vertices.
+        dimension (int): dimension of the embedding.
+        tol (float): tolerance of the Lanczos method.
+        seed (int): seed of the starting vector.
+
+    Returns:
+        numpy.ndarray: n x dimension matrix of the coordinates of the vertices indexed by vertex id,
+        the vertices of degree 0 are at the origin.
+    )pbdoc");
+}
+
+#endif //BSTREAM_GRAPH_ALGORITHMS_INTERFACE_HPP
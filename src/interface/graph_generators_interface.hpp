@@ -16,6 +16,7 @@ namespace py = pybind11;
 namespace bs = boost::bstream;
 
 #include "generators/erdos_reny.hpp"
+#include "generators/link_stream_generators.hpp"
 #include "GraphType.hpp"
 
 void graph_generators_interface(py::module &m)
@@ -27,15 +28,15 @@ void graph_generators_interface(py::module &m)
     ///
     ///**************************************************************************************************
 
-    m.def("erdos_renyi_graph", [](int n, float p, bool directed, int seed) {
+    m.def("erdos_renyi_graph", [](int n, float p, bool directed, int seed, bool labels) {
               if (directed) {
                   bs::DiGraph *g = new bs::DiGraph();
-                  bs::erdos_renyi_graph(n, p, *g, seed);
+                  bs::erdos_renyi_graph(n, p, *g, seed, labels);
                   bs::GraphAbstract *ga = g;
                   return ga;
               } else {
                   bs::Graph *g = new bs::Graph();
-                  bs::erdos_renyi_graph(n, p, *g, seed);
+                  bs::erdos_renyi_graph(n, p, *g, seed, labels);
                   bs::GraphAbstract *ga = g;
                   return ga;
               }
@@ -44,6 +45,7 @@ void graph_generators_interface(py::module &m)
           py::arg("p"),
           py::arg("directed") = false,
           py::arg("seed") = 0,
+          py::arg("labels") = true,
           R"pbdoc(
     Returns a :math:`G_{n,p}` random graph, also known as an Erdős-Rényi graph.
 
@@ -54,6 +56,8 @@ void graph_generators_interface(py::module &m)
         p (float): Probability for edge creation.
         directed (bool, optional): If True, this function returns a directed graph (default=False).
         seed (int, optional): Seed for random number generator (default=0).
+        labels (bool, optional): If False, the vertices are not given a label, which saves time and
+            memory on large graphs (default=True).
 
     Returns:
         Graph: directed or undirected
@@ -68,6 +72,140 @@ void graph_generators_interface(py::module &m)
         .. [2] Bollobás, B., Random Graphs, Cambridge University Press, (2001). `[DOI] <https://doi.org/10.1017/CBO9780511814068>`_
     )pbdoc");
 
+    ///**************************************************************************************************
+    ///
+    ///  Link stream generators
+    ///
+    ///**************************************************************************************************
+
+    py::enum_<bs::duration_law>(m, "duration_law")
+            .value("constant", bs::duration_law::constant)
+            .value("exponential", bs::duration_law::exponential)
+            .value("power_law", bs::duration_law::power_law);
+
+    auto make_process = [](double rate, bs::duration_law law, double duration, double exponent) {
+        bs::contact_process process;
+        process.rate = rate;
+        process.law = law;
+        process.duration = duration;
+        process.exponent = exponent;
+        return process;
+    };
+
+    m.def("contact_process_link_stream", [make_process](std::size_t n, const std::string &backbone, double p,
+                                                        std::size_t m_edges, time_t tb, time_t te, double rate,
+                                                        bs::duration_law law, double duration, double exponent,
+                                                        std::uint64_t seed) {
+              bs::counter_rng keys(seed, 0);
+              bs::edge_list edges;
+              if (backbone == "erdos_renyi")
+                  edges = bs::erdos_renyi_edges(n, p, keys());
+              else if (backbone == "barabasi_albert")
+                  edges = bs::barabasi_albert_edges(n, m_edges, keys());
+              else
+                  throw bs::GraphBaseException("unknown backbone " + backbone);
+              auto *g = new bs::LinkStream(tb, te);
+              bs::contact_process_link_stream(n, edges, make_process(rate, law, duration, exponent), *g, keys());
+              return g;
+          },
+          py::arg("n"),
+          py::arg("backbone") = "erdos_renyi",
+          py::arg("p") = 0.01,
+          py::arg("m") = 1,
+          py::arg("t_begin") = 0,
+          py::arg("t_end") = 1000,
+          py::arg("rate") = 0.01,
+          py::arg("law") = bs::duration_law::exponential,
+          py::arg("duration") = 1.0,
+          py::arg("exponent") = 2.5,
+          py::arg("seed") = 0,
+          R"pbdoc(
+    Returns a link stream of Poisson contacts on the edges of a random backbone.
+
+    Every edge of the backbone carries contacts starting at the arrival times of a Poisson
+    process of the given rate, with a constant, exponential or power law duration.
+
+    Args:
+        n (int): The number of nodes.
+        backbone (str): "erdos_renyi" (edge probability p) or "barabasi_albert" (m edges per node).
+        t_begin (int), t_end (int): definition interval of the link stream.
+        rate (float): contact rate of every edge.
+        law (duration_law): law of the contact durations.
+        duration (float): duration, mean duration or minimum duration of the power law.
+        exponent (float): exponent of the power law.
+        seed (int, optional): the output only depends on the seed, not on the number of threads.
+
+    Returns:
+        LinkStream
+    )pbdoc");
+
+    m.def("stochastic_block_link_stream", [make_process](const std::vector<std::size_t> &sizes,
+                                                         const std::vector<std::vector<double>> &probs,
+                                                         time_t tb, time_t te, double rate, bs::duration_law law,
+                                                         double duration, double exponent, std::uint64_t seed) {
+              bs::counter_rng keys(seed, 0);
+              auto edges = bs::stochastic_block_model_edges(sizes, probs, keys());
+              std::size_t n = 0;
+              for (auto size : sizes)
+                  n += size;
+              auto *g = new bs::LinkStream(tb, te);
+              bs::contact_process_link_stream(n, edges, make_process(rate, law, duration, exponent), *g, keys());
+              return g;
+          },
+          py::arg("sizes"), py::arg("probs"), py::arg("t_begin") = 0, py::arg("t_end") = 1000,
+          py::arg("rate") = 0.01, py::arg("law") = bs::duration_law::exponential, py::arg("duration") = 1.0,
+          py::arg("exponent") = 2.5, py::arg("seed") = 0,
+          "Link stream of Poisson contacts on the edges of a stochastic block model.");
+
+    m.def("activity_driven_link_stream", [](std::size_t n, double gamma, double epsilon, double eta, std::size_t m_edges,
+                                            time_t tb, time_t te, time_t dt, std::uint64_t seed) {
+              bs::counter_rng keys(seed, 0);
+              auto activity = bs::power_law_activities(n, gamma, epsilon, keys());
+              for (auto &a : activity)
+                  a *= eta;
+              auto *g = new bs::LinkStream(tb, te);
+              bs::activity_driven_link_stream(activity, m_edges, dt, *g, keys());
+              return g;
+          },
+          py::arg("n"), py::arg("gamma") = 2.1, py::arg("epsilon") = 0.001, py::arg("eta") = 1.0, py::arg("m") = 1,
+          py::arg("t_begin") = 0, py::arg("t_end") = 1000, py::arg("dt") = 1, py::arg("seed") = 0,
+          R"pbdoc(
+    Returns an activity-driven link stream (Perra et al.).
+
+    The activities follow F(a) ~ a^-gamma on [epsilon, 1] and are multiplied by eta. At every
+    step of length dt an active node creates m contacts of duration dt with random nodes.
+    )pbdoc");
+
+    m.def("contact_process_bipartite_link_stream", [make_process](std::size_t num_top, std::size_t num_bottom, double p,
+                                                                  time_t tb, time_t te, double rate,
+                                                                  bs::duration_law law, double duration,
+                                                                  double exponent, std::uint64_t seed) {
+              auto *g = new bs::BiLinkStream(tb, te);
+              bs::contact_process_bipartite_link_stream(num_top, num_bottom, p,
+                                                        make_process(rate, law, duration, exponent), *g, seed);
+              return g;
+          },
+          py::arg("num_top"), py::arg("num_bottom"), py::arg("p") = 0.01, py::arg("t_begin") = 0,
+          py::arg("t_end") = 1000, py::arg("rate") = 0.01, py::arg("law") = bs::duration_law::exponential,
+          py::arg("duration") = 1.0, py::arg("exponent") = 2.5, py::arg("seed") = 0,
+          "Bipartite link stream of Poisson contacts on a random bipartite backbone.");
+
+    m.def("activity_driven_bipartite_link_stream", [](std::size_t num_top, std::size_t num_bottom, double gamma,
+                                                      double epsilon, double eta, std::size_t m_edges, time_t tb,
+                                                      time_t te, time_t dt, std::uint64_t seed) {
+              bs::counter_rng keys(seed, 0);
+              auto activity = bs::power_law_activities(num_top, gamma, epsilon, keys());
+              for (auto &a : activity)
+                  a *= eta;
+              auto *g = new bs::BiLinkStream(tb, te);
+              bs::activity_driven_bipartite_link_stream(activity, num_bottom, m_edges, dt, *g, keys());
+              return g;
+          },
+          py::arg("num_top"), py::arg("num_bottom"), py::arg("gamma") = 2.1, py::arg("epsilon") = 0.001,
+          py::arg("eta") = 1.0, py::arg("m") = 1, py::arg("t_begin") = 0, py::arg("t_end") = 1000,
+          py::arg("dt") = 1, py::arg("seed") = 0,
+          "Bipartite activity-driven link stream: active top nodes (users) contact m bottom nodes (antennas).");
+
 }
 
 #endif //BSTREAM_GRAPH_GENERATORS_INTERFACE_HPP
@@ -68,7 +68,8 @@ Constructors of the Graph class
 
 Args:
     num_vertices (int): Construct a graph with `num_vertex` initial node.
-    Graph: Graph to copy from.
+    Graph: Graph to copy from, the copy shares the vertices and edges of Graph until one of them is
+        modified.
 )pbdoc"
     );
 
@@ -129,6 +130,52 @@ Returns:
 )pbdoc"
     );
 
+    graph.def("numeric_labels", &bs::Graph::numeric_labels,
+              R"pbdoc(
+Return True if the graph is in numeric label mode.
+
+Returns:
+    bool: numeric label mode
+)pbdoc");
+
+    graph.def("set_numeric_labels", &bs::Graph::set_numeric_labels,
+              py::arg("numeric"),
+              R"pbdoc(
+Switch the numeric label mode on or off.
+
+In numeric label mode the label of a vertex is the decimal string of its id, computed on demand, and
+no label index is stored, which saves memory on integer-keyed datasets. Adding the vertex "k" beyond
+the last vertex also adds the missing vertices in between, at most max_numeric_gap() of them.
+
+Args:
+    numeric (bool): numeric label mode
+
+Examples:
+    >>> G = Graph()
+    >>> G.set_numeric_labels(True)
+    >>> G.add_edge('4', '1')
+    >>> G.num_vertices()
+    5
+)pbdoc");
+
+    graph.def("max_numeric_gap", &bs::Graph::max_numeric_gap,
+              R"pbdoc(
+Return the maximum number of missing vertices added by a single numeric label.
+
+Returns:
+    int: maximum gap
+)pbdoc");
+
+    graph.def("set_max_numeric_gap", &bs::Graph::set_max_numeric_gap,
+              py::arg("gap"),
+              R"pbdoc(
+Set the maximum number of missing vertices added by a single numeric label, a vertex further away
+raises an exception instead of allocating every vertex up to it.
+
+Args:
+    gap (int): maximum gap
+)pbdoc");
+
     graph.def("labels", &bs::Graph::labels,
               R"pbdoc(
 Return the list of vertex labels
@@ -254,6 +301,41 @@ Returns:
 )pbdoc"
     );
 
+    graph.def("edge_weight", py::overload_cast<const std::string &, const std::string &>(&bs::Graph::edge_weight),
+              py::arg("s"), py::arg("t"));
+
+    graph.def("edge_weight",
+              py::overload_cast<const bs::Graph::vertex_t &, const bs::Graph::vertex_t &>(&bs::Graph::edge_weight),
+              py::arg("s"), py::arg("t"),
+              R"pbdoc(
+Return the weight of the edge (s, t), 1 unless it was set with set_edge_weight.
+
+Args:
+    s (str, int): vertex id or a vertex label
+    t (str, int): vertex id or a vertex label
+
+Returns:
+    float: weight of the edge
+)pbdoc"
+    );
+
+    graph.def("set_edge_weight",
+              py::overload_cast<const std::string &, const std::string &, double>(&bs::Graph::set_edge_weight),
+              py::arg("s"), py::arg("t"), py::arg("weight"));
+
+    graph.def("set_edge_weight",
+              py::overload_cast<const bs::Graph::vertex_t &, const bs::Graph::vertex_t &, double>(&bs::Graph::set_edge_weight),
+              py::arg("s"), py::arg("t"), py::arg("weight"),
+              R"pbdoc(
+Set the weight of the edge (s, t), the weight is used by the adjacency matrix.
+
+Args:
+    s (str, int): vertex id or a vertex label
+    t (str, int): vertex id or a vertex label
+    weight (float): weight of the edge
+)pbdoc"
+    );
+
     graph.def("adjacency", &bs::Graph::adjacency,
               R"pbdoc(
 Return the adjacency matrix of the Graph
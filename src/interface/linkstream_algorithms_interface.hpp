@@ -0,0 +1,382 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       linkstream_algorithms_interface.hpp
+/// @brief      Python interface for the algorithms related to link streams
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_LINKSTREAM_ALGORITHMS_INTERFACE_HPP
+#define BSTREAM_LINKSTREAM_ALGORITHMS_INTERFACE_HPP
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/eigen.h>
+
+namespace py = pybind11;
+namespace bs = boost::bstream;
+
+#include "operators.hpp"
+#include "aggregation.hpp"
+#include "core.hpp"
+#include "components.hpp"
+#include "temporal_centrality.hpp"
+#include "temporal_motifs.hpp"
+#include "contact_statistics.hpp"
+#include "ndarray_interface.hpp"
+#include "GraphType.hpp"
+
+void linkstream_algorithms_interface(py::module &m)
+{
+    ///**************************************************************************************************
+    ///
+    ///  Set operations between link streams
+    ///
+    ///**************************************************************************************************
+
+    m.def("union", [](bs::LinkStream &a, bs::LinkStream &b) {
+        bs::LinkStream *g = new bs::LinkStream();
+        bs::stream_union(a, b, *g);
+        return g;
+    }, py::arg("L1"), py::arg("L2"), R"pbdoc(
+    Returns the union of two link streams.
+
+    The vertices are matched by label. An edge is active at time t in the result if it is
+    active at time t in L1 or in L2.
+
+    Args:
+        L1 (LinkStream): first link stream.
+        L2 (LinkStream): second link stream.
+
+    Returns:
+        LinkStream: union of L1 and L2 defined over the hull of both definition intervals.
+    )pbdoc");
+
+    m.def("intersection", [](bs::LinkStream &a, bs::LinkStream &b) {
+        bs::LinkStream *g = new bs::LinkStream();
+        bs::stream_intersection(a, b, *g);
+        return g;
+    }, py::arg("L1"), py::arg("L2"), R"pbdoc(
+    Returns the intersection of two link streams.
+
+    An edge is active at time t in the result if it is active at time t in L1 and in L2.
+    Only the vertices present in both streams are kept.
+
+    Args:
+        L1 (LinkStream): first link stream.
+        L2 (LinkStream): second link stream.
+
+    Returns:
+        LinkStream: intersection of L1 and L2.
+    )pbdoc");
+
+    m.def("difference", [](bs::LinkStream &a, bs::LinkStream &b) {
+        bs::LinkStream *g = new bs::LinkStream();
+        bs::stream_difference(a, b, *g);
+        return g;
+    }, py::arg("L1"), py::arg("L2"), R"pbdoc(
+    Returns the difference of two link streams.
+
+    An edge is active at time t in the result if it is active at time t in L1 and not in L2,
+    e.g. to remove a blocklist stream from a contact stream.
+
+    Args:
+        L1 (LinkStream): first link stream.
+        L2 (LinkStream): link stream to remove from L1.
+
+    Returns:
+        LinkStream: difference L1 - L2 defined over the definition interval of L1.
+    )pbdoc");
+
+    m.def("symmetric_difference", [](bs::LinkStream &a, bs::LinkStream &b) {
+        bs::LinkStream *g = new bs::LinkStream();
+        bs::stream_symmetric_difference(a, b, *g);
+        return g;
+    }, py::arg("L1"), py::arg("L2"), R"pbdoc(
+    Returns the symmetric difference of two link streams.
+
+    An edge is active at time t in the result if it is active at time t in exactly one of L1 and L2.
+
+    Args:
+        L1 (LinkStream): first link stream.
+        L2 (LinkStream): second link stream.
+
+    Returns:
+        LinkStream: symmetric difference of L1 and L2.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Aggregation into weighted graphs
+    ///
+    ///**************************************************************************************************
+
+    m.def("aggregate", [](bs::LinkStream &g, time_t delta, std::size_t max_buckets) {
+        auto snapshots = bs::aggregate(g, delta, max_buckets);
+        return py::make_tuple(snapshots.origin, snapshots.num_buckets,
+                              as_ndarray(std::move(snapshots.buckets)), std::move(snapshots.matrices));
+    }, py::arg("L"), py::arg("delta"), py::arg("max_buckets") = bs::default_max_buckets, R"pbdoc(
+    Aggregate a link stream into a sequence of weighted graphs.
+
+    The time is split in buckets of duration delta starting at the beginning of the first
+    interval of the link stream, the bucket k spans [origin + k delta, origin + (k+1) delta).
+    The weight of the edge (u, v) in a bucket is the time during which (u, v) is active inside
+    the bucket. Only the occupied buckets get a matrix.
+
+    Args:
+        L (LinkStream): link stream to aggregate.
+        delta (int): duration of a bucket.
+        max_buckets (int): largest accepted number of buckets, an error is raised above.
+
+    Returns:
+        tuple: (origin, num_buckets, buckets, matrices), matrices[i] is the scipy.sparse.csc_matrix
+        adjacency matrix of the occupied bucket buckets[i].
+    )pbdoc");
+
+    m.def("aggregate_tensor", [](bs::LinkStream &g, time_t delta, std::size_t max_buckets) {
+        auto tensor = bs::aggregate_tensor(g, delta, max_buckets);
+        return py::make_tuple(tensor.origin, tensor.num_buckets,
+                              as_ndarray(std::move(tensor.bucket)),
+                              as_ndarray(std::move(tensor.source)),
+                              as_ndarray(std::move(tensor.target)),
+                              as_ndarray(std::move(tensor.weight)));
+    }, py::arg("L"), py::arg("delta"), py::arg("max_buckets") = bs::default_max_buckets, R"pbdoc(
+    Aggregate a link stream into a sparse 3-D tensor.
+
+    The buckets are those of aggregate, the bucket k spans [origin + k delta, origin + (k+1) delta).
+
+    Args:
+        L (LinkStream): link stream to aggregate.
+        delta (int): duration of a bucket.
+        max_buckets (int): largest accepted number of buckets, an error is raised above.
+
+    Returns:
+        tuple: (origin, num_buckets, bucket, source, target, weight), the numpy arrays being sorted
+        by bucket then by (source, target), one entry per edge active in a bucket.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Core decomposition
+    ///
+    ///**************************************************************************************************
+
+    m.def("temporal_k_core", [](bs::LinkStream &g, std::size_t k, time_t delta) {
+        bs::LinkStream *c = new bs::LinkStream();
+        bs::temporal_k_core(g, k, delta, *c);
+        return c;
+    }, py::arg("L"), py::arg("k"), py::arg("delta"), R"pbdoc(
+    Returns the (k, delta)-core of a link stream.
+
+    The (k, delta)-core is the largest set of (vertex, time) pairs such as every vertex has, at
+    every instant where it is present, at least k neighbors present and linked to it, during
+    periods of at least delta. The edges of the result are restricted to the time during which
+    both end points are in the core.
+
+    Args:
+        L (LinkStream): link stream.
+        k (int): minimum instantaneous degree.
+        delta (int): minimum duration of a presence period.
+
+    Returns:
+        LinkStream: the (k, delta)-core of L.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Connected components
+    ///
+    ///**************************************************************************************************
+
+    py::enum_<bs::connectivity_strategy>(m, "connectivity_strategy")
+            .value("automatic", bs::connectivity_strategy::automatic)
+            .value("offline", bs::connectivity_strategy::offline)
+            .value("recompute", bs::connectivity_strategy::recompute);
+
+    m.def("temporal_connected_components", [](bs::LinkStream &g, bs::connectivity_strategy strategy) {
+        auto evolution = bs::temporal_connected_components(g, strategy);
+        std::vector<time_t> times;
+        std::vector<std::size_t> counts;
+        for (auto &e : evolution) {
+            times.push_back(e.first);
+            counts.push_back(e.second);
+        }
+        return py::make_tuple(as_ndarray(std::move(times)), as_ndarray(std::move(counts)));
+    }, py::arg("L"), py::arg("strategy") = bs::connectivity_strategy::automatic, R"pbdoc(
+    Returns the evolution of the number of connected components of a link stream.
+
+    Every vertex is counted, an isolated vertex being its own component. The offline strategy
+    uses a segment tree over time with a rollback union-find, the recompute strategy rebuilds
+    the components at each event. The automatic strategy picks the cheapest one.
+    It summarizes temporal_component_labels by the number of components.
+
+    Args:
+        L (LinkStream): link stream.
+        strategy (connectivity_strategy): automatic, offline or recompute.
+
+    Returns:
+        tuple: (times, counts) numpy arrays, counts[i] is the number of components from times[i]
+        until the next change.
+    )pbdoc");
+
+    m.def("temporal_component_labels", [](bs::LinkStream &g, bs::connectivity_strategy strategy) {
+        auto evolution = bs::temporal_component_labels(g, strategy);
+        std::vector<time_t> times;
+        std::vector<std::size_t> labels;
+        for (auto &e : evolution) {
+            times.push_back(e.first);
+            labels.insert(labels.end(), e.second.begin(), e.second.end());
+        }
+        auto rows = times.size();
+        return py::make_tuple(as_ndarray(std::move(times)),
+                              as_ndarray(std::move(labels)).attr("reshape")(rows, g.num_vertices()));
+    }, py::arg("L"), py::arg("strategy") = bs::connectivity_strategy::automatic, R"pbdoc(
+    Returns the component of every vertex of a link stream over time.
+
+    temporal_connected_components is the summary of this function keeping only the number of
+    components. The labels of each row are numbered from 0 in the order of the first vertex.
+
+    Args:
+        L (LinkStream): link stream.
+        strategy (connectivity_strategy): automatic, offline or recompute.
+
+    Returns:
+        tuple: (times, labels) numpy arrays, labels[i, v] is the component of the vertex v from
+        times[i] until the next change of the partition.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Temporal paths and centrality
+    ///
+    ///**************************************************************************************************
+
+    py::enum_<bs::temporal_path_type>(m, "temporal_path_type")
+            .value("fastest", bs::temporal_path_type::fastest)
+            .value("shortest_fastest", bs::temporal_path_type::shortest_fastest);
+
+    m.def("fastest_path_duration", [](bs::LinkStream &g, const std::string &source) {
+        return as_ndarray(bs::fastest_path_duration(g, g.vertex(source)));
+    }, py::arg("L"), py::arg("source"), R"pbdoc(
+    Duration of the fastest temporal paths from a source to every vertex.
+
+    Edges are traversed instantaneously at integer instants and a path can wait on a vertex.
+
+    Args:
+        L (LinkStream): link stream.
+        source (str): label of the source vertex.
+
+    Returns:
+        numpy.ndarray: duration for each vertex indexed by vertex id, -1 for unreachable vertices.
+    )pbdoc");
+
+    m.def("temporal_betweenness", [](bs::LinkStream &g, bs::temporal_path_type type, bool normalized) {
+        return as_ndarray(bs::temporal_betweenness(g, type, normalized));
+    }, py::arg("L"), py::arg("path_type") = bs::temporal_path_type::shortest_fastest,
+          py::arg("normalized") = true, R"pbdoc(
+    Temporal betweenness of the vertices, computed in parallel over the sources.
+
+    For every ordered pair of vertices one fastest path is selected, the one with the fewest
+    hops with shortest_fastest, and its intermediate vertices are credited.
+
+    Args:
+        L (LinkStream): link stream.
+        path_type (temporal_path_type): fastest or shortest_fastest.
+        normalized (bool): divide by (n-1)(n-2).
+
+    Returns:
+        numpy.ndarray: betweenness of each vertex indexed by vertex id.
+    )pbdoc");
+
+    m.def("temporal_closeness", [](bs::LinkStream &g, bool normalized) {
+        return as_ndarray(bs::temporal_closeness(g, normalized));
+    }, py::arg("L"), py::arg("normalized") = true, R"pbdoc(
+    Temporal closeness of the vertices, the sum of 1 / (1 + d) over the fastest path durations d
+    to the other vertices.
+
+    Args:
+        L (LinkStream): link stream.
+        normalized (bool): divide by n-1.
+
+    Returns:
+        numpy.ndarray: closeness of each vertex indexed by vertex id.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Temporal motifs
+    ///
+    ///**************************************************************************************************
+
+    m.def("temporal_motifs", [](bs::LinkStream &g, time_t delta) {
+        return bs::temporal_motifs(g, delta);
+    }, py::arg("L"), py::arg("delta"), R"pbdoc(
+    Number of delta-temporal motifs with 3 events on 2 or 3 vertices.
+
+    Every time interval of an edge is an event at its start. A motif is a sequence of 3 events
+    spanning at most delta on at most 3 vertices. The vertices are named a, b by the first event
+    and c for the third vertex.
+
+    Args:
+        L (LinkStream): link stream.
+        delta (int): maximum time between the first and the last event of a motif.
+
+    Returns:
+        numpy.ndarray: 3 x 3 matrix of counts indexed by the vertex pair (0 = ab, 1 = ac, 2 = bc)
+        of the second and the third event.
+    )pbdoc");
+
+    ///**************************************************************************************************
+    ///
+    ///  Contact and inter-contact statistics
+    ///
+    ///**************************************************************************************************
+
+    m.def("contact_statistics", [](bs::LinkStream &g, double base) {
+        auto stats = bs::intercontact_statistics(g, base);
+        ///< one row per sequence: contacts, mean duration, mean and std of the gaps, burstiness, memory
+        auto table = [](const std::vector<bs::contact_accumulator> &accumulators) {
+            Eigen::MatrixXd res(accumulators.size(), 6);
+            for (std::size_t i = 0; i < accumulators.size(); ++i) {
+                auto &acc = accumulators[i];
+                res.row(static_cast<Eigen::Index>(i)) << static_cast<double>(acc.durations.count()),
+                        acc.durations.mean(), acc.gaps.mean(), std::sqrt(acc.gaps.variance()),
+                        acc.burstiness(), acc.memory();
+            }
+            return res;
+        };
+        ///< both histograms are padded to the same bins
+        auto &longer = stats.durations.counts().size() > stats.gaps.counts().size() ? stats.durations : stats.gaps;
+        auto counts = [&longer](const bs::log_histogram &h) {
+            std::vector<std::uint64_t> res(h.counts());
+            res.resize(longer.counts().size(), 0);
+            return as_ndarray(std::move(res));
+        };
+        return py::make_tuple(as_ndarray(longer.edges()), counts(stats.durations), counts(stats.gaps),
+                              table(stats.edges), table(stats.vertices));
+    }, py::arg("L"), py::arg("base") = 2.0, R"pbdoc(
+    Distributions of the contact durations and inter-contact times of a link stream, with the
+    burstiness and memory coefficients of every edge and vertex, computed in one parallel pass.
+
+    The contacts of an edge are its time intervals, those of a vertex the union of the intervals
+    of its edges. The inter-contact times are the gaps between consecutive contacts.
+
+    Args:
+        L (LinkStream): link stream.
+        base (float): ratio between the edges of consecutive bins of the histograms.
+
+    Returns:
+        tuple: (bin_edges, durations, gaps, edge_stats, vertex_stats). The histograms durations
+        and gaps count the values of all the edges in the bins [bin_edges[i], bin_edges[i+1]),
+        the values below 1 being in the first bin. edge_stats, indexed by the
+        rank of the edge in edges(), and vertex_stats, indexed by vertex id, have the columns
+        number of contacts, mean duration, mean and standard deviation of the inter-contact
+        times, burstiness and memory coefficient (NaN when undefined).
+    )pbdoc");
+}
+
+#endif //BSTREAM_LINKSTREAM_ALGORITHMS_INTERFACE_HPP
@@ -15,12 +15,52 @@
 
 #include <ctime>
 #include <iostream>
+#include <limits>
 
 #include "GraphType.hpp"
+#include "ArrowData.hpp"
 
 namespace py = pybind11;
 namespace bs = boost::bstream;
 
+/**
+ * @brief Contacts of a link stream exported through the Arrow PyCapsule interface, the copy of the
+ * link stream sharing its storage.
+ */
+struct ArrowContacts
+{
+    bs::LinkStream stream;
+    bs::arrow_columns columns;
+};
+
+/**
+ * @brief Wrap an Arrow structure in a PyCapsule that releases it unless the consumer moved it out.
+ */
+template<typename T>
+py::capsule arrow_capsule(T *object, const char *name)
+{
+    return py::reinterpret_steal<py::capsule>(PyCapsule_New(object, name, [](PyObject *capsule) {
+        auto object = static_cast<T *>(PyCapsule_GetPointer(capsule, PyCapsule_GetName(capsule)));
+        if (object->release != nullptr)
+            object->release(object);
+        delete object;
+    }));
+}
+
+/**
+ * @brief Move the Arrow structure out of a PyCapsule, leaving a released structure behind.
+ */
+template<typename T>
+T arrow_from_capsule(const py::object &capsule, const char *name)
+{
+    auto object = static_cast<T *>(PyCapsule_GetPointer(capsule.ptr(), name));
+    if (object == nullptr)
+        throw py::error_already_set();
+    T moved = *object;
+    object->release = nullptr;
+    return moved;
+}
+
 void linkstream_interface(py::module &m)
 {
     py::class_<bs::LinkStream, bs::Graph> linkstream(m, "LinkStream");
@@ -28,6 +68,7 @@ void linkstream_interface(py::module &m)
     linkstream.def(py::init<int>());
     linkstream.def(py::init<time_t, time_t>());
     linkstream.def(py::init<int, time_t, time_t>());
+    linkstream.def(py::init<const bs::LinkStream &>(), py::arg("LinkStream"));
     linkstream.def("set_definition", &bs::LinkStream::set_definition);
     linkstream.def("definition", &bs::LinkStream::definition);
     linkstream.def("definition_length", &bs::LinkStream::definition_length);
@@ -44,6 +85,10 @@ void linkstream_interface(py::module &m)
     linkstream.def("add_edge_w_time", py::overload_cast<const std::string &, const std::string &, time_t, time_t>(
             &bs::LinkStream::add_edge_w_time));
 
+    linkstream.def("add_edges_w_time", [](bs::LinkStream &g, std::vector<bs::LinkStream::contact_t> contacts) {
+        g.add_edges_w_time(contacts);
+    }, py::arg("contacts"), "Bulk insertion of a list of (s, t, b, e) contacts between existing vertex ids.");
+
     linkstream.def("edge_tinterval_set", py::overload_cast<const bs::LinkStream::edge_t &>(&bs::LinkStream::edge_tinterval_set));
     // todo: add edge_tinterval_set method for the other interface
 
@@ -55,7 +100,189 @@ void linkstream_interface(py::module &m)
     linkstream.def("instantaneous_degree",  py::overload_cast<const typename bs::LinkStream::vertex_t &>(&bs::LinkStream::instantaneous_degree));
     linkstream.def("density", &bs::LinkStream::density);
 
-    linkstream.def("read_csv", &bs::LinkStream::read_csv, py::arg("path"), py::arg("delimiter") = ',');
+    linkstream.def("read_csv", [](bs::LinkStream &g, const std::string &path, char delimiter, std::size_t source,
+                                  std::size_t target, std::size_t begin, std::size_t end, bool header,
+                                  time_t time_unit, time_t window_begin, time_t window_end, time_t min_duration,
+                                  const std::vector<std::string> &allow, const std::vector<std::string> &deny,
+                                  bool compress) {
+        bs::csv_options options;
+        options.delimiter = delimiter;
+        options.source = source;
+        options.target = target;
+        options.begin = begin;
+        options.end = end;
+        options.header = header;
+        options.time_unit = time_unit;
+        options.window_begin = window_begin;
+        options.window_end = window_end;
+        options.min_duration = min_duration;
+        options.allow.insert(allow.begin(), allow.end());
+        options.deny.insert(deny.begin(), deny.end());
+        options.compress = compress;
+        py::gil_scoped_release release;
+        g.read_csv(path, options);
+    }, py::arg("path"), py::arg("delimiter") = ',', py::arg("source") = 0, py::arg("target") = 1,
+    py::arg("begin") = 2, py::arg("end") = 3, py::arg("header") = false, py::arg("time_unit") = 1,
+    py::arg("window_begin") = std::numeric_limits<time_t>::min(),
+    py::arg("window_end") = std::numeric_limits<time_t>::max(), py::arg("min_duration") = 0,
+    py::arg("allow") = std::vector<std::string>(), py::arg("deny") = std::vector<std::string>(),
+    py::arg("compress") = false, R"pbdoc(
+    Read the contacts of a csv file, possibly compressed with gzip, xz or zstd.
+
+    The rows are filtered while the file is read, only the kept rows creating vertices and time
+    intervals. The timestamps are divided by time_unit, the beginning rounded down and the end
+    rounded up, the contacts shorter than min_duration are skipped and the others clipped to
+    [window_begin, window_end). These times are expressed in the time unit. The definition
+    interval is extended to the hull of the kept contacts.
+
+    Args:
+        path (str): path of the file.
+        delimiter (str): field delimiter.
+        source (int): column of the source vertex.
+        target (int): column of the target vertex.
+        begin (int): column of the beginning of the contacts.
+        end (int): column of the end of the contacts.
+        header (bool): skip the first row, holding the column names.
+        time_unit (int): length of the time unit in the timestamps of the file, e.g. 10**9 for
+            nanosecond timestamps read in seconds.
+        window_begin (int): beginning of the time window.
+        window_end (int): end of the time window.
+        min_duration (int): minimum duration of the kept contacts.
+        allow (list): if not empty, only the contacts between these vertices are kept.
+        deny (list): the contacts of these vertices are skipped.
+        compress (bool): compress the time intervals after the load, see compress_intervals.
+)pbdoc");
+
+    linkstream.def("coarsen", [](bs::LinkStream &g, time_t resolution, time_t max_gap, bool compress) {
+        bs::coarsening_summary res;
+        {
+            py::gil_scoped_release release;
+            res = g.coarsen(resolution, max_gap, compress);
+        }
+        return py::make_tuple(res.intervals_before, res.intervals_after, res.bytes_reclaimed);
+    }, py::arg("resolution"), py::arg("max_gap") = 0, py::arg("compress") = false, R"pbdoc(
+    Quantize the timestamps and merge the close contacts of every edge, in place.
+
+    An interval [b, e) becomes [floor(b / resolution), ceil(e / resolution)), e.g. a resolution of
+    10**9 turns nanoseconds into seconds, then the contacts of an edge separated by less than
+    max_gap, in the new unit, are merged. The definition interval is rounded outward.
+
+    Args:
+        resolution (int): length of the new time unit, at least 1.
+        max_gap (int): gaps shorter than max_gap are filled, 0 only joins the touching contacts.
+        compress (bool): compress the coarse time intervals, see compress_intervals.
+
+    Returns:
+        tuple: (intervals_before, intervals_after, bytes_reclaimed), the number of time intervals
+        of the edges before and after, and an estimate of the memory released.
+)pbdoc");
+
+    linkstream.def("compress_intervals", [](bs::LinkStream &g) {
+        bs::compression_summary res;
+        {
+            py::gil_scoped_release release;
+            res = g.compress_intervals();
+        }
+        return py::make_tuple(res.intervals, res.bytes_before, res.bytes_after);
+    }, R"pbdoc(
+    Replace the time intervals of every edge by their compressed form, the interval sets are freed.
+
+    While compressed, edge_tinterval_length and is_edge_active are answered from the compressed
+    blocks and edge_tinterval_set decodes the intervals of one edge. The first change of the time
+    intervals decodes them back, see decompress_intervals.
+
+    Returns:
+        tuple: (intervals, bytes_before, bytes_after), the number of time intervals of the edges,
+        an estimate of the memory of the interval sets and the memory of the compressed sets.
+)pbdoc");
+    linkstream.def("decompress_intervals", [](bs::LinkStream &g) {
+        py::gil_scoped_release release;
+        g.decompress_intervals();
+    }, R"pbdoc(
+    Decode the compressed time intervals back into interval sets, nothing is done if they are not
+    compressed.
+)pbdoc");
+    linkstream.def("has_compressed_intervals", &bs::LinkStream::has_compressed_intervals);
+
+    py::class_<ArrowContacts>(m, "ArrowContacts", "Contacts of a link stream exported by LinkStream.to_arrow.")
+            .def("__arrow_c_array__", [](ArrowContacts &c, py::object requested_schema) {
+                auto schema = new ArrowSchema();
+                auto array = new ArrowArray();
+                {
+                    py::gil_scoped_release release;
+                    bs::export_arrow(c.stream, schema, array, c.columns);
+                }
+                return py::make_tuple(arrow_capsule(schema, "arrow_schema"), arrow_capsule(array, "arrow_array"));
+            }, py::arg("requested_schema") = py::none())
+            .def("__arrow_c_stream__", [](ArrowContacts &c, py::object requested_schema) {
+                auto stream = new ArrowArrayStream();
+                {
+                    py::gil_scoped_release release;
+                    bs::export_arrow(c.stream, stream, c.columns);
+                }
+                return arrow_capsule(stream, "arrow_array_stream");
+            }, py::arg("requested_schema") = py::none());
+
+    linkstream.def("to_arrow", [](bs::LinkStream &g, const std::string &src, const std::string &dst,
+                                  const std::string &begin, const std::string &end) {
+        return ArrowContacts{g, bs::arrow_columns{src, dst, begin, end}};
+    }, py::arg("src") = "src", py::arg("dst") = "dst", py::arg("begin") = "begin", py::arg("end") = "end", R"pbdoc(
+    Export the contacts through the Arrow C data interface, without a dependency on pyarrow.
+
+    The result implements the Arrow PyCapsule interface, e.g. pyarrow.table(L.to_arrow()) or
+    polars.DataFrame(L.to_arrow()). There is one row (src, dst, begin, end) per time interval of
+    every edge. The vertex columns hold the vertex ids, dictionary encoded by the labels unless the
+    link stream is in numeric label mode. The columns are built once in C++ and read without copy.
+
+    Args:
+        src (str): name of the source column.
+        dst (str): name of the target column.
+        begin (str): name of the column of the beginnings of the intervals.
+        end (str): name of the column of the ends of the intervals.
+
+    Returns:
+        ArrowContacts: object implementing __arrow_c_array__ and __arrow_c_stream__.
+    )pbdoc");
+
+    linkstream.def_static("from_arrow", [](py::object data, const std::string &src, const std::string &dst,
+                                           const std::string &begin, const std::string &end, bool numeric_labels) {
+        bs::LinkStream g;
+        g.set_numeric_labels(numeric_labels);
+        bs::arrow_columns columns{src, dst, begin, end};
+        if (py::hasattr(data, "__arrow_c_stream__")) {
+            auto stream = arrow_from_capsule<ArrowArrayStream>(data.attr("__arrow_c_stream__")(), "arrow_array_stream");
+            py::gil_scoped_release release;
+            bs::import_arrow(g, &stream, columns);
+        } else if (py::hasattr(data, "__arrow_c_array__")) {
+            py::tuple capsules = data.attr("__arrow_c_array__")();
+            auto schema = arrow_from_capsule<ArrowSchema>(capsules[0], "arrow_schema");
+            auto array = arrow_from_capsule<ArrowArray>(capsules[1], "arrow_array");
+            py::gil_scoped_release release;
+            bs::import_arrow(g, &schema, &array, columns);
+        } else {
+            throw py::type_error("from_arrow expects an object implementing the Arrow PyCapsule interface");
+        }
+        return g;
+    }, py::arg("data"), py::arg("src") = "src", py::arg("dst") = "dst", py::arg("begin") = "begin",
+    py::arg("end") = "end", py::arg("numeric_labels") = false, R"pbdoc(
+    Build a link stream from Arrow data, e.g. a pyarrow or polars table, through the Arrow C data
+    interface. The conversion runs without the GIL.
+
+    The vertex columns hold strings or integers, dictionary encoded or not, the time columns
+    integers or timestamps read in their own unit. The definition of the link stream is the time
+    span of the contacts.
+
+    Args:
+        data: object implementing __arrow_c_stream__ or __arrow_c_array__.
+        src (str): name of the source column.
+        dst (str): name of the target column.
+        begin (str): name of the column of the beginnings of the intervals.
+        end (str): name of the column of the ends of the intervals.
+        numeric_labels (bool): integer vertex columns are vertex ids (see set_numeric_labels).
+
+    Returns:
+        LinkStream: the link stream.
+    )pbdoc");
 
     linkstream.def("print_edges", &bs::LinkStream::print_edges);
 
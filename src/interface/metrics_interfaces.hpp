@@ -12,12 +12,16 @@
 #ifndef BSTREAM_METRICS_INTERFACES_HPP
 #define BSTREAM_METRICS_INTERFACES_HPP
 
+#include <pybind11/numpy.h>
+
 namespace py = pybind11;
 namespace bs = boost::bstream;
 
 #include "metrics/summary.hpp"
 #include "metrics/degree.hpp"
 #include "metrics/clustering.hpp"
+#include "metrics/bipartite_metrics.hpp"
+#include "ndarray_interface.hpp"
 #include "GraphType.hpp"
 
 void metrics_interface(py::module &m)
@@ -28,6 +32,71 @@ void metrics_interface(py::module &m)
     m.def("avg_degree", &bs::avg_degree<boost::bidirectionalS>);
     m.def("avg_clustering", &bs::avg_clustering<boost::undirectedS>);
     m.def("avg_clustering", &bs::avg_clustering<boost::bidirectionalS>);
+
+    ///**************************************************************************************************
+    ///
+    ///  Bipartite link stream metrics
+    ///
+    ///**************************************************************************************************
+
+    m.def("time_averaged_degree", [](bs::BiLinkStream &g, bs::vertex_group group) {
+        return as_ndarray(bs::time_averaged_degree(g, group));
+    }, py::arg("G"), py::arg("group"), R"pbdoc(
+    Returns the time-averaged degree of the vertices of a group.
+
+    Args:
+        G (BiLinkStream): bipartite link stream.
+        group (vertex_group): top or bottom.
+
+    Returns:
+        numpy.ndarray: total duration of the links of each vertex divided by the length of the
+        stream, indexed by group id.
+    )pbdoc");
+
+    m.def("degree_distribution", [](bs::BiLinkStream &g, bs::vertex_group group) {
+        return as_ndarray(bs::degree_distribution(g, group));
+    }, py::arg("G"), py::arg("group"), R"pbdoc(
+    Returns the time-averaged degree distribution of a group.
+
+    Args:
+        G (BiLinkStream): bipartite link stream.
+        group (vertex_group): top or bottom.
+
+    Returns:
+        numpy.ndarray: p[k], fraction of the time a vertex of the group has degree k.
+    )pbdoc");
+
+    m.def("temporal_redundancy", [](bs::BiLinkStream &g, bs::vertex_group group) {
+        return as_ndarray(bs::temporal_redundancy(g, group));
+    }, py::arg("G"), py::arg("group"), R"pbdoc(
+    Returns the temporal redundancy of the vertices of a group.
+
+    A pair of neighbors of u is redundant while another vertex of the group is linked to both
+    of them. The redundancy of u is the duration of its redundant pairs divided by the duration
+    of all its pairs of neighbors.
+
+    Args:
+        G (BiLinkStream): bipartite link stream.
+        group (vertex_group): top or bottom.
+
+    Returns:
+        numpy.ndarray: redundancy of each vertex, indexed by group id.
+    )pbdoc");
+
+    m.def("shared_neighbor_time_fraction", [](bs::BiLinkStream &g, bs::vertex_group group) {
+        return as_ndarray(bs::shared_neighbor_time_fraction(g, group));
+    }, py::arg("G"), py::arg("group"), R"pbdoc(
+    Returns the fraction of the time the vertices of a group share a neighbor with another
+    vertex of the group.
+
+    Args:
+        G (BiLinkStream): bipartite link stream.
+        group (vertex_group): top or bottom.
+
+    Returns:
+        numpy.ndarray: shared time of each vertex divided by the time during which it has a
+        neighbor, indexed by group id.
+    )pbdoc");
 }
 
 #endif //BSTREAM_METRICS_INTERFACES_HPP
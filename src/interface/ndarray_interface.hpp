@@ -0,0 +1,34 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       ndarray_interface.hpp
+/// @brief      Conversion of the algorithm results into numpy arrays
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+#ifndef BSTREAM_NDARRAY_INTERFACE_HPP
+#define BSTREAM_NDARRAY_INTERFACE_HPP
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <vector>
+
+namespace py = pybind11;
+
+/**
+ * @brief Move a std::vector into a 1-D numpy array without copying the data.
+ *
+ * The vector is kept alive by a capsule owned by the numpy array.
+ */
+template<typename T>
+py::array_t<T> as_ndarray(std::vector<T> &&v)
+{
+    auto data = new std::vector<T>(std::move(v));
+    py::capsule owner(data, [](void *p) { delete reinterpret_cast<std::vector<T> *>(p); });
+    return py::array_t<T>(data->size(), data->data(), owner);
+}
+
+#endif //BSTREAM_NDARRAY_INTERFACE_HPP
@@ -11,6 +11,8 @@
 
 
 #include "TimeIntervalSet.hpp"
+#include "FlatTimeIntervalSet.hpp"
+#include "CompressedTimeIntervalSet.hpp"
 
 namespace py = pybind11;
 namespace bs = boost::bstream;
@@ -51,4 +53,91 @@ void tintervalset_interface(py::module &m)
         stream << "<class TimeIntervalSet "  << is << ">";
         return stream.str();
     });
-}
\ No newline at end of file
+}
+
+void flattintervalset_interface(py::module &m)
+{
+    py::class_<bs::FlatTimeIntervalSet> ftis(m, "FlatTimeIntervalSet");
+    ftis.doc() = R"pbdoc(
+Set of disjoint time intervals stored as two sorted arrays.
+
+The union, intersection and difference are linear merges and never raise on disjoint sets.
+)pbdoc";
+    ftis.def(py::init<>());
+    ftis.def(py::init<time_t, time_t>());
+    ftis.def(py::init<bs::TimeIntervalSet &>(), py::arg("TimeIntervalSet"));
+    ftis.def("definition", &bs::FlatTimeIntervalSet::definition);
+    ftis.def("set_definition", &bs::FlatTimeIntervalSet::set_definition);
+    ftis.def("definition_length", &bs::FlatTimeIntervalSet::definition_length);
+    ftis.def("append", &bs::FlatTimeIntervalSet::append);
+    ftis.def("size", &bs::FlatTimeIntervalSet::size);
+    ftis.def("length", &bs::FlatTimeIntervalSet::length);
+    ftis.def("erase", &bs::FlatTimeIntervalSet::erase);
+    ftis.def("contains", py::overload_cast<const time_t &, const time_t &>(&bs::FlatTimeIntervalSet::contains, py::const_));
+    ftis.def("intersects", &bs::FlatTimeIntervalSet::intersects);
+    ftis.def("intersection", &bs::FlatTimeIntervalSet::intersection);
+    ftis.def("union", &bs::FlatTimeIntervalSet::set_union);
+    ftis.def("difference", &bs::FlatTimeIntervalSet::difference);
+    ftis.def("to_time_interval_set", &bs::FlatTimeIntervalSet::to_time_interval_set);
+    ftis.def("__len__", &bs::FlatTimeIntervalSet::size);
+    ftis.def(py::self == py::self);
+    ftis.def(py::self != py::self);
+
+    ftis.def("__iter__", [](bs::FlatTimeIntervalSet &is) {
+        std::vector<std::pair<time_t, time_t>> intervals;
+        for (std::size_t i = 0; i < is.size(); ++i)
+            intervals.push_back(std::make_pair(is.lower(i), is.upper(i)));
+        return py::iter(py::cast(intervals));
+    });
+
+    ftis.def("__repr__", [](bs::FlatTimeIntervalSet &is) {
+        std::ostringstream stream;
+        stream << "<class FlatTimeIntervalSet " << is << ">";
+        return stream.str();
+    });
+}
+
+void compressedtintervalset_interface(py::module &m)
+{
+    py::class_<bs::CompressedTimeIntervalSet> ctis(m, "CompressedTimeIntervalSet");
+    ctis.doc() = R"pbdoc(
+Append-only set of disjoint time intervals stored in bit-packed blocks of delta-encoded bounds.
+
+The length is read from the block headers, contains decodes a single block and the intersection
+skips the blocks that cannot overlap the other set.
+)pbdoc";
+    ctis.def(py::init<>());
+    ctis.def(py::init<time_t, time_t>());
+    ctis.def(py::init<const bs::FlatTimeIntervalSet &>(), py::arg("FlatTimeIntervalSet"));
+    ctis.def(py::init<bs::TimeIntervalSet &>(), py::arg("TimeIntervalSet"));
+    ctis.def("definition", &bs::CompressedTimeIntervalSet::definition);
+    ctis.def("set_definition", &bs::CompressedTimeIntervalSet::set_definition);
+    ctis.def("definition_length", &bs::CompressedTimeIntervalSet::definition_length);
+    ctis.def("append", &bs::CompressedTimeIntervalSet::append);
+    ctis.def("size", &bs::CompressedTimeIntervalSet::size);
+    ctis.def("length", &bs::CompressedTimeIntervalSet::length);
+    ctis.def("erase", &bs::CompressedTimeIntervalSet::erase);
+    ctis.def("contains", &bs::CompressedTimeIntervalSet::contains);
+    ctis.def("intersects", &bs::CompressedTimeIntervalSet::intersects);
+    ctis.def("intersection", &bs::CompressedTimeIntervalSet::intersection);
+    ctis.def("memory_usage", &bs::CompressedTimeIntervalSet::memory_usage);
+    ctis.def("to_flat_time_interval_set", &bs::CompressedTimeIntervalSet::to_flat_time_interval_set);
+    ctis.def("to_time_interval_set", &bs::CompressedTimeIntervalSet::to_time_interval_set);
+    ctis.def("__len__", &bs::CompressedTimeIntervalSet::size);
+    ctis.def(py::self == py::self);
+    ctis.def(py::self != py::self);
+
+    ctis.def("__iter__", [](bs::CompressedTimeIntervalSet &is) {
+        auto fis = is.to_flat_time_interval_set();
+        std::vector<std::pair<time_t, time_t>> intervals;
+        for (std::size_t i = 0; i < fis.size(); ++i)
+            intervals.push_back(std::make_pair(fis.lower(i), fis.upper(i)));
+        return py::iter(py::cast(intervals));
+    });
+
+    ctis.def("__repr__", [](bs::CompressedTimeIntervalSet &is) {
+        std::ostringstream stream;
+        stream << "<class CompressedTimeIntervalSet " << is << ">";
+        return stream.str();
+    });
+}
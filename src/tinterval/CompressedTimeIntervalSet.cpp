@@ -0,0 +1,416 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       CompressedTimeIntervalSet.cpp
+/// @brief      Implementation file of the CompressedTimeIntervalSet class
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <numeric>
+
+#include "CompressedTimeIntervalSet.hpp"
+
+using namespace std;
+
+namespace boost::bstream
+{
+    /**
+     * @brief Forward iterator over the intervals of a set, decoding one chunk at a time.
+     */
+    class CompressedTimeIntervalSet::cursor
+    {
+    public:
+        explicit cursor(const CompressedTimeIntervalSet &s) : set(s), chunks(s.num_chunks())
+        {
+            load(0);
+        };
+
+        bool valid() const
+        {
+            return c < chunks;
+        };
+
+        time_t lower() const
+        {
+            return lowers[i];
+        };
+
+        time_t upper() const
+        {
+            return uppers[i];
+        };
+
+        void next()
+        {
+            if (++i == n)
+                load(c + 1);
+        };
+
+        /**
+         * @brief Move to the first interval ending after t, the chunks ending before t are skipped
+         * without being decoded.
+         */
+        void skip_to(const time_t &t)
+        {
+            if (!valid() || uppers[i] > t)
+                return;
+            if (set.chunk_last(c) <= t) {
+                auto d = c + 1;
+                while (d < chunks && set.chunk_last(d) <= t)
+                    ++d;
+                load(d);
+                if (!valid())
+                    return;
+            }
+            i = static_cast<std::size_t>(std::upper_bound(uppers + i, uppers + n, t) - uppers);
+        };
+
+    private:
+        const CompressedTimeIntervalSet &set;
+        std::size_t chunks, c = 0, i = 0, n = 0;
+        time_t lowers[block_size], uppers[block_size];
+
+        void load(std::size_t chunk)
+        {
+            c = chunk;
+            i = 0;
+            n = c < chunks ? set.decode(c, lowers, uppers) : 0;
+        };
+    };
+
+    CompressedTimeIntervalSet::CompressedTimeIntervalSet()
+    {
+        interval_definition = make_time_interval();
+    }
+
+    CompressedTimeIntervalSet::CompressedTimeIntervalSet(const time_t &t1, const time_t &t2)
+    {
+        interval_definition = make_time_interval(t1, t2);
+    }
+
+    CompressedTimeIntervalSet::CompressedTimeIntervalSet(const FlatTimeIntervalSet &fis)
+    {
+        auto def = fis.definition();
+        interval_definition = make_time_interval(def.first, def.second);
+        for (std::size_t i = 0; i < fis.size(); ++i)
+            append(fis.lowers()[i], fis.uppers()[i]);
+        shrink_to_fit();
+    }
+
+    CompressedTimeIntervalSet::CompressedTimeIntervalSet(const TimeIntervalSet &tis)
+    {
+        auto def = tis.definition();
+        interval_definition = make_time_interval(def.first, def.second);
+        ///< the icl set is already sorted and joined
+        for (auto it = tis.begin(); it != tis.end(); ++it)
+            append(it->lower(), it->upper());
+        shrink_to_fit();
+    }
+
+    time_t
+    CompressedTimeIntervalSet::definition_length() const
+    {
+        return interval_definition.upper() - interval_definition.lower();
+    }
+
+    pair<time_t, time_t>
+    CompressedTimeIntervalSet::definition() const
+    {
+        return std::make_pair(interval_definition.lower(), interval_definition.upper());
+    }
+
+    void
+    CompressedTimeIntervalSet::set_definition(const time_t &t1, const time_t &t2)
+    {
+        interval_definition = make_time_interval(t1, t2);
+    }
+
+    bool
+    CompressedTimeIntervalSet::append(const time_t &t1, const time_t &t2)
+    {
+        auto ti = make_time_interval(t1, t2);
+        if (!boost::icl::contains(interval_definition, ti))
+            return false;
+
+        if (tail_lowers.empty() || t1 > tail_uppers.back()) {
+            ///< the tail is sealed only here, the last interval always stays in the tail
+            if (tail_lowers.size() == block_size)
+                seal();
+            tail_lowers.push_back(t1);
+            tail_uppers.push_back(t2);
+            return true;
+        }
+
+        ///< [t1, t2) overlaps or touches the last interval, it must not reach the previous one
+        if (t1 < tail_lowers.back()) {
+            auto k = tail_lowers.size();
+            if (k > 1 ? t1 <= tail_uppers[k - 2] : !blocks.empty() && t1 <= blocks.back().last)
+                return false;
+            tail_lowers.back() = t1;
+        }
+        tail_uppers.back() = std::max(tail_uppers.back(), t2);
+        return true;
+    }
+
+    void
+    CompressedTimeIntervalSet::seal()
+    {
+        ///< differences between the consecutive bounds l0 < u0 < l1 < ..., exact in unsigned arithmetic
+        const std::size_t n = tail_lowers.size(), m = 2 * n - 1;
+        std::vector<std::uint64_t> deltas(m);
+        std::uint64_t scale = 0;
+        for (std::size_t k = 1; k <= m; ++k) {
+            auto prev = k % 2 ? tail_lowers[k / 2] : tail_uppers[k / 2 - 1];
+            auto cur = k % 2 ? tail_uppers[k / 2] : tail_lowers[k / 2];
+            deltas[k - 1] = static_cast<std::uint64_t>(cur) - static_cast<std::uint64_t>(prev);
+            scale = std::gcd(scale, deltas[k - 1]);
+        }
+        std::uint64_t largest = 0;
+        for (auto &d : deltas) {
+            d /= scale;
+            largest = std::max(largest, d);
+        }
+        unsigned width = 1;
+        while (width < 64 && (largest >> width) != 0)
+            ++width;
+
+        time_t sum = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            sum += tail_uppers[i] - tail_lowers[i];
+
+        ///< the padding word lets the decoder always read two words per value
+        if (!words.empty())
+            words.pop_back();
+        std::size_t offset = words.size();
+        words.resize(offset + (m * width + 63) / 64 + 1, 0);
+        for (std::size_t k = 0; k < m; ++k) {
+            auto p = k * width;
+            auto s = p % 64;
+            words[offset + p / 64] |= deltas[k] << s;
+            if (s + width > 64)
+                words[offset + p / 64 + 1] |= deltas[k] >> (64 - s);
+        }
+
+        blocks.push_back(block{tail_lowers.front(), tail_uppers.back(), sum, scale, offset, width});
+        tail_lowers.clear();
+        tail_uppers.clear();
+    }
+
+    std::size_t
+    CompressedTimeIntervalSet::num_chunks() const
+    {
+        return blocks.size() + !tail_lowers.empty();
+    }
+
+    time_t
+    CompressedTimeIntervalSet::chunk_first(std::size_t c) const
+    {
+        return c < blocks.size() ? blocks[c].first : tail_lowers.front();
+    }
+
+    time_t
+    CompressedTimeIntervalSet::chunk_last(std::size_t c) const
+    {
+        return c < blocks.size() ? blocks[c].last : tail_uppers.back();
+    }
+
+    std::size_t
+    CompressedTimeIntervalSet::decode(std::size_t c, time_t *lowers, time_t *uppers) const
+    {
+        if (c == blocks.size()) {
+            std::copy(tail_lowers.begin(), tail_lowers.end(), lowers);
+            std::copy(tail_uppers.begin(), tail_uppers.end(), uppers);
+            return tail_lowers.size();
+        }
+
+        const auto &h = blocks[c];
+        const std::uint64_t *w = words.data() + h.offset;
+        const std::uint64_t mask = h.width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << h.width) - 1;
+        const std::size_t m = 2 * block_size - 1;
+
+        ///< branch-free unpacking, the values are independent and the loop is vectorized by the compiler
+        std::uint64_t deltas[m];
+        for (std::size_t k = 0; k < m; ++k) {
+            auto p = k * h.width;
+            auto s = p % 64;
+            auto lo = w[p / 64] >> s;
+            auto hi = (w[p / 64 + 1] << 1) << (63 - s);
+            deltas[k] = (lo | hi) & mask;
+        }
+
+        auto t = static_cast<std::uint64_t>(h.first);
+        lowers[0] = h.first;
+        for (std::size_t i = 0; i < block_size; ++i) {
+            if (i > 0) {
+                t += deltas[2 * i - 1] * h.scale;
+                lowers[i] = static_cast<time_t>(t);
+            }
+            t += deltas[2 * i] * h.scale;
+            uppers[i] = static_cast<time_t>(t);
+        }
+        return block_size;
+    }
+
+    unsigned
+    CompressedTimeIntervalSet::size() const
+    {
+        return static_cast<unsigned>(blocks.size() * block_size + tail_lowers.size());
+    }
+
+    bool
+    CompressedTimeIntervalSet::empty() const
+    {
+        return tail_lowers.empty();
+    }
+
+    time_t
+    CompressedTimeIntervalSet::length() const
+    {
+        time_t sum = 0;
+        for (const auto &h : blocks)
+            sum += h.length;
+        for (std::size_t i = 0; i < tail_lowers.size(); ++i)
+            sum += tail_uppers[i] - tail_lowers[i];
+        return sum;
+    }
+
+    bool
+    CompressedTimeIntervalSet::contains(const time_t &t1, const time_t &t2) const
+    {
+        if (empty() || t1 >= t2)
+            return false;
+
+        ///< last chunk beginning before t1, found on the headers
+        std::size_t lo = 0, hi = num_chunks();
+        while (lo < hi) {
+            auto mid = (lo + hi) / 2;
+            if (chunk_first(mid) <= t1)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo == 0 || chunk_last(lo - 1) < t2)
+            return false;
+
+        auto c = lo - 1;
+        if (c == blocks.size()) {
+            auto i = std::upper_bound(tail_lowers.begin(), tail_lowers.end(), t1) - tail_lowers.begin();
+            return t2 <= tail_uppers[i - 1];
+        }
+        time_t lowers[block_size], uppers[block_size];
+        auto n = decode(c, lowers, uppers);
+        auto i = std::upper_bound(lowers, lowers + n, t1) - lowers;
+        return t2 <= uppers[i - 1];
+    }
+
+    bool
+    CompressedTimeIntervalSet::intersects(const CompressedTimeIntervalSet &s2) const
+    {
+        if (empty() || s2.empty())
+            return false;
+        cursor a(*this), b(s2);
+        while (true) {
+            a.skip_to(b.lower());
+            if (!a.valid())
+                return false;
+            b.skip_to(a.lower());
+            if (!b.valid())
+                return false;
+            if (std::max(a.lower(), b.lower()) < std::min(a.upper(), b.upper()))
+                return true;
+        }
+    }
+
+    CompressedTimeIntervalSet
+    CompressedTimeIntervalSet::intersection(const CompressedTimeIntervalSet &s2) const
+    {
+        CompressedTimeIntervalSet s3(interval_definition);
+        if (empty() || s2.empty())
+            return s3;
+
+        cursor a(*this), b(s2);
+        while (true) {
+            a.skip_to(b.lower());
+            if (!a.valid())
+                break;
+            b.skip_to(a.lower());
+            if (!b.valid())
+                break;
+            auto lo = std::max(a.lower(), b.lower());
+            auto hi = std::min(a.upper(), b.upper());
+            if (lo < hi) {
+                ///< the pieces of an interval are separated by the gaps of the other set
+                if (s3.tail_lowers.size() == block_size)
+                    s3.seal();
+                s3.tail_lowers.push_back(lo);
+                s3.tail_uppers.push_back(hi);
+            }
+            bool next_a = a.upper() <= b.upper();
+            bool next_b = b.upper() <= a.upper();
+            if (next_a)
+                a.next();
+            if (next_b)
+                b.next();
+            if (!a.valid() || !b.valid())
+                break;
+        }
+        return s3;
+    }
+
+    FlatTimeIntervalSet
+    CompressedTimeIntervalSet::to_flat_time_interval_set() const
+    {
+        FlatTimeIntervalSet fis(interval_definition);
+        fis.reserve(size());
+        for (cursor it(*this); it.valid(); it.next())
+            fis.append(it.lower(), it.upper());
+        return fis;
+    }
+
+    TimeIntervalSet
+    CompressedTimeIntervalSet::to_time_interval_set() const
+    {
+        TimeIntervalSet tis(interval_definition);
+        for (cursor it(*this); it.valid(); it.next())
+            tis.append(it.lower(), it.upper());
+        return tis;
+    }
+
+    std::size_t
+    CompressedTimeIntervalSet::memory_usage() const
+    {
+        return sizeof(*this) + blocks.capacity() * sizeof(block) + words.capacity() * sizeof(std::uint64_t) +
+               (tail_lowers.capacity() + tail_uppers.capacity()) * sizeof(time_t);
+    }
+
+    void
+    CompressedTimeIntervalSet::shrink_to_fit()
+    {
+        blocks.shrink_to_fit();
+        words.shrink_to_fit();
+        tail_lowers.shrink_to_fit();
+        tail_uppers.shrink_to_fit();
+    }
+
+    void
+    CompressedTimeIntervalSet::erase()
+    {
+        blocks.clear();
+        words.clear();
+        tail_lowers.clear();
+        tail_uppers.clear();
+    }
+
+    bool
+    CompressedTimeIntervalSet::operator==(const CompressedTimeIntervalSet &s2) const
+    {
+        ///< the blocks are always cut every block_size intervals, the encoding is canonical
+        return blocks == s2.blocks && words == s2.words && tail_lowers == s2.tail_lowers &&
+               tail_uppers == s2.tail_uppers;
+    }
+}
@@ -0,0 +1,172 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       CompressedTimeIntervalSet.hpp
+/// @brief      Description of the CompressedTimeIntervalSet class
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_COMPRESSEDTIMEINTERVALSET_HPP
+#define BSTREAM_COMPRESSEDTIMEINTERVALSET_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <ctime>
+
+#include "TimeIntervalSet.hpp"
+#include "FlatTimeIntervalSet.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @class CompressedTimeIntervalSet
+     * @brief Append-only set of disjoint right-open time intervals stored in compressed blocks.
+     *
+     * The bounds l0 < u0 < l1 < u1 < ... are cut in blocks of block_size intervals. A block stores
+     * the differences between consecutive bounds divided by their greatest common divisor, so that
+     * nanosecond timestamps of a coarser resolution cost the bits of that resolution, bit-packed at
+     * the width of the largest one. The header of a block keeps its first and last bound and the
+     * total length of its intervals: length() reads only the headers, contains() decodes a single
+     * block and the intersection skips the blocks that cannot overlap the other set. The last
+     * intervals are kept uncompressed until they fill a block.
+     */
+    class CompressedTimeIntervalSet
+    {
+    public:
+        static const std::size_t block_size = 128; ///< number of intervals of a compressed block
+
+        /**
+         * @brief Default constructor, initialize an empty set defined on [0, infinity).
+         */
+        CompressedTimeIntervalSet();
+
+        /**
+         * @brief Initialize an empty set with its definition interval.
+         * @param definition time_interval
+         */
+        CompressedTimeIntervalSet(const TimeInterval &definition) : interval_definition(definition)
+        {};
+
+        CompressedTimeIntervalSet(const time_t &t1, const time_t &t2);
+
+        explicit CompressedTimeIntervalSet(const FlatTimeIntervalSet &fis);
+
+        explicit CompressedTimeIntervalSet(const TimeIntervalSet &tis);
+
+        ~CompressedTimeIntervalSet() = default;
+
+        time_t definition_length() const;
+
+        std::pair<time_t, time_t> definition() const;
+
+        void set_definition(const time_t &t1, const time_t &t2);
+
+        /**
+         * @brief Append the interval [t1, t2) after the last interval, an interval overlapping or
+         * touching the last one is merged with it.
+         * @return false if [t1, t2) is not inside the definition interval or begins before the end
+         * of the last interval but one
+         */
+        bool append(const time_t &t1, const time_t &t2);
+
+        unsigned size() const;
+
+        bool empty() const;
+
+        time_t length() const;
+
+        /**
+         * @brief Test if [t1, t2) is covered by a single interval of the set.
+         */
+        bool contains(const time_t &t1, const time_t &t2) const;
+
+        bool intersects(const CompressedTimeIntervalSet &s2) const;
+
+        /**
+         * @brief Intersection of two sets, an empty set is returned if they are disjoint.
+         */
+        CompressedTimeIntervalSet intersection(const CompressedTimeIntervalSet &s2) const;
+
+        FlatTimeIntervalSet to_flat_time_interval_set() const;
+
+        TimeIntervalSet to_time_interval_set() const;
+
+        /**
+         * @brief Number of bytes used by the set.
+         */
+        std::size_t memory_usage() const;
+
+        /**
+         * @brief Release the unused capacity of the buffers, once the set is built.
+         */
+        void shrink_to_fit();
+
+        void erase();
+
+        bool operator==(const CompressedTimeIntervalSet &s2) const;
+
+        bool operator!=(const CompressedTimeIntervalSet &s2) const
+        {
+            return !(*this == s2);
+        };
+
+        friend std::ostream &operator<<(std::ostream &out, const CompressedTimeIntervalSet &tis)
+        {
+            out << tis.to_flat_time_interval_set();
+            return out;
+        };
+
+    private:
+        /**
+         * @brief Header of a compressed block, also used as skip pointer.
+         */
+        struct block
+        {
+            time_t first;        ///< lower bound of the first interval
+            time_t last;         ///< upper bound of the last interval
+            time_t length;       ///< total length of the intervals
+            std::uint64_t scale; ///< common divisor of the differences between consecutive bounds
+            std::size_t offset;  ///< first word of the packed differences
+            unsigned width;      ///< bits per packed difference
+
+            bool operator==(const block &b) const
+            {
+                return first == b.first && last == b.last && length == b.length && scale == b.scale &&
+                       offset == b.offset && width == b.width;
+            };
+        };
+
+        class cursor;
+
+        std::vector<block> blocks;
+        std::vector<std::uint64_t> words; ///< packed blocks followed by a padding word
+        FlatTimeIntervalSet::time_vector tail_lowers, tail_uppers;
+        TimeInterval interval_definition;
+
+        void seal();
+
+        /**
+         * @brief Number of chunks, the compressed blocks followed by the tail if it is not empty.
+         */
+        std::size_t num_chunks() const;
+
+        time_t chunk_first(std::size_t c) const;
+
+        time_t chunk_last(std::size_t c) const;
+
+        /**
+         * @brief Decode the chunk c into lowers and uppers, of at least block_size entries.
+         * @return the number of intervals of the chunk
+         */
+        std::size_t decode(std::size_t c, time_t *lowers, time_t *uppers) const;
+    };
+
+} // end namespace boost::bstream
+
+#endif //BSTREAM_COMPRESSEDTIMEINTERVALSET_HPP
@@ -0,0 +1,278 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       FlatTimeIntervalSet.cpp
+/// @brief      Implementation file of the FlatTimeIntervalSet class
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <limits>
+
+#include "FlatTimeIntervalSet.hpp"
+
+using namespace std;
+
+namespace boost::bstream
+{
+    FlatTimeIntervalSet::FlatTimeIntervalSet()
+    {
+        interval_definition = make_time_interval();
+    }
+
+    FlatTimeIntervalSet::FlatTimeIntervalSet(const time_t &t1, const time_t &t2)
+    {
+        interval_definition = make_time_interval(t1, t2);
+    }
+
+    FlatTimeIntervalSet::FlatTimeIntervalSet(TimeIntervalSet &tis)
+    {
+        auto def = tis.definition();
+        interval_definition = make_time_interval(def.first, def.second);
+        reserve(tis.size());
+        ///< the icl set is already sorted and joined
+        for (auto it = tis.begin(); it != tis.end(); ++it) {
+            lower_bounds.push_back(it->lower());
+            upper_bounds.push_back(it->upper());
+        }
+    }
+
+    time_t
+    FlatTimeIntervalSet::definition_length() const
+    {
+        return interval_definition.upper() - interval_definition.lower();
+    }
+
+    pair<time_t, time_t>
+    FlatTimeIntervalSet::definition() const
+    {
+        return std::make_pair(interval_definition.lower(), interval_definition.upper());
+    }
+
+    void
+    FlatTimeIntervalSet::set_definition(const time_t &t1, const time_t &t2)
+    {
+        interval_definition = make_time_interval(t1, t2);
+    }
+
+    bool
+    FlatTimeIntervalSet::append(const time_t &t1, const time_t &t2)
+    {
+        auto ti = make_time_interval(t1, t2);
+        if (!boost::icl::contains(interval_definition, ti))
+            return false;
+
+        ///< fast path: intervals are usually appended in chronological order
+        if (lower_bounds.empty() || t1 > upper_bounds.back()) {
+            lower_bounds.push_back(t1);
+            upper_bounds.push_back(t2);
+            return true;
+        }
+
+        ///< [first, last) is the range of intervals overlapping or touching [t1, t2)
+        auto first = std::lower_bound(upper_bounds.begin(), upper_bounds.end(), t1) - upper_bounds.begin();
+        auto last = std::upper_bound(lower_bounds.begin(), lower_bounds.end(), t2) - lower_bounds.begin();
+
+        if (first == last) {
+            lower_bounds.insert(lower_bounds.begin() + first, t1);
+            upper_bounds.insert(upper_bounds.begin() + first, t2);
+        } else {
+            auto lo = std::min(t1, lower_bounds[first]);
+            auto hi = std::max(t2, upper_bounds[last - 1]);
+            lower_bounds.erase(lower_bounds.begin() + first + 1, lower_bounds.begin() + last);
+            upper_bounds.erase(upper_bounds.begin() + first + 1, upper_bounds.begin() + last);
+            lower_bounds[first] = lo;
+            upper_bounds[first] = hi;
+        }
+        return true;
+    }
+
+    void
+    FlatTimeIntervalSet::reserve(std::size_t n)
+    {
+        lower_bounds.reserve(n);
+        upper_bounds.reserve(n);
+    }
+
+    unsigned
+    FlatTimeIntervalSet::size() const
+    {
+        return static_cast<unsigned>(lower_bounds.size());
+    }
+
+    bool
+    FlatTimeIntervalSet::empty() const
+    {
+        return lower_bounds.empty();
+    }
+
+    time_t
+    FlatTimeIntervalSet::length() const
+    {
+        ///< plain loop over two contiguous arrays, vectorized by the compiler
+        const time_t *l = lower_bounds.data();
+        const time_t *u = upper_bounds.data();
+        const std::size_t n = lower_bounds.size();
+        time_t sum = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            sum += u[i] - l[i];
+        return sum;
+    }
+
+    void
+    FlatTimeIntervalSet::erase()
+    {
+        lower_bounds.clear();
+        upper_bounds.clear();
+    }
+
+    std::size_t
+    FlatTimeIntervalSet::gallop(const time_vector &v, std::size_t from, const time_t &t) const
+    {
+        ///< exponential search for the first index >= from such as v[index] > t
+        std::size_t n = v.size();
+        std::size_t lo = from, step = 1, hi = from;
+        while (hi < n && v[hi] <= t) {
+            lo = hi + 1;
+            hi = from + step;
+            step <<= 1;
+        }
+        hi = std::min(hi, n);
+        return std::upper_bound(v.begin() + lo, v.begin() + hi, t) - v.begin();
+    }
+
+    bool
+    FlatTimeIntervalSet::contains(const time_t &t1, const time_t &t2) const
+    {
+        std::size_t hint = 0;
+        return contains(t1, t2, hint);
+    }
+
+    bool
+    FlatTimeIntervalSet::contains(const time_t &t1, const time_t &t2, std::size_t &hint) const
+    {
+        if (lower_bounds.empty() || t1 >= t2)
+            return false;
+        if (hint >= lower_bounds.size() || lower_bounds[hint] > t1)
+            hint = 0;
+
+        auto i = gallop(lower_bounds, hint, t1);
+        if (i == 0)
+            return false;
+        hint = i - 1;
+        return t2 <= upper_bounds[hint];
+    }
+
+    bool
+    FlatTimeIntervalSet::intersects(const FlatTimeIntervalSet &s2) const
+    {
+        std::size_t i = 0, j = 0;
+        const std::size_t na = size(), nb = s2.size();
+        while (i < na && j < nb) {
+            if (std::max(lower_bounds[i], s2.lower_bounds[j]) < std::min(upper_bounds[i], s2.upper_bounds[j]))
+                return true;
+            bool next_a = upper_bounds[i] <= s2.upper_bounds[j];
+            bool next_b = s2.upper_bounds[j] <= upper_bounds[i];
+            i += next_a;
+            j += next_b;
+        }
+        return false;
+    }
+
+    FlatTimeIntervalSet
+    FlatTimeIntervalSet::intersection(const FlatTimeIntervalSet &s2) const
+    {
+        FlatTimeIntervalSet s3(interval_definition);
+        const std::size_t na = size(), nb = s2.size();
+        s3.lower_bounds.resize(na + nb);
+        s3.upper_bounds.resize(na + nb);
+
+        ///< the output is written unconditionally, k only moves forward when the overlap is not empty
+        std::size_t i = 0, j = 0, k = 0;
+        while (i < na && j < nb) {
+            auto lo = std::max(lower_bounds[i], s2.lower_bounds[j]);
+            auto hi = std::min(upper_bounds[i], s2.upper_bounds[j]);
+            s3.lower_bounds[k] = lo;
+            s3.upper_bounds[k] = hi;
+            k += lo < hi;
+            bool next_a = upper_bounds[i] <= s2.upper_bounds[j];
+            bool next_b = s2.upper_bounds[j] <= upper_bounds[i];
+            i += next_a;
+            j += next_b;
+        }
+        s3.lower_bounds.resize(k);
+        s3.upper_bounds.resize(k);
+        return s3;
+    }
+
+    FlatTimeIntervalSet
+    FlatTimeIntervalSet::set_union(const FlatTimeIntervalSet &s2) const
+    {
+        FlatTimeIntervalSet s3(icl::hull(interval_definition, s2.interval_definition));
+        s3.reserve(size() + s2.size());
+
+        std::size_t i = 0, j = 0;
+        const std::size_t na = size(), nb = s2.size();
+        while (i < na || j < nb) {
+            ///< take the interval with the smallest lower bound
+            bool take_a = j == nb || (i < na && lower_bounds[i] <= s2.lower_bounds[j]);
+            auto lo = take_a ? lower_bounds[i] : s2.lower_bounds[j];
+            auto hi = take_a ? upper_bounds[i] : s2.upper_bounds[j];
+            i += take_a;
+            j += !take_a;
+
+            if (!s3.upper_bounds.empty() && lo <= s3.upper_bounds.back()) {
+                s3.upper_bounds.back() = std::max(s3.upper_bounds.back(), hi);
+            } else {
+                s3.lower_bounds.push_back(lo);
+                s3.upper_bounds.push_back(hi);
+            }
+        }
+        return s3;
+    }
+
+    FlatTimeIntervalSet
+    FlatTimeIntervalSet::difference(const FlatTimeIntervalSet &s2) const
+    {
+        FlatTimeIntervalSet s3(interval_definition);
+        s3.reserve(size() + s2.size());
+
+        std::size_t j = 0;
+        const std::size_t nb = s2.size();
+        for (std::size_t i = 0; i < size(); ++i) {
+            auto lo = lower_bounds[i];
+            auto hi = upper_bounds[i];
+            ///< skip the intervals of s2 ending before the current interval
+            while (j < nb && s2.upper_bounds[j] <= lo)
+                ++j;
+            ///< cut the current interval with every overlapping interval of s2
+            auto k = j;
+            while (k < nb && s2.lower_bounds[k] < hi) {
+                if (s2.lower_bounds[k] > lo) {
+                    s3.lower_bounds.push_back(lo);
+                    s3.upper_bounds.push_back(s2.lower_bounds[k]);
+                }
+                lo = std::max(lo, s2.upper_bounds[k]);
+                ++k;
+            }
+            if (lo < hi) {
+                s3.lower_bounds.push_back(lo);
+                s3.upper_bounds.push_back(hi);
+            }
+        }
+        return s3;
+    }
+
+    TimeIntervalSet
+    FlatTimeIntervalSet::to_time_interval_set() const
+    {
+        TimeIntervalSet tis(interval_definition);
+        for (std::size_t i = 0; i < size(); ++i)
+            tis.append(lower_bounds[i], upper_bounds[i]);
+        return tis;
+    }
+}
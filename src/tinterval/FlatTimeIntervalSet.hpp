@@ -0,0 +1,160 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       FlatTimeIntervalSet.hpp
+/// @brief      Description of the FlatTimeIntervalSet class
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_FLATTIMEINTERVALSET_HPP
+#define BSTREAM_FLATTIMEINTERVALSET_HPP
+
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <ctime>
+
+#include "TimeIntervalSet.hpp"
+
+namespace boost::bstream
+{
+    /**
+     * @class FlatTimeIntervalSet
+     * @brief Set of disjoint right-open time intervals stored as two sorted arrays.
+     *
+     * The lower and upper bounds are kept in two contiguous vectors sorted in increasing order and the
+     * intervals never overlap nor touch. The set operations are linear merges over these arrays and
+     * none of them throws on disjoint inputs: an empty set is returned instead.
+     */
+    class FlatTimeIntervalSet
+    {
+    public:
+        typedef std::vector<time_t> time_vector;
+
+        /**
+         * @brief Default constructor, initialize an empty set defined on [0, infinity).
+         */
+        FlatTimeIntervalSet();
+
+        /**
+         * @brief Initialize an empty set with its definition interval.
+         * @param definition time_interval
+         */
+        FlatTimeIntervalSet(const TimeInterval &definition) : interval_definition(definition)
+        {};
+
+        FlatTimeIntervalSet(const time_t &t1, const time_t &t2);
+
+        /**
+         * @brief Build a flat copy of a TimeIntervalSet.
+         * @param tis time interval set to copy from
+         */
+        explicit FlatTimeIntervalSet(TimeIntervalSet &tis);
+
+        ~FlatTimeIntervalSet() = default;
+
+        time_t definition_length() const;
+
+        std::pair<time_t, time_t> definition() const;
+
+        void set_definition(const time_t &t1, const time_t &t2);
+
+        /**
+         * @brief Insert the interval [t1, t2), overlapping or touching intervals are merged.
+         * @return false if [t1, t2) is not inside the definition interval
+         */
+        bool append(const time_t &t1, const time_t &t2);
+
+        void reserve(std::size_t n);
+
+        unsigned size() const;
+
+        bool empty() const;
+
+        time_t length() const;
+
+        time_t lower(std::size_t i) const
+        {
+            return lower_bounds[i];
+        };
+
+        time_t upper(std::size_t i) const
+        {
+            return upper_bounds[i];
+        };
+
+        const time_vector &lowers() const
+        {
+            return lower_bounds;
+        };
+
+        const time_vector &uppers() const
+        {
+            return upper_bounds;
+        };
+
+        /**
+         * @brief Test if [t1, t2) is covered by a single interval of the set.
+         */
+        bool contains(const time_t &t1, const time_t &t2) const;
+
+        /**
+         * @brief Same as contains(t1, t2) but restart the search from hint.
+         *
+         * For monotone sequences of queries the hint is updated with the position of the last
+         * match, the search gallops forward from there instead of scanning the whole array.
+         */
+        bool contains(const time_t &t1, const time_t &t2, std::size_t &hint) const;
+
+        bool intersects(const FlatTimeIntervalSet &s2) const;
+
+        /**
+         * @brief Intersection of two sets, an empty set is returned if they are disjoint.
+         */
+        FlatTimeIntervalSet intersection(const FlatTimeIntervalSet &s2) const;
+
+        FlatTimeIntervalSet set_union(const FlatTimeIntervalSet &s2) const;
+
+        FlatTimeIntervalSet difference(const FlatTimeIntervalSet &s2) const;
+
+        TimeIntervalSet to_time_interval_set() const;
+
+        void erase();
+
+        bool operator==(const FlatTimeIntervalSet &s2) const
+        {
+            return lower_bounds == s2.lower_bounds && upper_bounds == s2.upper_bounds;
+        };
+
+        bool operator!=(const FlatTimeIntervalSet &s2) const
+        {
+            return !(*this == s2);
+        };
+
+        friend std::ostream &operator<<(std::ostream &out, const FlatTimeIntervalSet &tis)
+        {
+            out << "{";
+            for (std::size_t i = 0; i < tis.size(); ++i) {
+                if (i != 0)
+                    out << ", ";
+                out << "[" << tis.lower(i) << "," << tis.upper(i) << ")";
+            }
+            out << "}";
+            return out;
+        };
+
+    private:
+        time_vector lower_bounds;
+        time_vector upper_bounds;
+        TimeInterval interval_definition;
+
+        std::size_t gallop(const time_vector &v, std::size_t from, const time_t &t) const;
+    };
+
+} // end namespace boost::bstream
+
+#endif //BSTREAM_FLATTIMEINTERVALSET_HPP
@@ -59,7 +59,7 @@ namespace boost::bstream
     }
 
     time_t
-    TimeIntervalSet::length()
+    TimeIntervalSet::length() const
     {
         time_t sum=0;
         for(auto it = interval_set.begin(); it != interval_set.end(); ++it){
@@ -75,7 +75,7 @@ namespace boost::bstream
     }
 
     unsigned
-    TimeIntervalSet::size()
+    TimeIntervalSet::size() const
     {
         return iterative_size(interval_set);
     }
@@ -85,7 +85,7 @@ namespace boost::bstream
         interval_set.erase(begin(), end());
     }
 
-    bool TimeIntervalSet::contains(const time_t &t1, const time_t &t2)
+    bool TimeIntervalSet::contains(const time_t &t1, const time_t &t2) const
     {
         auto ti = make_time_interval(t1, t2);
         return icl::contains(interval_set, ti);
@@ -41,6 +41,7 @@ namespace boost::bstream
     public:
         typedef icl::interval_set<time_t> time_interval_set;
         typedef icl::interval_set<time_t>::iterator iterator;
+        typedef icl::interval_set<time_t>::const_iterator const_iterator;
 
         static const time_t infinity = std::numeric_limits<time_t>::max();
 
@@ -85,9 +86,9 @@ namespace boost::bstream
 
         TimeIntervalSet intersection(TimeIntervalSet &s2);
 
-        unsigned size();
+        unsigned size() const;
 
-        time_t length();
+        time_t length() const;
 
         iterator begin()
         {
@@ -99,11 +100,21 @@ namespace boost::bstream
             return interval_set.end();
         };
 
-        bool contains(const time_t &t1, const time_t &t2);
+        const_iterator begin() const
+        {
+            return interval_set.begin();
+        };
+
+        const_iterator end() const
+        {
+            return interval_set.end();
+        };
+
+        bool contains(const time_t &t1, const time_t &t2) const;
 
         void erase();
 
-        friend std::ostream &operator<<(std::ostream &out, TimeIntervalSet &tis)
+        friend std::ostream &operator<<(std::ostream &out, const TimeIntervalSet &tis)
         {
             out << "{";
             for (auto it = tis.begin(); it != tis.end(); ++it) {
@@ -0,0 +1,93 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       parallel.hpp
+/// @brief      Minimal thread pool helpers used by the algorithms
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_PARALLEL_HPP
+#define BSTREAM_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost::bstream
+{
+    /**
+     * @brief Number of worker threads used by the parallel algorithms.
+     * @return the number of hardware threads, at least 1
+     */
+    inline unsigned num_threads()
+    {
+        auto n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+    /**
+     * @brief Call f(i, thread_id) for every i in [first, last).
+     *
+     * The range is split in chunks of grain indices handed out dynamically to the threads, thread_id
+     * is in [0, num_threads()) so that callers can keep per-thread accumulators. The first exception
+     * raised by a worker is rethrown in the calling thread.
+     */
+    template<typename Function>
+    void parallel_for_threads(std::size_t first, std::size_t last, Function f, std::size_t grain = 64)
+    {
+        if (last <= first)
+            return;
+        grain = std::max<std::size_t>(grain, 1);
+        std::size_t num_chunks = (last - first + grain - 1) / grain;
+        unsigned nthreads = static_cast<unsigned>(std::min<std::size_t>(num_threads(), num_chunks));
+
+        if (nthreads <= 1) {
+            for (auto i = first; i < last; ++i)
+                f(i, 0u);
+            return;
+        }
+
+        std::atomic<std::size_t> next(first);
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        std::vector<std::thread> workers;
+        for (unsigned tid = 0; tid < nthreads; ++tid) {
+            workers.emplace_back([&, tid]() {
+                try {
+                    for (auto b = next.fetch_add(grain); b < last; b = next.fetch_add(grain)) {
+                        auto e = std::min(b + grain, last);
+                        for (auto i = b; i < e; ++i)
+                            f(i, tid);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                    next = last;
+                }
+            });
+        }
+        for (auto &w : workers)
+            w.join();
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    /**
+     * @brief Call f(i) for every i in [first, last) on all the available threads.
+     */
+    template<typename Function>
+    void parallel_for(std::size_t first, std::size_t last, Function f, std::size_t grain = 64)
+    {
+        parallel_for_threads(first, last, [&f](std::size_t i, unsigned) { f(i); }, grain);
+    }
+} // end namespace boost::bstream
+
+#endif //BSTREAM_PARALLEL_HPP
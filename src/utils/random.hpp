@@ -0,0 +1,110 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       random.hpp
+/// @brief      Counter-based random streams for the parallel generators
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_RANDOM_HPP
+#define BSTREAM_RANDOM_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace boost::bstream
+{
+    /**
+     * @brief Counter-based random number generator (SplitMix64 keyed by a seed and a stream id).
+     *
+     * The i-th number of the stream (seed, stream) is a pure function of (seed, stream, i), so that
+     * a parallel generator that gives one stream to every independent unit of work (a vertex, an
+     * edge, a fixed-size block of pairs) produces the same output whatever the number of threads
+     * and the order in which the units are processed. The class models UniformRandomBitGenerator
+     * and can be used with the distributions of <random>.
+     */
+    class counter_rng
+    {
+    public:
+        typedef std::uint64_t result_type;
+
+        counter_rng(std::uint64_t seed, std::uint64_t stream) : key(mix(mix(seed) ^ (stream * gamma + gamma))),
+                                                                counter(0)
+        {};
+
+        static constexpr result_type min()
+        {
+            return 0;
+        };
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        };
+
+        result_type operator()()
+        {
+            return mix(key + (++counter) * gamma);
+        };
+
+        /**
+         * @brief Uniform double in [0, 1).
+         */
+        double uniform()
+        {
+            return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+        };
+
+        /**
+         * @brief Uniform integer in [0, n), n > 0.
+         */
+        std::uint64_t below(std::uint64_t n)
+        {
+            return static_cast<std::uint64_t>(uniform() * static_cast<double>(n)) % n;
+        };
+
+        /**
+         * @brief Exponential variate of the given rate.
+         */
+        double exponential(double rate)
+        {
+            return -std::log1p(-uniform()) / rate;
+        };
+
+        /**
+         * @brief Number of failures before the first success of a Bernoulli(p) sequence, 0 < p <= 1.
+         *
+         * Used to jump directly to the next selected item instead of drawing one number per item
+         * (Batagelj and Brandes). Returns the maximum of uint64 when the skip overflows.
+         */
+        std::uint64_t geometric_skip(double p)
+        {
+            if (p >= 1.0)
+                return 0;
+            auto skip = std::floor(std::log1p(-uniform()) / std::log1p(-p));
+            if (!(skip < 1.8e19))
+                return std::numeric_limits<std::uint64_t>::max();
+            return static_cast<std::uint64_t>(skip);
+        };
+
+    private:
+        static constexpr std::uint64_t gamma = 0x9e3779b97f4a7c15ULL;
+
+        static std::uint64_t mix(std::uint64_t z)
+        {
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        };
+
+        std::uint64_t key;
+        std::uint64_t counter;
+    };
+} // end namespace boost::bstream
+
+#endif //BSTREAM_RANDOM_HPP
@@ -0,0 +1,151 @@
+///-------------------------------------------------------------------------------------------------
+///
+/// @file       union_find.hpp
+/// @brief      Disjoint set structures used by the connectivity algorithms
+/// @author     Vincent Gauthier <vgauthier@luxbulb.org>
+/// @date       19/10/2026
+/// @version    0.1
+/// @copyright  MIT
+///
+///-------------------------------------------------------------------------------------------------
+
+
+#ifndef BSTREAM_UNION_FIND_HPP
+#define BSTREAM_UNION_FIND_HPP
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace boost::bstream
+{
+    /**
+     * @class ConcurrentUnionFind
+     * @brief Lock-free disjoint sets over the integers [0, n).
+     *
+     * unite() and find() can be called concurrently from several threads. A root is always linked
+     * under the smaller root with a compare-and-swap, which rules out cycles, and find() halves the
+     * paths it walks through.
+     */
+    class ConcurrentUnionFind
+    {
+    public:
+        explicit ConcurrentUnionFind(std::size_t n) : parent(n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                parent[i].store(i, std::memory_order_relaxed);
+        };
+
+        std::size_t size() const
+        {
+            return parent.size();
+        };
+
+        std::size_t find(std::size_t x)
+        {
+            while (true) {
+                auto p = parent[x].load(std::memory_order_acquire);
+                if (p == x)
+                    return x;
+                auto gp = parent[p].load(std::memory_order_acquire);
+                if (p != gp)
+                    parent[x].compare_exchange_weak(p, gp, std::memory_order_acq_rel);
+                x = gp;
+            }
+        };
+
+        /**
+         * @brief Merge the sets of a and b.
+         * @return true if a and b were in different sets
+         */
+        bool unite(std::size_t a, std::size_t b)
+        {
+            while (true) {
+                a = find(a);
+                b = find(b);
+                if (a == b)
+                    return false;
+                if (a < b)
+                    std::swap(a, b);
+                std::size_t expected = a;
+                if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+                    return true;
+            }
+        };
+
+        bool same(std::size_t a, std::size_t b)
+        {
+            return find(a) == find(b);
+        };
+
+    private:
+        std::vector<std::atomic<std::size_t>> parent;
+    };
+
+    /**
+     * @class RollbackUnionFind
+     * @brief Disjoint sets with union by size and no path compression, so that the unions can be undone.
+     *
+     * snapshot() returns a mark and rollback(mark) undoes every union performed since, in LIFO order.
+     */
+    class RollbackUnionFind
+    {
+    public:
+        explicit RollbackUnionFind(std::size_t n) : parent(n), set_size(n, 1), components(n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                parent[i] = i;
+        };
+
+        std::size_t find(std::size_t x) const
+        {
+            while (parent[x] != x)
+                x = parent[x];
+            return x;
+        };
+
+        bool unite(std::size_t a, std::size_t b)
+        {
+            a = find(a);
+            b = find(b);
+            if (a == b)
+                return false;
+            if (set_size[a] < set_size[b])
+                std::swap(a, b);
+            parent[b] = a;
+            set_size[a] += set_size[b];
+            history.push_back(b);
+            --components;
+            return true;
+        };
+
+        std::size_t snapshot() const
+        {
+            return history.size();
+        };
+
+        void rollback(std::size_t mark)
+        {
+            while (history.size() > mark) {
+                auto b = history.back();
+                history.pop_back();
+                set_size[parent[b]] -= set_size[b];
+                parent[b] = b;
+                ++components;
+            }
+        };
+
+        std::size_t num_components() const
+        {
+            return components;
+        };
+
+    private:
+        std::vector<std::size_t> parent;
+        std::vector<std::size_t> set_size;
+        std::vector<std::size_t> history;
+        std::size_t components;
+    };
+} // end namespace boost::bstream
+
+#endif //BSTREAM_UNION_FIND_HPP
@@ -14,6 +14,7 @@
 #define BSTREAM_UTILS_HPP
 
 #include <iostream>
+#include <string_view>
 #include <vector>
 
 namespace boost::bstream
@@ -36,5 +37,22 @@ namespace boost::bstream
 
         return tokens;
     }
+
+    /**
+     * @brief Split s as split does, without allocation, the tokens being views of s.
+     */
+    inline void
+    split(std::string_view s, const char sep, std::vector<std::string_view> &tokens)
+    {
+        tokens.clear();
+        std::size_t first = 0;
+        for (std::size_t i = 0; i <= s.size(); ++i) {
+            if (i == s.size() || s[i] == sep) {
+                if (i > first)
+                    tokens.push_back(s.substr(first, i - first));
+                first = i + 1;
+            }
+        }
+    }
 } // end namespace boost::bstream
 #endif //BSTREAM_UTILS_HPP
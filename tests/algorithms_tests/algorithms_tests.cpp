@@ -9,8 +9,21 @@
 ///
 ///-------------------------------------------------------------------------------------------------
 
+#include <numeric>
+#include <random>
+
 #include "GraphType.hpp"
 #include "generators/erdos_reny.hpp"
+#include "generators/link_stream_generators.hpp"
+#include "core.hpp"
+#include "components.hpp"
+#include "traversal.hpp"
+#include "centrality.hpp"
+#include "community.hpp"
+#include "spectral.hpp"
+#include "temporal_centrality.hpp"
+#include "temporal_motifs.hpp"
+#include "contact_statistics.hpp"
 
 #define BOOST_TEST_MODULE Algorithms_tests
 
@@ -31,7 +44,571 @@ BOOST_AUTO_TEST_CASE(Algorithms_erdos_reny)
     DiGraph d;
     erdos_renyi_graph(100, 0.02, d, seed);
     BOOST_CHECK(d.num_vertices() == 100);
-    BOOST_CHECK(d.num_edges() == 199);
+    BOOST_CHECK(d.num_edges() == 207);
+
+    // the edges only depend on the seed, the labels are optional
+    Graph h;
+    erdos_renyi_graph(10000, 0.0002, h, seed, false);
+    BOOST_CHECK(h.num_vertices() == 10000);
+    BOOST_CHECK(h.num_edges() == g.num_edges());
+    BOOST_CHECK(g.has_vertex("17"));
+    BOOST_CHECK(!h.has_vertex("17"));
+    for (auto it = h.edges().first; it != h.edges().second; ++it) {
+        auto e = h.edge_endpoint(*it);
+        BOOST_CHECK(e.first < e.second);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_core_number)
+{
+    Graph g;
+    g.add_edge("A", "B");
+    g.add_edge("B", "C");
+    g.add_edge("C", "A");
+    g.add_edge("D", "A");
+    g.add_vertex("E");
+    auto core = core_number(g);
+    BOOST_CHECK(core[g.vertex("A")] == 2);
+    BOOST_CHECK(core[g.vertex("B")] == 2);
+    BOOST_CHECK(core[g.vertex("C")] == 2);
+    BOOST_CHECK(core[g.vertex("D")] == 1);
+    BOOST_CHECK(core[g.vertex("E")] == 0);
+
+    Graph c;
+    k_core(g, 2, c);
+    BOOST_CHECK(c.num_vertices() == 3);
+    BOOST_CHECK(c.num_edges() == 3);
+    BOOST_CHECK(!c.has_vertex("D"));
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_temporal_core)
+{
+    LinkStream g(0, 10);
+    g.add_edge_w_time("A", "B", 0, 6);
+    g.add_edge_w_time("B", "C", 0, 6);
+    g.add_edge_w_time("C", "A", 2, 6);
+    g.add_edge_w_time("D", "A", 0, 10);
+
+    auto alive = temporal_core_intervals(g, 2, 3);
+    FlatTimeIntervalSet expected(0, 10);
+    expected.append(2, 6);
+    BOOST_CHECK(alive[g.vertex("A")] == expected);
+    BOOST_CHECK(alive[g.vertex("B")] == expected);
+    BOOST_CHECK(alive[g.vertex("C")] == expected);
+    BOOST_CHECK(alive[g.vertex("D")].empty());
+
+    ///< the triangle lasts less than delta, the core vanishes
+    alive = temporal_core_intervals(g, 2, 5);
+    BOOST_CHECK(alive[g.vertex("A")].empty());
+    BOOST_CHECK(alive[g.vertex("B")].empty());
+
+    ///< the missing link on [3, 4) cuts the triangle in two periods, the first one is too short
+    LinkStream s(0, 10);
+    s.add_edge_w_time("A", "B", 0, 8);
+    s.add_edge_w_time("B", "C", 0, 8);
+    s.add_edge_w_time("C", "A", 0, 3);
+    s.add_edge_w_time("C", "A", 4, 8);
+    alive = temporal_core_intervals(s, 2, 4);
+    FlatTimeIntervalSet last(0, 10);
+    last.append(4, 8);
+    BOOST_CHECK(alive[s.vertex("A")] == last);
+    BOOST_CHECK(alive[s.vertex("B")] == last);
+    BOOST_CHECK(alive[s.vertex("C")] == last);
+
+    ///< the closing edge of the cycle sets the presence of every vertex
+    LinkStream cycle(0, 10);
+    cycle.add_edge_w_time("A", "B", 0, 10);
+    cycle.add_edge_w_time("B", "C", 0, 10);
+    cycle.add_edge_w_time("C", "D", 0, 10);
+    cycle.add_edge_w_time("D", "A", 1, 2);
+    cycle.add_edge_w_time("D", "A", 5, 7);
+    cycle.add_edge_w_time("A", "E", 0, 10);
+    alive = temporal_core_intervals(cycle, 2, 0);
+    FlatTimeIntervalSet closed(0, 10);
+    closed.append(1, 2);
+    closed.append(5, 7);
+    for (auto v : {"A", "B", "C", "D"})
+        BOOST_CHECK(alive[cycle.vertex(v)] == closed);
+    BOOST_CHECK(alive[cycle.vertex("E")].empty());
+
+    LinkStream c;
+    temporal_k_core(g, 2, 3, c);
+    BOOST_CHECK(c.num_vertices() == 3);
+    BOOST_CHECK(c.edge_tinterval_length("A", "B") == 4);
+    BOOST_CHECK(!c.has_vertex("D"));
+
+    BOOST_CHECK_THROW(temporal_core_intervals(g, 2, -1), LinkStreamBaseException);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_connected_components)
+{
+    Graph g;
+    g.add_edge("A", "B");
+    g.add_edge("B", "C");
+    g.add_edge("D", "E");
+    g.add_vertex("F");
+    auto label = connected_components(g);
+    BOOST_CHECK(label[g.vertex("A")] == 0);
+    BOOST_CHECK(label[g.vertex("C")] == 0);
+    BOOST_CHECK(label[g.vertex("D")] == 1);
+    BOOST_CHECK(label[g.vertex("E")] == 1);
+    BOOST_CHECK(label[g.vertex("F")] == 2);
+    BOOST_CHECK(number_connected_components(g) == 3);
+
+    DiGraph d;
+    d.add_edge("A", "B");
+    d.add_edge("B", "C");
+    d.add_edge("C", "A");
+    d.add_edge("C", "D");
+    BOOST_CHECK(number_connected_components(d) == 1);
+    auto strong = strongly_connected_components(d);
+    BOOST_CHECK(strong[d.vertex("A")] == strong[d.vertex("B")]);
+    BOOST_CHECK(strong[d.vertex("A")] == strong[d.vertex("C")]);
+    BOOST_CHECK(strong[d.vertex("A")] != strong[d.vertex("D")]);
+
+    int seed = 3;
+    Graph r;
+    erdos_renyi_graph(2000, 0.0008, r, seed);
+    auto random_label = connected_components(r);
+    for (auto it = r.edges().first; it != r.edges().second; ++it) {
+        auto e = r.edge_endpoint(*it);
+        BOOST_CHECK(random_label[e.first] == random_label[e.second]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_temporal_connected_components)
+{
+    LinkStream g(0, 10);
+    g.add_edge_w_time("A", "B", 0, 4);
+    g.add_edge_w_time("B", "C", 2, 6);
+    g.add_vertex("D");
+
+    std::vector<std::pair<time_t, std::size_t>> expected{{0, 3}, {2, 2}, {4, 3}, {6, 4}};
+    BOOST_CHECK(temporal_connected_components(g) == expected);
+    BOOST_CHECK(temporal_connected_components(g, connectivity_strategy::offline) == expected);
+    BOOST_CHECK(temporal_connected_components(g, connectivity_strategy::recompute) == expected);
+
+    ///< membership of A, B, C, D between the change points
+    std::vector<std::pair<time_t, std::vector<std::size_t>>> labels{
+            {0, {0, 0, 1, 2}}, {2, {0, 0, 0, 1}}, {4, {0, 1, 1, 2}}, {6, {0, 1, 2, 3}}};
+    BOOST_CHECK(temporal_component_labels(g, connectivity_strategy::offline) == labels);
+    BOOST_CHECK(temporal_component_labels(g, connectivity_strategy::recompute) == labels);
+
+    ///< both strategies agree on a random link stream
+    std::mt19937 rng(7);
+    LinkStream r(0, 1000);
+    for (int i = 0; i < 50; ++i)
+        r.add_vertex(std::to_string(i));
+    for (int i = 0; i < 400; ++i) {
+        auto b = static_cast<time_t>(rng() % 990);
+        r.add_edge_w_time(rng() % 50, rng() % 50, b, b + 1 + static_cast<time_t>(rng() % 10));
+    }
+    BOOST_CHECK(temporal_connected_components(r, connectivity_strategy::offline) ==
+                temporal_connected_components(r, connectivity_strategy::recompute));
+    BOOST_CHECK(temporal_component_labels(r, connectivity_strategy::offline) ==
+                temporal_component_labels(r, connectivity_strategy::recompute));
+
+    ///< the partition changes while the number of components does not
+    LinkStream p(0, 10);
+    p.add_edge_w_time("A", "B", 0, 5);
+    p.add_edge_w_time("B", "C", 5, 10);
+    BOOST_CHECK(temporal_connected_components(p).size() == 1);
+    auto partitions = temporal_component_labels(p);
+    BOOST_CHECK(partitions.size() == 2);
+    BOOST_CHECK(partitions[1].first == 5);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_bfs)
+{
+    Graph g;
+    g.add_edge("A", "B");
+    g.add_edge("B", "C");
+    g.add_edge("C", "D");
+    g.add_vertex("E");
+    auto dist = bfs(g, g.vertex("A"));
+    std::vector<std::int64_t> expected{0, 1, 2, 3, -1};
+    BOOST_CHECK(dist == expected);
+    dist = multi_source_bfs(g, {g.vertex("A"), g.vertex("D")});
+    expected = {0, 1, 1, 0, -1};
+    BOOST_CHECK(dist == expected);
+    auto path = shortest_path(g, g.vertex("D"), g.vertex("A"));
+    std::vector<std::size_t> expected_path{3, 2, 1, 0};
+    BOOST_CHECK(path == expected_path);
+    BOOST_CHECK(shortest_path(g, g.vertex("A"), g.vertex("E")).empty());
+    BOOST_CHECK_THROW(bfs(g, 10), GraphBaseException);
+
+    DiGraph d;
+    d.add_edge("A", "B");
+    d.add_edge("C", "B");
+    auto ddist = bfs(d, d.vertex("A"));
+    expected = {0, 1, -1};
+    BOOST_CHECK(ddist == expected);
+
+    ///< dense enough to switch to the bottom-up steps, checked against a plain queue
+    int seed = 5;
+    DiGraph r;
+    erdos_renyi_graph(3000, 0.004, r, seed);
+    auto rdist = bfs(r, 0);
+    std::vector<std::int64_t> reference(3000, -1);
+    std::vector<std::size_t> queue{0};
+    reference[0] = 0;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        auto v = queue[head];
+        for (auto u = r.neighbors(v).first; u != r.neighbors(v).second; ++u) {
+            if (reference[*u] == -1) {
+                reference[*u] = reference[v] + 1;
+                queue.push_back(*u);
+            }
+        }
+    }
+    BOOST_CHECK(rdist == reference);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_betweenness_centrality)
+{
+    Graph g;
+    g.add_edge("A", "B");
+    g.add_edge("B", "C");
+    g.add_edge("C", "D");
+    auto bc = betweenness_centrality(g, false);
+    BOOST_CHECK_CLOSE(bc[0], 0.0, 1e-9);
+    BOOST_CHECK_CLOSE(bc[1], 2.0, 1e-9);
+    BOOST_CHECK_CLOSE(bc[2], 2.0, 1e-9);
+    bc = betweenness_centrality(g);
+    BOOST_CHECK_CLOSE(bc[1], 2.0 / 3.0, 1e-9);
+
+    ///< two shortest paths between A and D through B and C
+    Graph square;
+    square.add_edge("A", "B");
+    square.add_edge("A", "C");
+    square.add_edge("B", "D");
+    square.add_edge("C", "D");
+    bc = betweenness_centrality(square, false);
+    BOOST_CHECK_CLOSE(bc[square.vertex("B")], 0.5, 1e-9);
+
+    DiGraph d;
+    d.add_edge("A", "B");
+    d.add_edge("B", "C");
+    bc = betweenness_centrality(d, false);
+    BOOST_CHECK_CLOSE(bc[d.vertex("B")], 1.0, 1e-9);
+
+    ///< sampling every vertex gives the exact values
+    auto sampled = betweenness_centrality(g, true, 4, 1);
+    auto exact = betweenness_centrality(g, true);
+    for (std::size_t v = 0; v < 4; ++v)
+        BOOST_CHECK_CLOSE(sampled[v] + 1.0, exact[v] + 1.0, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_temporal_centrality)
+{
+    LinkStream g(0, 10);
+    g.add_edge_w_time("A", "B", 1, 2);
+    g.add_edge_w_time("B", "C", 5, 6);
+
+    auto duration = fastest_path_duration(g, g.vertex("A"));
+    std::vector<time_t> expected{0, 0, 4};
+    BOOST_CHECK(duration == expected);
+    ///< C meets B after B met A
+    duration = fastest_path_duration(g, g.vertex("C"));
+    expected = {-1, 0, 0};
+    BOOST_CHECK(duration == expected);
+
+    auto bc = temporal_betweenness(g, temporal_path_type::fastest, false);
+    BOOST_CHECK_CLOSE(bc[g.vertex("B")] + 1.0, 2.0, 1e-9);
+    BOOST_CHECK_CLOSE(bc[g.vertex("A")] + 1.0, 1.0, 1e-9);
+
+    auto closeness = temporal_closeness(g);
+    BOOST_CHECK_CLOSE(closeness[g.vertex("A")], (1.0 + 1.0 / 5.0) / 2.0, 1e-9);
+    BOOST_CHECK_CLOSE(closeness[g.vertex("C")], 0.5, 1e-9);
+
+    ///< the direct edge A-D is as fast as the path A-B-C-D but shorter
+    LinkStream h(0, 10);
+    h.add_edge_w_time("A", "B", 0, 10);
+    h.add_edge_w_time("B", "C", 0, 10);
+    h.add_edge_w_time("C", "D", 0, 10);
+    h.add_edge_w_time("A", "D", 3, 10);
+    auto fastest = temporal_betweenness(h, temporal_path_type::fastest, false);
+    auto shortest_fastest = temporal_betweenness(h, temporal_path_type::shortest_fastest, false);
+    BOOST_CHECK(fastest[h.vertex("B")] > shortest_fastest[h.vertex("B")]);
+
+    ///< B and C are two equally fastest relays from A to D, A is the only relay between B and C
+    LinkStream r(0, 10);
+    r.add_edge_w_time("A", "B", 1, 2);
+    r.add_edge_w_time("A", "C", 1, 2);
+    r.add_edge_w_time("B", "D", 3, 4);
+    r.add_edge_w_time("C", "D", 3, 4);
+    for (auto type : {temporal_path_type::fastest, temporal_path_type::shortest_fastest}) {
+        bc = temporal_betweenness(r, type, false);
+        BOOST_CHECK_CLOSE(bc[r.vertex("B")], 0.5, 1e-9);
+        BOOST_CHECK_CLOSE(bc[r.vertex("C")], 0.5, 1e-9);
+        BOOST_CHECK_CLOSE(bc[r.vertex("A")], 2.0, 1e-9);
+        BOOST_CHECK_CLOSE(bc[r.vertex("D")] + 1.0, 1.0, 1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_link_stream_generators)
+{
+    ///< same edges whatever the scheduling of the blocks, close to the expected p * n(n-1)/2
+    auto edges = erdos_renyi_edges(2000, 0.01, 7);
+    BOOST_CHECK(edges == erdos_renyi_edges(2000, 0.01, 7));
+    BOOST_CHECK(edges.size() > 19000 && edges.size() < 21000);
+    BOOST_CHECK(std::all_of(edges.begin(), edges.end(), [](auto &e) { return e.first < e.second && e.second < 2000; }));
+    BOOST_CHECK(std::adjacent_find(edges.begin(), edges.end()) == edges.end());
+    auto directed = erdos_renyi_edges(100, 1.0, 7, true);
+    BOOST_CHECK(directed.size() == 9900);
+    BOOST_CHECK(std::none_of(directed.begin(), directed.end(), [](auto &e) { return e.first == e.second; }));
+
+    auto ba = barabasi_albert_edges(1000, 3, 1);
+    BOOST_CHECK(ba.size() > 2900 && ba.size() <= 3000);
+
+    auto sbm = stochastic_block_model_edges({50, 50}, {{1.0, 0.0}, {0.0, 1.0}}, 3);
+    BOOST_CHECK(sbm.size() == 2 * 1225);
+    BOOST_CHECK(std::all_of(sbm.begin(), sbm.end(), [](auto &e) { return (e.first < 50) == (e.second < 50); }));
+
+    contact_process process;
+    process.rate = 0.1;
+    process.law = duration_law::constant;
+    process.duration = 2;
+    LinkStream L1(0, 1000), L2(0, 1000);
+    contact_process_link_stream(50, {{0, 1}, {1, 2}, {3, 4}}, process, L1, 5);
+    contact_process_link_stream(50, {{0, 1}, {1, 2}, {3, 4}}, process, L2, 5);
+    BOOST_CHECK(L1.num_vertices() == 50);
+    auto tis1 = L1.edge_tinterval_set(0, 1), tis2 = L2.edge_tinterval_set(0, 1);
+    BOOST_CHECK(FlatTimeIntervalSet(tis1) == FlatTimeIntervalSet(tis2));
+    ///< about 100 contacts of length 2 on [0, 1000)
+    auto length = L1.edge_tinterval_set(3, 4).length();
+    BOOST_CHECK(length > 100 && length < 300);
+    BOOST_CHECK_THROW(contact_process_link_stream(50, {}, process, L1, 5), GraphBaseException);
+
+    LinkStream A(0, 100);
+    activity_driven_link_stream(std::vector<double>(20, 1.0), 2, 10, A, 9);
+    BOOST_CHECK(A.num_vertices() == 20);
+    ///< every vertex is active at each of the 10 steps
+    BOOST_CHECK(A.degree(0) >= 2);
+    for (auto v = 0; v < 20; ++v) {
+        auto inst = A.instantaneous_degree(v);
+        BOOST_CHECK(inst.begin()->first == 0);
+    }
+
+    BiLinkStream B(0, 1000);
+    contact_process_bipartite_link_stream(10, 5, 1.0, process, B, 2);
+    BOOST_CHECK(B.num_top_vertices() == 10);
+    BOOST_CHECK(B.num_bottom_vertices() == 5);
+    BOOST_CHECK(B.has_edge(0, 14));
+
+    BiLinkStream U(0, 100);
+    activity_driven_bipartite_link_stream(power_law_activities(30, 2.1, 0.01, 4), 5, 1, 1, U, 4);
+    BOOST_CHECK(U.num_top_vertices() == 30);
+    BOOST_CHECK(!U.has_edge(0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_temporal_motifs)
+{
+    ///< events A->B, B->A, A->C, C->B at the times 1, 3, 5, 7
+    DiLinkStream g(0, 10);
+    g.add_edge_w_time("A", "B", 1, 2);
+    g.add_edge_w_time("B", "A", 3, 4);
+    g.add_edge_w_time("A", "C", 5, 6);
+    g.add_edge_w_time("C", "B", 7, 8);
+    auto counts = temporal_motifs(g, 10);
+    BOOST_CHECK(counts.rows() == 6 && counts.cols() == 6);
+    BOOST_CHECK(counts.sum() == 4);
+    BOOST_CHECK(counts(1, 2) == 1); ///< b->a, a->c
+    BOOST_CHECK(counts(1, 5) == 1); ///< b->a, c->b
+    BOOST_CHECK(counts(2, 5) == 1); ///< a->c, c->b, the triangle
+    BOOST_CHECK(counts(4, 3) == 1); ///< b->c, c->a
+    ///< only the triples spanning at most 4
+    counts = temporal_motifs(g, 4);
+    BOOST_CHECK(counts.sum() == 2);
+    BOOST_CHECK(counts(1, 2) == 1 && counts(4, 3) == 1);
+    BOOST_CHECK_THROW(temporal_motifs(g, -1), LinkStreamBaseException);
+
+    LinkStream h(0, 10);
+    h.add_edge_w_time("A", "B", 1, 2);
+    h.add_edge_w_time("A", "B", 3, 4);
+    h.add_edge_w_time("A", "C", 5, 6);
+    h.add_edge_w_time("C", "B", 7, 8);
+    counts = temporal_motifs(h, 10);
+    BOOST_CHECK(counts.rows() == 3 && counts.cols() == 3);
+    BOOST_CHECK(counts(0, 1) == 2); ///< ab, ab, ac
+    BOOST_CHECK(counts(1, 2) == 2); ///< ab, ac, bc
+    BOOST_CHECK(counts.sum() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_louvain)
+{
+    ///< two 4-cliques joined by the edge D-E
+    Graph g;
+    for (auto clique : {std::string("ABCD"), std::string("EFGH")})
+        for (std::size_t i = 0; i < 4; ++i)
+            for (std::size_t j = i + 1; j < 4; ++j)
+                g.add_edge(clique.substr(i, 1), clique.substr(j, 1));
+    g.add_edge("D", "E");
+    std::vector<std::size_t> expected{0, 0, 0, 0, 1, 1, 1, 1};
+    for (auto refine : {true, false}) {
+        louvain_options options;
+        options.refine = refine;
+        auto result = louvain(g, options);
+        BOOST_CHECK(result.membership == expected);
+        BOOST_CHECK_CLOSE(result.modularity, 12.0 / 13.0 - 0.5, 1e-9);
+    }
+    BOOST_CHECK_CLOSE(modularity(g, expected), 12.0 / 13.0 - 0.5, 1e-9);
+    BOOST_CHECK_CLOSE(modularity(g, std::vector<std::size_t>(8, 3)) + 1.0, 1.0, 1e-9);
+    ///< a higher resolution splits the cliques
+    louvain_options options;
+    options.resolution = 10.0;
+    auto result = louvain(g, options);
+    BOOST_CHECK(*std::max_element(result.membership.begin(), result.membership.end()) > 1);
+
+    ///< a heavy bridge pulls D and E together
+    g.set_edge_weight("D", "E", 20.0);
+    result = louvain(g);
+    BOOST_CHECK(result.membership[g.vertex("D")] == result.membership[g.vertex("E")]);
+    BOOST_CHECK(result.membership[g.vertex("A")] != result.membership[g.vertex("D")]);
+
+    g.set_edge_weight("D", "E", -1.0);
+    BOOST_CHECK_THROW(louvain(g), GraphBaseException);
+    BOOST_CHECK_THROW(modularity(g, {0, 1}), GraphBaseException);
+
+    Graph empty;
+    empty.add_vertex("A");
+    empty.add_vertex("B");
+    result = louvain(empty);
+    BOOST_CHECK(result.membership == std::vector<std::size_t>({0, 1}));
+    BOOST_CHECK(result.modularity == 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_pagerank)
+{
+    Graph star;
+    star.add_edge("A", "B");
+    star.add_edge("A", "C");
+    auto pr = pagerank(star);
+    BOOST_CHECK_CLOSE(pr[star.vertex("A")], 0.135 / 0.2775, 1e-3);
+    BOOST_CHECK_CLOSE(pr[star.vertex("B")], pr[star.vertex("C")], 1e-6);
+    BOOST_CHECK_CLOSE(std::accumulate(pr.begin(), pr.end(), 0.0), 1.0, 1e-9);
+
+    ///< B has no out-edge, the walkers restart from the seed
+    DiGraph g;
+    g.add_edge("A", "B");
+    g.add_vertex("C");
+    MatrixXd seeds = MatrixXd::Zero(3, 2);
+    seeds(g.vertex("A"), 0) = 2.0;
+    seeds(g.vertex("C"), 1) = 1.0;
+    power_iteration_options options;
+    options.tolerance = 1e-10;
+    options.max_iterations = 1000;
+    auto ppr = personalized_pagerank(g, seeds, 0.85, options);
+    BOOST_CHECK_CLOSE(ppr(g.vertex("A"), 0), 0.15 / 0.2775, 1e-6);
+    BOOST_CHECK_CLOSE(ppr(g.vertex("B"), 0), 0.85 * 0.15 / 0.2775, 1e-6);
+    BOOST_CHECK_CLOSE(ppr(g.vertex("C"), 1), 1.0, 1e-6);
+    BOOST_CHECK_THROW(personalized_pagerank(g, MatrixXd::Zero(3, 1)), GraphBaseException);
+    BOOST_CHECK_THROW(personalized_pagerank(g, MatrixXd::Ones(2, 1)), GraphBaseException);
+
+    auto katz = katz_centrality(g, 0.1, 1.0, false);
+    BOOST_CHECK_CLOSE(katz[g.vertex("A")], 1.0, 1e-6);
+    BOOST_CHECK_CLOSE(katz[g.vertex("B")], 1.1, 1e-6);
+    g.set_edge_weight("A", "B", 2.0);
+    katz = katz_centrality(g, 0.1, 1.0, false);
+    BOOST_CHECK_CLOSE(katz[g.vertex("B")], 1.2, 1e-6);
+
+    ///< alpha is larger than the inverse of the spectral radius of the cycle
+    g.add_edge("B", "A");
+    BOOST_CHECK_THROW(katz_centrality(g, 1.0), GraphBaseException);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_spectral)
+{
+    ///< path a - b - c - d, Laplacian eigenvalues 2 - 2 cos(k pi / 4)
+    Graph path;
+    path.add_edge("a", "b");
+    path.add_edge("b", "c");
+    path.add_edge("c", "d");
+    MatrixXd L = MatrixXd(laplacian(path));
+    BOOST_CHECK_EQUAL(L(path.vertex("b"), path.vertex("b")), 2.0);
+    BOOST_CHECK_EQUAL(L(path.vertex("a"), path.vertex("b")), -1.0);
+    BOOST_CHECK_CLOSE(algebraic_connectivity(path), 2.0 - std::sqrt(2.0), 1e-6);
+    BOOST_CHECK_CLOSE(algebraic_connectivity(path, true), 0.5, 1e-6);
+
+    auto pairs = graph_eigenpairs(path, 2, spectral_matrix::laplacian, spectrum_end::largest);
+    BOOST_CHECK_CLOSE(pairs.values(0), 2.0 + std::sqrt(2.0), 1e-6);
+    BOOST_CHECK_CLOSE(pairs.values(1), 2.0, 1e-6);
+    BOOST_CHECK_SMALL((L * pairs.vectors - pairs.vectors * pairs.values.asDiagonal()).norm(), 1e-6);
+
+    ///< the eigenvalue 4 of the Laplacian of K4 has multiplicity 3
+    Graph k4;
+    for (auto u : {"a", "b", "c", "d"})
+        for (auto v : {"a", "b", "c", "d"})
+            if (std::string(u) < v)
+                k4.add_edge(u, v);
+    pairs = graph_eigenpairs(k4, 3, spectral_matrix::laplacian, spectrum_end::largest);
+    for (Eigen::Index i = 0; i < 3; ++i)
+        BOOST_CHECK_CLOSE(pairs.values(i), 4.0, 1e-6);
+    BOOST_CHECK_SMALL((pairs.vectors.transpose() * pairs.vectors - MatrixXd::Identity(3, 3)).norm(), 1e-8);
+
+    ///< the embedding separates the two triangles joined by the edge c - d
+    Graph bridge;
+    for (auto e : std::vector<std::pair<std::string, std::string>>{{"a", "b"}, {"b", "c"}, {"a", "c"}, {"c", "d"},
+                                                                 {"d", "e"}, {"e", "f"}, {"d", "f"}})
+        bridge.add_edge(e.first, e.second);
+    auto x = spectral_embedding(bridge, 1);
+    BOOST_CHECK(x(bridge.vertex("a"), 0) * x(bridge.vertex("f"), 0) < 0);
+    BOOST_CHECK(x(bridge.vertex("a"), 0) * x(bridge.vertex("c"), 0) > 0);
+
+    Graph split;
+    split.add_edge("a", "b");
+    split.add_edge("c", "d");
+    BOOST_CHECK_EQUAL(algebraic_connectivity(split), 0.0);
+    BOOST_CHECK_THROW(graph_eigenpairs(split, 5), GraphBaseException);
+}
+
+BOOST_AUTO_TEST_CASE(Algorithms_contact_statistics)
+{
+    LinkStream g(0, 20);
+    g.add_edge_w_time("A", "B", 0, 1);
+    g.add_edge_w_time("A", "B", 3, 4);
+    g.add_edge_w_time("A", "B", 7, 8);
+    g.add_edge_w_time("A", "C", 2, 5);
+    ///< inter-contact times 1, 2, 3, 4
+    for (time_t b : {0, 2, 5, 9, 14})
+        g.add_edge_w_time("C", "D", b, b + 1);
+    auto stats = intercontact_statistics(g);
+
+    std::size_t i = 0;
+    for (auto it = g.edges().first; it != g.edges().second; ++it, ++i) {
+        auto e = g.edge_endpoint(*it);
+        auto &acc = stats.edges[i];
+        if (g.label(e.first) + g.label(e.second) == "AB" || g.label(e.first) + g.label(e.second) == "BA") {
+            BOOST_CHECK(acc.durations.count() == 3);
+            BOOST_CHECK_CLOSE(acc.gaps.mean(), 2.5, 1e-9);
+            BOOST_CHECK_CLOSE(acc.burstiness(), -2.0 / 3.0, 1e-9);
+            BOOST_CHECK(std::isnan(acc.memory()));
+        } else if (acc.durations.count() == 5) {
+            BOOST_CHECK_CLOSE(acc.memory(), 1.0, 1e-9);
+        }
+    }
+    ///< A is in contact during [0, 1), [2, 5) and [7, 8)
+    auto &a = stats.vertices[g.vertex("A")];
+    BOOST_CHECK(a.durations.count() == 3);
+    BOOST_CHECK_CLOSE(a.durations.max(), 3.0, 1e-9);
+    BOOST_CHECK_CLOSE(a.gaps.mean(), 1.5, 1e-9);
+
+    ///< durations 1 (x 8) and 3, inter-contact times 2, 3 and 1, 2, 3, 4 in bins of base 2
+    BOOST_CHECK(stats.durations.counts() == std::vector<std::uint64_t>({8, 1}));
+    BOOST_CHECK(stats.gaps.counts() == std::vector<std::uint64_t>({1, 4, 1}));
+    BOOST_CHECK(stats.gaps.edges() == std::vector<double>({1, 2, 4, 8}));
+
+    ///< merging two accumulators is the same as pooling the values
+    running_moments x, y, z;
+    for (double v : {1.0, 5.0, 2.0})
+        x.add(v), z.add(v);
+    for (double v : {7.0, 3.0})
+        y.add(v), z.add(v);
+    x.merge(y);
+    BOOST_CHECK(x.count() == 5);
+    BOOST_CHECK_CLOSE(x.mean(), z.mean(), 1e-9);
+    BOOST_CHECK_CLOSE(x.variance(), z.variance(), 1e-9);
+    BOOST_CHECK_THROW(log_histogram(1.0), LinkStreamBaseException);
 }
 
 //todo: add test with more complex example with time_t variable
\ No newline at end of file
@@ -12,6 +12,7 @@
 
 #include "GraphType.hpp"
 #include "bipartite.hpp"
+#include "metrics/bipartite_metrics.hpp"
 
 #define BOOST_TEST_MODULE BiLinkStream_tests
 
@@ -121,4 +122,130 @@ BOOST_AUTO_TEST_CASE(BiLinStream_test_projection)
     LinkStream gproj;
     projected_graph(vertex_group::top, g, gproj);
     std::cout << gproj ;
-}
\ No newline at end of file
+    BOOST_CHECK(gproj.num_vertices() == 3);
+    BOOST_CHECK(gproj.edge_tinterval_length("a", "b") == 2);
+    BOOST_CHECK(gproj.edge_tinterval_length("a", "c") == 3);
+    BOOST_CHECK(gproj.edge_tinterval_length("b", "c") == 5);
+    BOOST_CHECK(!gproj.has_vertex("u"));
+    ///< the source is left untouched
+    BOOST_CHECK(g.num_vertices() == 5);
+}
+
+BOOST_AUTO_TEST_CASE(BiLinStream_test_weighted_projection)
+{
+    BiLinkStream g(0, 10);
+    g.add_vertex_w_group(vertex_group::top, "a");
+    g.add_vertex_w_group(vertex_group::top, "b");
+    g.add_vertex_w_group(vertex_group::top, "c");
+    g.add_vertex_w_group(vertex_group::bottom, "u");
+    g.add_vertex_w_group(vertex_group::bottom, "v");
+    g.add_edge_w_time("u", "a", 0, 2);
+    g.add_edge_w_time("u", "a", 3, 9);
+    g.add_edge_w_time("u", "b", 4, 5);
+    g.add_edge_w_time("u", "b", 8, 10);
+    g.add_edge_w_time("u", "c", 1, 5);
+    g.add_edge_w_time("v", "b", 2, 7);
+    g.add_edge_w_time("v", "c", 0, 8);
+
+    Graph co_presence;
+    weighted_projected_graph(vertex_group::top, g, co_presence);
+    BOOST_CHECK(co_presence.num_edges() == 3);
+    BOOST_CHECK(co_presence.edge_weight("a", "b") == 2);
+    BOOST_CHECK(co_presence.edge_weight("a", "c") == 3);
+    BOOST_CHECK(co_presence.edge_weight("b", "c") == 5);
+
+    projection_options options;
+    options.weight = projection_weight::shared_neighbors;
+    Graph shared;
+    weighted_projected_graph(vertex_group::top, g, shared, options);
+    BOOST_CHECK(shared.edge_weight("a", "b") == 1);
+    BOOST_CHECK(shared.edge_weight("b", "c") == 2);
+
+    options.weight = projection_weight::jaccard;
+    Graph jaccard;
+    weighted_projected_graph(vertex_group::top, g, jaccard, options);
+    BOOST_CHECK_CLOSE(jaccard.edge_weight("a", "b"), 0.2, 1e-9);
+
+    options.weight = projection_weight::overlap;
+    Graph overlap;
+    weighted_projected_graph(vertex_group::top, g, overlap, options);
+    BOOST_CHECK_CLOSE(overlap.edge_weight("a", "b"), 2.0 / 7.0, 1e-9);
+
+    ///< a-b is below the threshold and never created
+    options = projection_options();
+    options.min_overlap = 3;
+    Graph thresholded;
+    weighted_projected_graph(vertex_group::top, g, thresholded, options);
+    BOOST_CHECK(thresholded.num_vertices() == 3);
+    BOOST_CHECK(thresholded.num_edges() == 2);
+    BOOST_CHECK(!thresholded.has_edge("a", "b"));
+
+    ///< a-b is in the top-1 of neither a nor b
+    options = projection_options();
+    options.top_k = 1;
+    Graph top;
+    weighted_projected_graph(vertex_group::top, g, top, options);
+    BOOST_CHECK(top.num_edges() == 2);
+    BOOST_CHECK(top.has_edge("a", "c"));
+    BOOST_CHECK(top.has_edge("b", "c"));
+}
+
+BOOST_AUTO_TEST_CASE(BiLinStream_group_index)
+{
+    BiLinkStream g(0, 10);
+    g.add_edge_w_time("a", "u", 0, 2);
+    g.add_edge_w_time("b", "u", 1, 3);
+    g.add_edge_w_time("c", "v", 4, 6);
+
+    BOOST_CHECK(g.num_top_vertices() == 3);
+    BOOST_CHECK(g.num_bottom_vertices() == 2);
+    BOOST_CHECK(g.group_id(g.vertex("c")) == 2);
+    BOOST_CHECK(g.group_id(g.vertex("v")) == 1);
+
+    g.remove_vertex("a");
+    BOOST_CHECK(g.num_top_vertices() == 2);
+    BOOST_CHECK(g.has_edge("b", "u"));
+    BOOST_CHECK(g.group_id(g.vertex("b")) == 0);
+    BOOST_CHECK(g.group_vertices(vertex_group::bottom).size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(BiLinStream_bipartite_metrics)
+{
+    BiLinkStream g(0, 10);
+    g.add_vertex_w_group(vertex_group::top, "a");
+    g.add_vertex_w_group(vertex_group::top, "b");
+    g.add_vertex_w_group(vertex_group::top, "c");
+    g.add_vertex_w_group(vertex_group::bottom, "u");
+    g.add_vertex_w_group(vertex_group::bottom, "v");
+    g.add_edge_w_time("u", "a", 0, 2);
+    g.add_edge_w_time("u", "a", 3, 9);
+    g.add_edge_w_time("u", "b", 4, 5);
+    g.add_edge_w_time("u", "b", 8, 10);
+    g.add_edge_w_time("u", "c", 1, 5);
+    g.add_edge_w_time("v", "b", 2, 7);
+    g.add_edge_w_time("v", "c", 0, 8);
+
+    auto degree = time_averaged_degree(g, vertex_group::top);
+    BOOST_CHECK_CLOSE(degree[0], 0.8, 1e-9);
+    BOOST_CHECK_CLOSE(degree[1], 0.8, 1e-9);
+    BOOST_CHECK_CLOSE(degree[2], 1.2, 1e-9);
+    degree = time_averaged_degree(g, vertex_group::bottom);
+    BOOST_CHECK_CLOSE(degree[0], 1.5, 1e-9);
+    BOOST_CHECK_CLOSE(degree[1], 1.3, 1e-9);
+
+    auto p = degree_distribution(g, vertex_group::top);
+    BOOST_CHECK(p.size() == 3);
+    BOOST_CHECK_CLOSE(p[0], 7.0 / 30, 1e-9);
+    BOOST_CHECK_CLOSE(p[1], 18.0 / 30, 1e-9);
+    BOOST_CHECK_CLOSE(p[2], 5.0 / 30, 1e-9);
+
+    auto redundancy = temporal_redundancy(g, vertex_group::top);
+    BOOST_CHECK(redundancy[0] == 0.0);
+    BOOST_CHECK_CLOSE(redundancy[1], 1.0, 1e-9);
+    BOOST_CHECK_CLOSE(redundancy[2], 0.25, 1e-9);
+
+    auto shared = shared_neighbor_time_fraction(g, vertex_group::top);
+    BOOST_CHECK_CLOSE(shared[0], 0.5, 1e-9);
+    BOOST_CHECK_CLOSE(shared[1], 6.0 / 7, 1e-9);
+    BOOST_CHECK_CLOSE(shared[2], 0.75, 1e-9);
+}
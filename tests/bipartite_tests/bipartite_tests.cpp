@@ -95,6 +95,31 @@ BOOST_AUTO_TEST_CASE(BipartiteBase_projected_graph)
     BOOST_CHECK(gproj.has_edge("A", "C"));
 }
 
+BOOST_AUTO_TEST_CASE(BipartiteBase_projected_graph_bottom)
+{
+    Bipartite g;
+    Graph gproj;
+
+    g.add_vertex_w_group(vertex_group::top, "A");
+    g.add_vertex_w_group(vertex_group::bottom, "B");
+    g.add_vertex_w_group(vertex_group::top, "C");
+    g.add_vertex_w_group(vertex_group::bottom, "D");
+    g.add_vertex_w_group(vertex_group::bottom, "E");
+    g.add_edge("A", "B");
+    g.add_edge("A", "D");
+    g.add_edge("C", "D");
+    g.add_edge("C", "E");
+
+    projected_graph(vertex_group::bottom, g, gproj);
+    BOOST_CHECK(gproj.num_vertices() == 3);
+    BOOST_CHECK(gproj.num_edges() == 2);
+    BOOST_CHECK(gproj.has_edge("B", "D"));
+    BOOST_CHECK(gproj.has_edge("D", "E"));
+    BOOST_CHECK(!gproj.has_edge("B", "E"));
+    BOOST_CHECK(!gproj.has_vertex("A"));
+    BOOST_CHECK(g.num_edges() == 4);
+}
+
 BOOST_AUTO_TEST_CASE(BipartiteBase_clear_vertex_w_group)
 {
     Bipartite g;
@@ -174,4 +199,47 @@ BOOST_AUTO_TEST_CASE(BipartiteBase_density)
     g.add_edge("3", "B");
 
     BOOST_CHECK(g.density() == 2.0/3); ///< should be 4 /(3 * 2)
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(BipartiteBase_group_index)
+{
+    Bipartite g;
+
+    g.add_vertex_w_group(vertex_group::top, "1");
+    g.add_vertex_w_group(vertex_group::bottom, "A");
+    g.add_vertex_w_group(vertex_group::top, "2");
+    g.add_vertex_w_group(vertex_group::bottom, "B");
+    g.add_vertex_w_group(vertex_group::top, "3");
+    g.add_edge("1", "A");
+    g.add_edge("2", "A");
+    g.add_edge("2", "B");
+    g.add_edge("3", "B");
+
+    BOOST_CHECK(g.num_top_vertices() == 3);
+    BOOST_CHECK(g.num_bottom_vertices() == 2);
+    BOOST_CHECK(g.group_vertices(vertex_group::top) == std::vector<size_t>({0, 2, 4}));
+    BOOST_CHECK(g.group_vertices(vertex_group::bottom) == std::vector<size_t>({1, 3}));
+    BOOST_CHECK(g.group_id(g.vertex("3")) == 2);
+    BOOST_CHECK(g.group_id(g.vertex("B")) == 1);
+    BOOST_CHECK_THROW(g.group_vertices(vertex_group::null), BipartiteBaseException);
+
+    ///< top x bottom biadjacency, rows are top ids and targets bottom ids
+    auto csr = make_biadjacency(g);
+    BOOST_CHECK(csr.num_vertices == 3);
+    BOOST_CHECK(csr.offsets == std::vector<size_t>({0, 1, 3, 4}));
+    BOOST_CHECK(csr.targets == std::vector<size_t>({0, 0, 1, 1}));
+
+    ///< removing a vertex renumbers the vertices and their group ids
+    g.remove_vertex("2");
+    BOOST_CHECK(g.num_top_vertices() == 2);
+    BOOST_CHECK(g.group_vertices(vertex_group::top) == std::vector<size_t>({0, 3}));
+    BOOST_CHECK(g.group_id(g.vertex("3")) == 1);
+    BOOST_CHECK(g.group_id(g.vertex("B")) == 1);
+
+    ///< clearing through the base class also resets the groups
+    Graph &base = g;
+    base.clear();
+    BOOST_CHECK(g.num_top_vertices() == 0);
+    BOOST_CHECK(g.num_bottom_vertices() == 0);
+    BOOST_CHECK(g.group_vertices(vertex_group::top).empty());
+}
@@ -371,6 +371,23 @@ BOOST_AUTO_TEST_CASE(GraphBase_adjacency)
     BOOST_CHECK(d.adjacency() == m1);
 }
 
+BOOST_AUTO_TEST_CASE(GraphBase_edge_weight)
+{
+    Graph g;
+    g.add_edge("A", "B");
+    BOOST_CHECK(g.edge_weight("A", "B") == 1.0);
+    g.set_edge_weight("B", "A", 2.5);
+    BOOST_CHECK(g.edge_weight("A", "B") == 2.5);
+    BOOST_CHECK(g.adjacency()(0, 1) == 2.5);
+    BOOST_CHECK_THROW(g.edge_weight(0, 0), GraphBaseException);
+
+    DiGraph d;
+    d.add_edge("A", "B");
+    d.set_edge_weight("A", "B", 3.0);
+    BOOST_CHECK(d.edge_weight("A", "B") == 3.0);
+    BOOST_CHECK_THROW(d.set_edge_weight("B", "A", 1.0), GraphBaseException);
+}
+
 BOOST_AUTO_TEST_CASE(GraphBase_read_csv)
 {
     Graph g;
@@ -431,4 +448,108 @@ BOOST_AUTO_TEST_CASE(GraphBase_boosttest)
 
     cout << get(age_map, "vincent") << endl;
 
-}
\ No newline at end of file
+}
+BOOST_AUTO_TEST_CASE(GraphBase_numeric_labels)
+{
+    Graph g;
+    g.set_numeric_labels(true);
+    BOOST_CHECK(g.numeric_labels());
+    g.add_edge("3", "1");
+    BOOST_CHECK(g.num_vertices() == 4);
+    BOOST_CHECK(g.vertex("3") == 3);
+    BOOST_CHECK(g.label(1) == "1");
+    BOOST_CHECK(g[2] == "2");
+    BOOST_CHECK(g["3"] == 3);
+    BOOST_CHECK(g.has_vertex("0"));
+    BOOST_CHECK(!g.has_vertex("4"));
+    BOOST_CHECK(!g.has_vertex("03"));
+    BOOST_CHECK(!g.has_vertex("A"));
+    BOOST_CHECK(g.has_edge("1", "3"));
+    BOOST_CHECK_THROW(g.add_vertex("A"), GraphBaseException);
+    BOOST_CHECK_THROW(g.add_vertex("2"), GraphBaseException);
+    BOOST_CHECK(g.add_vertex() == 4);
+
+    // the vertices after a removed vertex are relabeled
+    g.remove_vertex("0");
+    BOOST_CHECK(g.num_vertices() == 4);
+    BOOST_CHECK(g.has_edge("0", "2"));
+
+    // switching back stores the labels
+    g.set_numeric_labels(false);
+    BOOST_CHECK(g.labels().size() == 4);
+    BOOST_CHECK(g.vertex("2") == 2);
+    BOOST_CHECK(g.add_vertex() == 4);
+    BOOST_CHECK(g.label(4) == "4");
+
+    Graph h;
+    h.add_edge("A", "B");
+    BOOST_CHECK_THROW(h.set_numeric_labels(true), GraphBaseException);
+
+    DiGraph d;
+    d.set_numeric_labels(true);
+    d.add_edge("0", "2");
+    d.clear_vertices();
+    BOOST_CHECK(d.num_vertices() == 0);
+
+    // a stray large id throws instead of allocating every vertex up to it
+    Graph n;
+    n.set_numeric_labels(true);
+    BOOST_CHECK(n.max_numeric_gap() == Graph::default_max_numeric_gap);
+    BOOST_CHECK_THROW(n.add_vertex("1700000000"), GraphBaseException);
+    BOOST_CHECK(n.num_vertices() == 0);
+    n.set_max_numeric_gap(3);
+    n.add_vertex("3");
+    BOOST_CHECK(n.num_vertices() == 4);
+    BOOST_CHECK_THROW(n.add_edge("3", "8"), GraphBaseException);
+    Graph m(n);
+    BOOST_CHECK(m.max_numeric_gap() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(GraphBase_copy_on_write)
+{
+    Graph g;
+    g.add_edge("A", "B");
+    g.add_edge("B", "C");
+
+    // the copies share the graph until one of them is modified
+    Graph h(g);
+    h.add_edge("C", "D");
+    h.set_edge_weight("A", "B", 2.0);
+    BOOST_CHECK(g.num_vertices() == 3);
+    BOOST_CHECK(g.num_edges() == 2);
+    BOOST_CHECK(g.edge_weight("A", "B") == 1.0);
+    BOOST_CHECK(!g.has_vertex("D"));
+    BOOST_CHECK(h.num_vertices() == 4);
+    BOOST_CHECK(h.has_edge("C", "D"));
+    BOOST_CHECK(h.edge_weight("A", "B") == 2.0);
+
+    Graph k;
+    k.copy_graph(g);
+    g.remove_vertex("B");
+    BOOST_CHECK(g.num_vertices() == 2);
+    BOOST_CHECK(g.num_edges() == 0);
+    BOOST_CHECK(k.num_vertices() == 3);
+    BOOST_CHECK(k.has_edge("A", "B"));
+    BOOST_CHECK(k.vertex("C") == 2);
+}
+
+BOOST_AUTO_TEST_CASE(GraphBase_subscript)
+{
+    Graph g;
+    g.add_vertex("a");
+    g.add_vertex("b");
+    auto x = g["a"];
+    auto y = g["b"];
+    BOOST_CHECK(x == 0 && y == 1);
+    g.add_edge(g["a"], g["b"]);
+    BOOST_CHECK(g.has_edge("a", "b"));
+    BOOST_CHECK(!g.has_edge("a", "a"));
+    BOOST_CHECK(g[0] == "a" && g[1] == "b");
+    BOOST_CHECK_THROW(g["c"], GraphBaseException);
+
+    Graph n;
+    n.set_numeric_labels(true);
+    n.add_edge("2", "0");
+    BOOST_CHECK(n["2"] == 2 && n["0"] == 0);
+    BOOST_CHECK(n[2] == "2" && n[1] == "1");
+}
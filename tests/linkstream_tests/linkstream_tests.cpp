@@ -12,10 +12,19 @@
 
 #include "GraphType.hpp"
 #include "CSVReader.hpp"
+#include "operators.hpp"
+#include "aggregation.hpp"
+#include "ArrowData.hpp"
 
 #define BOOST_TEST_MODULE LinkStreamBase_tests
 
 #include <boost/test/included/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/lzma.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
+#include <fstream>
 #include <memory>
 
 using namespace boost::bstream;
@@ -304,3 +313,506 @@ BOOST_AUTO_TEST_CASE(LinkStream_test_time_t)
     // check the definition duration
     BOOST_CHECK(L.definition_length() == 8683000000000);
 }
+
+BOOST_AUTO_TEST_CASE(LinkStream_set_operations)
+{
+    LinkStream L1(0, 10);
+    L1.add_edge_w_time("A", "B", 0, 4);
+    L1.add_edge_w_time("B", "C", 2, 8);
+    L1.add_edge_w_time("C", "D", 1, 3);
+
+    LinkStream L2(2, 20);
+    L2.add_edge_w_time("B", "A", 2, 6);
+    L2.add_edge_w_time("B", "C", 5, 15);
+    L2.add_edge_w_time("D", "E", 10, 12);
+
+    LinkStream U;
+    stream_union(L1, L2, U);
+    BOOST_CHECK(U.num_vertices() == 5);
+    BOOST_CHECK(U.definition().first == 0);
+    BOOST_CHECK(U.definition().second == 20);
+    BOOST_CHECK(U.edge_tinterval_length("A", "B") == 6);
+    BOOST_CHECK(U.edge_tinterval_length("B", "C") == 13);
+    BOOST_CHECK(U.edge_tinterval_length("D", "E") == 2);
+
+    LinkStream I;
+    stream_intersection(L1, L2, I);
+    BOOST_CHECK(I.num_vertices() == 4);
+    BOOST_CHECK(I.edge_tinterval_length("A", "B") == 2);
+    BOOST_CHECK(I.edge_tinterval_length("B", "C") == 3);
+    BOOST_CHECK(!I.has_vertex("E"));
+    BOOST_CHECK(!I.edge("C", "D").second);
+
+    LinkStream D;
+    stream_difference(L1, L2, D);
+    BOOST_CHECK(D.num_vertices() == 4);
+    BOOST_CHECK(D.edge_tinterval_length("A", "B") == 2);
+    BOOST_CHECK(D.edge_tinterval_length("B", "C") == 3);
+    BOOST_CHECK(D.edge_tinterval_length("C", "D") == 2);
+
+    LinkStream S;
+    stream_symmetric_difference(L1, L2, S);
+    BOOST_CHECK(S.edge_tinterval_length("A", "B") == 4);
+    BOOST_CHECK(S.edge_tinterval_length("B", "C") == 10);
+    BOOST_CHECK(S.edge_tinterval_length("D", "E") == 2);
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_aggregate)
+{
+    LinkStream L(0, 10);
+    auto a = L.add_vertex("A");
+    auto b = L.add_vertex("B");
+    auto c = L.add_vertex("C");
+    L.add_edge_w_time(a, b, 1, 4);
+    L.add_edge_w_time(a, b, 5, 9);
+    L.add_edge_w_time(b, c, 0, 10);
+
+    auto tensor = aggregate_tensor(L, 5);
+    BOOST_CHECK(tensor.num_buckets == 2);
+    BOOST_CHECK(tensor.bucket_offsets[1] == 2);
+    BOOST_CHECK(tensor.bucket_offsets[2] == 4);
+
+    auto snapshots = aggregate(L, 5).matrices;
+    BOOST_CHECK(snapshots.size() == 2);
+    BOOST_CHECK(snapshots[0].coeff(a, b) == 3);
+    BOOST_CHECK(snapshots[0].coeff(b, a) == 3);
+    BOOST_CHECK(snapshots[0].coeff(b, c) == 5);
+    BOOST_CHECK(snapshots[1].coeff(a, b) == 4);
+    BOOST_CHECK(snapshots[1].coeff(c, b) == 5);
+    BOOST_CHECK(snapshots[1].coeff(a, c) == 0);
+
+    // the last bucket is truncated to the definition interval
+    auto snapshots_3 = aggregate(L, 3).matrices;
+    BOOST_CHECK(snapshots_3.size() == 4);
+    BOOST_CHECK(snapshots_3[3].coeff(b, c) == 1);
+    BOOST_CHECK_THROW(aggregate(L, 0), LinkStreamException);
+
+    // the buckets follow the intervals and not the definition, only the occupied ones are indexed
+    LinkStream F(0, 1000000);
+    F.add_edge_w_time("A", "B", 1000, 1004);
+    F.add_edge_w_time("B", "C", 1012, 1013);
+    auto sparse = aggregate_tensor(F, 5);
+    BOOST_CHECK(sparse.origin == 1000);
+    BOOST_CHECK(sparse.num_buckets == 3);
+    BOOST_CHECK(sparse.buckets == std::vector<std::size_t>({0, 2}));
+    BOOST_CHECK(sparse.bucket_offsets == std::vector<std::size_t>({0, 1, 2}));
+    BOOST_CHECK(sparse.weight == std::vector<double>({4, 1}));
+    auto sparse_snapshots = aggregate(F, 5);
+    BOOST_CHECK(sparse_snapshots.origin == 1000);
+    BOOST_CHECK(sparse_snapshots.num_buckets == 3);
+    BOOST_CHECK(sparse_snapshots.buckets == std::vector<std::size_t>({0, 2}));
+    BOOST_CHECK(sparse_snapshots.matrices.size() == 2);
+    BOOST_CHECK(sparse_snapshots.matrices[1].coeff(F.vertex("C"), F.vertex("B")) == 1);
+    BOOST_CHECK_THROW(aggregate_tensor(F, 1, 12), LinkStreamException);
+    BOOST_CHECK(aggregate_tensor(F, 1, 13).num_buckets == 13);
+
+    // the entries of a bucket are sorted by (source, target) whatever the threads
+    LinkStream R(0, 100);
+    for (int i = 0; i < 40; ++i)
+        R.add_vertex(std::to_string(i));
+    for (int i = 0; i < 40; ++i)
+        for (int j = i + 1; j < 40; j += 3)
+            R.add_edge_w_time(i, j, (i * j) % 90, (i * j) % 90 + 10);
+    auto dense = aggregate_tensor(R, 7);
+    for (std::size_t b = 0; b < dense.buckets.size(); ++b)
+        for (auto i = dense.bucket_offsets[b] + 1; i < dense.bucket_offsets[b + 1]; ++i)
+            BOOST_CHECK(std::make_pair(dense.source[i - 1], dense.target[i - 1]) <
+                        std::make_pair(dense.source[i], dense.target[i]));
+    LinkStream E;
+    BOOST_CHECK(aggregate_tensor(E, 5).num_buckets == 0);
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_add_edges_w_time)
+{
+    LinkStream L(3, 0, 10);
+    L.add_edge_w_time(0, 1, 0, 2);
+    std::vector<LinkStream::contact_t> contacts = {
+            std::make_tuple(1, 0, 4, 6),
+            std::make_tuple(1, 2, 5, 7),
+            std::make_tuple(0, 1, 1, 3),
+            std::make_tuple(2, 1, 0, 1)
+    };
+    L.add_edges_w_time(contacts);
+    BOOST_CHECK(L.edge_tinterval_set(0, 1).length() == 5);
+    BOOST_CHECK(L.edge_tinterval_set(1, 2).length() == 3);
+    BOOST_CHECK(std::distance(L.edges().first, L.edges().second) == 2);
+
+    ///< nothing is inserted if one of the contacts is invalid
+    std::vector<LinkStream::contact_t> invalid = {
+            std::make_tuple(0, 2, 0, 1),
+            std::make_tuple(0, 2, 8, 12)
+    };
+    BOOST_CHECK_THROW(L.add_edges_w_time(invalid), LinkStreamException);
+    BOOST_CHECK(!L.has_edge(0, 2));
+
+    ///< intervals of existing edges leave the adjacency shared with the copy
+    LinkStream M(L);
+    std::vector<LinkStream::contact_t> existing = {std::make_tuple(2, 1, 8, 9)};
+    M.add_edges_w_time(existing);
+    BOOST_CHECK(*M.edges().first == *L.edges().first);
+    BOOST_CHECK(M.edge_tinterval_set(1, 2).length() == 4);
+    BOOST_CHECK(L.edge_tinterval_set(1, 2).length() == 3);
+    std::vector<LinkStream::contact_t> created = {std::make_tuple(0, 1, 9, 10), std::make_tuple(0, 2, 8, 9)};
+    M.add_edges_w_time(created);
+    BOOST_CHECK(!(*M.edges().first == *L.edges().first));
+    BOOST_CHECK(M.edge_tinterval_set(0, 1).length() == 6);
+    BOOST_CHECK(M.edge_tinterval_set(0, 2).length() == 1);
+    BOOST_CHECK(!L.has_edge(0, 2));
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_copy_on_write)
+{
+    LinkStream L(0, 10);
+    L.add_edge_w_time("a", "b", 0, 2);
+    L.add_edge_w_time("b", "c", 1, 5);
+
+    // changing the intervals of an edge only copies the intervals
+    LinkStream M(L);
+    M.add_edge_w_time("a", "b", 4, 6);
+    BOOST_CHECK(L.edge_tinterval_length("a", "b") == 2);
+    BOOST_CHECK(M.edge_tinterval_length("a", "b") == 4);
+
+    // adding an edge copies the adjacency, the intervals follow their edge
+    LinkStream N(M);
+    N.add_edge_w_time("c", "d", 2, 3);
+    N.add_edge_w_time("b", "c", 6, 7);
+    BOOST_CHECK(M.num_vertices() == 3);
+    BOOST_CHECK(M.edge_tinterval_length("a", "b") == 4);
+    BOOST_CHECK(M.edge_tinterval_length("b", "c") == 4);
+    BOOST_CHECK(N.edge_tinterval_length("a", "b") == 4);
+    BOOST_CHECK(N.edge_tinterval_length("b", "c") == 5);
+    BOOST_CHECK(N.edge_tinterval_length("c", "d") == 1);
+
+    N.remove_vertex("a");
+    BOOST_CHECK(N.edge_tinterval_length("b", "c") == 5);
+    BOOST_CHECK(M.edge_tinterval_length("a", "b") == 4);
+
+    // clearing a copy through the base class drops its intervals only
+    Graph &base = N;
+    base.clear();
+    BOOST_CHECK(N.num_vertices() == 0);
+    N.add_edge_w_time("b", "c", 8, 9);
+    BOOST_CHECK(N.edge_tinterval_length("b", "c") == 1);
+    BOOST_CHECK(M.edge_tinterval_length("b", "c") == 4);
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_arrow)
+{
+    LinkStream L(0, 10);
+    L.add_edge_w_time("a", "b", 0, 2);
+    L.add_edge_w_time("a", "b", 4, 6);
+    L.add_edge_w_time("b", "c", 1, 5);
+
+    ArrowSchema schema;
+    ArrowArray array;
+    export_arrow(L, &schema, &array);
+    BOOST_CHECK(std::string(schema.format) == "+s");
+    BOOST_CHECK(std::string(schema.children[0]->name) == "src");
+    BOOST_CHECK(std::string(schema.children[0]->dictionary->format) == "U");
+    BOOST_CHECK(array.length == 3);
+    BOOST_CHECK(array.children[0]->dictionary->length == 3);
+
+    LinkStream M;
+    import_arrow(M, &schema, &array);
+    BOOST_CHECK(schema.release == nullptr && array.release == nullptr);
+    BOOST_CHECK(M.num_vertices() == 3);
+    BOOST_CHECK(M.definition() == std::make_pair(time_t(0), time_t(6)));
+    BOOST_CHECK(M.edge_tinterval_length("a", "b") == 4);
+    BOOST_CHECK(M.edge_tinterval_length("c", "b") == 4);
+
+    ///< through a stream, in numeric label mode the vertex columns are the vertex ids
+    LinkStream N(0, 10);
+    N.set_numeric_labels(true);
+    N.add_edge_w_time("1", "3", 2, 4);
+    ArrowArrayStream stream;
+    export_arrow(N, &stream);
+    LinkStream P;
+    P.set_numeric_labels(true);
+    import_arrow(P, &stream);
+    BOOST_CHECK(stream.release == nullptr);
+    BOOST_CHECK(P.num_vertices() == 4);
+    BOOST_CHECK(P.edge_tinterval_length(1, 3) == 2);
+
+    ///< a utf8 batch built by hand, the struct offset skips the first row
+    const char labels[] = "xyzxy";
+    std::int32_t offsets[] = {0, 1, 2, 3, 4, 5};
+    std::int32_t targets[] = {0, 1, 2, 3, 4};
+    std::int64_t begins[] = {0, 1, 2, 3, 4}, ends[] = {9, 2, 3, 4, 5};
+    std::uint8_t valid = 0x1d; ///< the row 1 of the end column is null
+    const void *source_buffers[] = {nullptr, offsets, labels};
+    const void *target_buffers[] = {nullptr, targets};
+    const void *begin_buffers[] = {nullptr, begins};
+    const void *end_buffers[] = {&valid, ends};
+    const void *struct_buffers[] = {nullptr};
+    ArrowArray columns[4] = {{5, 0, 0, 3, 0, source_buffers, nullptr, nullptr, nullptr, nullptr},
+                             {5, 0, 0, 2, 0, target_buffers, nullptr, nullptr, nullptr, nullptr},
+                             {5, 0, 0, 2, 0, begin_buffers, nullptr, nullptr, nullptr, nullptr},
+                             {5, 0, 0, 2, 0, end_buffers, nullptr, nullptr, nullptr, nullptr}};
+    ArrowArray *column_pointers[] = {&columns[0], &columns[1], &columns[2], &columns[3]};
+    ArrowSchema fields[4] = {{"u", "src", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr},
+                             {"i", "dst", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr},
+                             {"tsu:", "begin", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr},
+                             {"l", "end", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr}};
+    ArrowSchema *field_pointers[] = {&fields[0], &fields[1], &fields[2], &fields[3]};
+    ArrowSchema batch_schema = {"+s", "", nullptr, 0, 4, field_pointers, nullptr, nullptr, nullptr};
+    ArrowArray batch = {3, 0, 2, 1, 4, struct_buffers, column_pointers, nullptr, nullptr, nullptr};
+    LinkStream Q;
+    import_arrow(Q, &batch_schema, &batch);
+    BOOST_CHECK(Q.num_vertices() == 6);
+    BOOST_CHECK(Q.has_edge("z", "2") && Q.has_edge("x", "3") && Q.has_edge("y", "4"));
+    BOOST_CHECK(Q.definition() == std::make_pair(time_t(2), time_t(5)));
+
+    columns[3].null_count = 1;
+    batch.offset = 0;
+    batch.length = 5;
+    BOOST_CHECK_THROW(import_arrow(Q, &batch_schema, &batch), LinkStreamException);
+    fields[3].name = "stop";
+    BOOST_CHECK_THROW(import_arrow(Q, &batch_schema, &batch), LinkStreamException);
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_coarsen)
+{
+    const time_t second = 1000000000;
+    LinkStream L(0, 1000 * second);
+    L.add_edge_w_time("a", "b", 1 * second + 5, 2 * second);
+    L.add_edge_w_time("a", "b", 2 * second + 300, 3 * second);
+    L.add_edge_w_time("a", "b", 10 * second, 11 * second);
+    L.add_edge_w_time("a", "b", 15 * second, 16 * second);
+    L.add_edge_w_time("b", "c", 100 * second, 100 * second + 1);
+    LinkStream copy(L);
+
+    // nanoseconds to seconds, the first two contacts touch once rounded
+    auto res = L.coarsen(second);
+    BOOST_CHECK(res.intervals_before == 5 && res.intervals_after == 4);
+    BOOST_CHECK(res.bytes_reclaimed > 0);
+    BOOST_CHECK(L.definition() == std::make_pair(time_t(0), time_t(1000)));
+    BOOST_CHECK(L.edge_tinterval_length("a", "b") == 4);
+    BOOST_CHECK(L.edge_tinterval_set("a", "b").contains(1, 3));
+    BOOST_CHECK(L.edge_tinterval_set("b", "c").contains(100, 101));
+
+    // gaps of 4 seconds are filled, not the gap of 7 seconds
+    res = L.coarsen(1, 5);
+    BOOST_CHECK(res.intervals_before == 4 && res.intervals_after == 3);
+    BOOST_CHECK(L.edge_tinterval_set("a", "b").size() == 2);
+    BOOST_CHECK(L.edge_tinterval_set("a", "b").contains(10, 16));
+
+    // the copy sharing the intervals is left untouched
+    BOOST_CHECK(copy.edge_tinterval_set("a", "b").size() == 4);
+    BOOST_CHECK(copy.definition() == std::make_pair(time_t(0), 1000 * second));
+
+    BOOST_CHECK_THROW(L.coarsen(0), LinkStreamException);
+    BOOST_CHECK_THROW(L.coarsen(1, -1), LinkStreamException);
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_compress_intervals)
+{
+    // enough contacts to fill several compressed blocks
+    LinkStream L(0, 100000);
+    for (time_t t = 0; t < 1000; ++t) {
+        L.add_edge_w_time("a", "b", 10 * t, 10 * t + 1 + t % 7);
+        if (t % 3 == 0)
+            L.add_edge_w_time("b", "c", 10 * t + 5, 10 * t + 9);
+    }
+    auto ab = L.edge_tinterval_length("a", "b"), bc = L.edge_tinterval_length("b", "c");
+    BOOST_CHECK(!L.has_compressed_intervals());
+    auto res = L.compress_intervals();
+    BOOST_CHECK(res.intervals == 1000 + 334);
+    BOOST_CHECK(res.bytes_after > 0);
+    BOOST_CHECK(res.bytes_after < res.bytes_before);
+    BOOST_CHECK(L.has_compressed_intervals());
+    BOOST_CHECK(L.edge_tinterval_length("a", "b") == ab);
+    BOOST_CHECK(L.edge_tinterval_length("b", "c") == bc);
+    BOOST_CHECK(L.edge_tinterval_length("a", "c") == 0);
+    auto a = L.vertex("a"), b = L.vertex("b"), c = L.vertex("c");
+    BOOST_CHECK(L.is_edge_active(a, b, 60, 67).second);
+    BOOST_CHECK(!L.is_edge_active(a, b, 60, 68).second);
+    BOOST_CHECK(L.is_edge_active(a, b, 9990, 9996).second);
+    BOOST_CHECK(L.is_edge_active(b, c, 5, 9).second);
+    BOOST_CHECK(!L.is_edge_active(b, c, 15, 19).second);
+    auto bc_set = L.edge_tinterval_set("b", "c");
+    BOOST_CHECK(bc_set.size() == 334);
+    BOOST_CHECK(bc_set.length() == bc);
+    // a second call does not compress again
+    BOOST_CHECK(L.compress_intervals().bytes_after == res.bytes_after);
+
+    // the copies share the compressed intervals, a change decodes them
+    LinkStream copy(L);
+    BOOST_CHECK(copy.has_compressed_intervals());
+    L.add_edge_w_time("a", "c", 0, 10);
+    BOOST_CHECK(!L.has_compressed_intervals());
+    BOOST_CHECK(L.edge_tinterval_length("a", "c") == 10);
+    BOOST_CHECK(L.edge_tinterval_length("a", "b") == ab);
+    BOOST_CHECK(L.edge_tinterval_set("b", "c").size() == bc_set.size());
+    BOOST_CHECK(L.edge_tinterval_set("b", "c").length() == bc_set.length());
+    BOOST_CHECK(L.is_edge_active(a, b, 60, 67).second);
+    BOOST_CHECK(copy.has_compressed_intervals());
+    BOOST_CHECK(copy.edge_tinterval_length("a", "c") == 0);
+
+    L.coarsen(10, 0, true);
+    BOOST_CHECK(L.has_compressed_intervals());
+    BOOST_CHECK(L.edge_tinterval_length("a", "c") == 1);
+    BOOST_CHECK(L.is_edge_active(a, b, 999, 1000).second);
+    auto coarse = L.edge_tinterval_length("a", "b");
+    L.decompress_intervals();
+    BOOST_CHECK(!L.has_compressed_intervals());
+    BOOST_CHECK(L.is_edge_active(a, b, 999, 1000).second);
+    BOOST_CHECK(L.edge_tinterval_length("a", "b") == coarse);
+    L.decompress_intervals();
+    BOOST_CHECK(!L.has_compressed_intervals());
+
+    // removing a vertex of a compressed link stream
+    L.compress_intervals();
+    L.remove_vertex("c");
+    BOOST_CHECK(!L.has_compressed_intervals());
+    BOOST_CHECK(L.edge_tinterval_length("a", "b") == coarse);
+}
+
+/**
+ * @brief Directory under the temporary directory of the system, removed with its files at the end
+ * of the test.
+ */
+struct temporary_directory
+{
+    boost::filesystem::path path;
+
+    temporary_directory() : path(boost::filesystem::temp_directory_path() /
+                                 boost::filesystem::unique_path("bstream-%%%%-%%%%-%%%%"))
+    {
+        boost::filesystem::create_directory(path);
+    }
+
+    ~temporary_directory()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(path, ec);
+    }
+
+    std::string operator/(const std::string &name) const
+    {
+        return (path / name).string();
+    }
+};
+
+BOOST_AUTO_TEST_CASE(LinkStream_read_compressed_csv)
+{
+    // several chunks of the reader, lines spanning the chunks
+    std::string csv = "# s;t;b;e\n";
+    for (int i = 0; i < 60000; ++i)
+        csv += "v" + std::to_string(i % 97) + ";w" + std::to_string(i % 89) + ";" + std::to_string(10 * i) + ";" +
+               std::to_string(10 * i + 5) + "\n";
+    temporary_directory tmp;
+    auto plain = tmp / "contacts.csv", gz = tmp / "contacts.csv.gz", xz = tmp / "contacts.csv.xz";
+    auto zst = tmp / "contacts.csv.zst", truncated = tmp / "truncated.csv.gz";
+    std::ofstream(plain) << csv;
+    auto compress = [&csv](const std::string &path, auto filter) {
+        std::ofstream file(path, std::ios::binary);
+        boost::iostreams::filtering_ostream out;
+        out.push(filter);
+        out.push(file);
+        out << csv;
+    };
+    compress(gz, boost::iostreams::gzip_compressor());
+    compress(xz, boost::iostreams::lzma_compressor());
+    compress(zst, boost::iostreams::zstd_compressor());
+
+    CSVReader reader(';');
+    auto rows = reader.read(plain);
+    BOOST_CHECK(rows.size() == 60000);
+    BOOST_CHECK(rows.back()[2] == "599990");
+    for (auto &path : {gz, xz, zst})
+        BOOST_CHECK(reader.read(path) == rows);
+
+    LinkStream L;
+    L.read_csv(gz, ';');
+    BOOST_CHECK(L.num_vertices() == 97 + 89);
+    BOOST_CHECK(L.definition() == std::make_pair(time_t(0), time_t(599995)));
+
+    // a truncated archive is reported instead of returning a partial file
+    std::ifstream archive_file(gz, std::ios::binary);
+    std::string archive((std::istreambuf_iterator<char>(archive_file)), std::istreambuf_iterator<char>());
+    std::ofstream(truncated, std::ios::binary) << archive.substr(0, archive.size() / 2);
+    BOOST_CHECK_THROW(reader.read(truncated), CSVReaderException);
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_read_csv_options)
+{
+    const time_t second = 1000000000;
+    temporary_directory tmp;
+    auto path = tmp / "options.csv";
+    std::ofstream(path) << "begin;end;src;dst\n"
+                        << 10 * second << ";" << 20 * second << ";a;b\n"
+                        << 15 * second + 1 << ";" << 16 * second << ";b;c\n"
+                        << 30 * second << ";" << 90 * second << ";a;c\n"
+                        << 100 * second << ";" << 110 * second << ";x;y\n"
+                        << 40 * second << ";" << 50 * second << ";c;d\n";
+    csv_options options;
+    options.delimiter = ';';
+    options.begin = 0;
+    options.end = 1;
+    options.source = 2;
+    options.target = 3;
+    options.header = true;
+    options.time_unit = second;
+
+    LinkStream L;
+    L.read_csv(path, options);
+    BOOST_CHECK(L.num_vertices() == 6);
+    BOOST_CHECK(L.definition() == std::make_pair(time_t(10), time_t(110)));
+    BOOST_CHECK(L.edge_tinterval_length("b", "c") == 1);
+
+    // rows outside the window, too short or with a denied vertex never create a vertex
+    options.window_begin = 15;
+    options.window_end = 60;
+    options.min_duration = 2;
+    options.deny = {"d"};
+    LinkStream W;
+    W.read_csv(path, options);
+    BOOST_CHECK(W.num_vertices() == 3);
+    BOOST_CHECK(W.has_vertex("d") == false && W.has_vertex("x") == false);
+    BOOST_CHECK(W.definition() == std::make_pair(time_t(15), time_t(60)));
+    BOOST_CHECK(W.edge_tinterval_length("a", "b") == 5);
+    BOOST_CHECK(W.edge_tinterval_length("a", "c") == 30);
+    BOOST_CHECK(W.has_edge("b", "c") == false);
+
+    options.deny.clear();
+    options.allow = {"a", "b", "c"};
+    options.window_begin = std::numeric_limits<time_t>::min();
+    LinkStream A;
+    A.read_csv(path, options);
+    BOOST_CHECK(A.num_vertices() == 3);
+    BOOST_CHECK(A.definition() == std::make_pair(time_t(10), time_t(60)));
+
+    options.compress = true;
+    LinkStream Z;
+    Z.read_csv(path, options);
+    BOOST_CHECK(Z.has_compressed_intervals());
+    BOOST_CHECK(Z.edge_tinterval_length("a", "b") == 10);
+
+    options.end = 4;
+    BOOST_CHECK_THROW(A.read_csv(path, options), LinkStreamException);
+    options.end = 1;
+    options.header = false;
+    BOOST_CHECK_THROW(A.read_csv(path, options), LinkStreamException);
+}
+
+BOOST_AUTO_TEST_CASE(LinkStream_copy_graph)
+{
+    LinkStream L(0, 100);
+    L.add_edge_w_time("a", "b", 1, 5);
+    L.add_edge_w_time("b", "c", 10, 20);
+
+    LinkStream C(0, 10);
+    C.add_edge_w_time("x", "y", 1, 2);
+    C.copy_graph(L);
+    BOOST_CHECK(C.num_vertices() == 3);
+    BOOST_CHECK(C.definition() == std::make_pair(time_t(0), time_t(100)));
+    BOOST_CHECK(C.edge_tinterval_set("a", "b").contains(1, 5));
+    BOOST_CHECK(C.edge_tinterval_length("b", "c") == 10);
+
+    // the copies diverge when written
+    C.add_edge_w_time("a", "c", 30, 40);
+    BOOST_CHECK(C.edge_tinterval_length("a", "c") == 10);
+    BOOST_CHECK(!L.has_edge("a", "c"));
+    BOOST_CHECK(L.edge_tinterval_set("b", "c").contains(10, 20));
+}
+
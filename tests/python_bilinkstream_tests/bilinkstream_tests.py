@@ -55,5 +55,14 @@ class TestBiLinkStream(unittest.TestCase):
         with self.assertRaises(RuntimeError) as ctx:
             g.add_edge_w_time(A, B, 0, 5)
 
+    def test_BiLinkStream_metrics(self):
+        """Tests the bipartite LinkStream metrics."""
+        g = pb.BiLinkStream(0, 10)
+        g.add_edge_w_time("a", "u", 0, 5)
+        g.add_edge_w_time("b", "u", 3, 10)
+        self.assertListEqual(list(pb.time_averaged_degree(g, vertex_group.top)), [0.5, 0.7])
+        self.assertListEqual(list(pb.degree_distribution(g, vertex_group.bottom)), [0.0, 0.8, 0.2])
+        self.assertListEqual(list(pb.shared_neighbor_time_fraction(g, vertex_group.top)), [0.4, 2 / 7])
+
 if __name__ == '__main__':
     unittest.main()
\ No newline at end of file
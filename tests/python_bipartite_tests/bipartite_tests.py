@@ -20,6 +20,20 @@ class TestBipartite(unittest.TestCase):
         self.assertEqual(gproj.num_vertices(), 2)
         self.assertEqual(gproj.num_edges(), 1)
 
+    def test_BiLinkStream_weighted_projection(self):
+        """Tests the weighted projection of a bipartite link stream."""
+        g = pb.BiLinkStream(0, 10)
+        g.add_vertex_w_group(pb.vertex_group.top, "a")
+        g.add_vertex_w_group(pb.vertex_group.top, "b")
+        g.add_vertex_w_group(pb.vertex_group.bottom, "u")
+        g.add_edge_w_time("u", "a", 0, 5)
+        g.add_edge_w_time("u", "b", 3, 10)
+        gproj = pb.weighted_projected_graph(pb.vertex_group.top, g)
+        self.assertEqual(gproj.num_edges(), 1)
+        self.assertEqual(gproj.edge_weight("a", "b"), 2)
+        gproj = pb.weighted_projected_graph(pb.vertex_group.top, g, min_overlap=3)
+        self.assertEqual(gproj.num_edges(), 0)
+
 
 if __name__ == '__main__':
     unittest.main()
\ No newline at end of file
@@ -129,5 +129,92 @@ class TestGraph(unittest.TestCase):
         with self.assertRaises(RuntimeError):
             g[100]
 
+    def test_Graph_core_number(self):
+        """Tests the core decomposition of Graph."""
+        g = pybstream.Graph()
+        g.add_edge("A", "B")
+        g.add_edge("B", "C")
+        g.add_edge("C", "A")
+        g.add_edge("D", "A")
+        core = pybstream.core_number(g)
+        self.assertListEqual(list(core), [2, 2, 2, 1])
+        c = pybstream.k_core(g, 2)
+        self.assertEqual(c.num_vertices(), 3)
+
+    def test_Graph_connected_components(self):
+        """Tests the connected components of Graph."""
+        g = pybstream.Graph()
+        g.add_edge("A", "B")
+        g.add_edge("C", "D")
+        self.assertListEqual(list(pybstream.connected_components(g)), [0, 0, 1, 1])
+        self.assertEqual(pybstream.number_connected_components(g), 2)
+
+    def test_Graph_bfs(self):
+        """Tests the traversal and betweenness of Graph."""
+        g = pybstream.Graph()
+        g.add_edge("A", "B")
+        g.add_edge("B", "C")
+        self.assertListEqual(list(pybstream.bfs(g, "A")), [0, 1, 2])
+        self.assertListEqual(pybstream.shortest_path(g, "A", "C"), ["A", "B", "C"])
+        bc = pybstream.betweenness_centrality(g, normalized=False)
+        self.assertListEqual(list(bc), [0.0, 1.0, 0.0])
+
+    def test_Graph_pagerank(self):
+        """Tests the PageRank and Katz centrality of Graph."""
+        g = pybstream.Graph()
+        g.add_edge("A", "B")
+        g.add_edge("A", "C")
+        pr = pybstream.pagerank(g)
+        self.assertAlmostEqual(pr[0], 0.135 / 0.2775, places=4)
+        self.assertAlmostEqual(sum(pr), 1.0)
+        ppr = pybstream.personalized_pagerank(g, [[1.0, 0.0], [0.0, 0.0], [0.0, 1.0]])
+        self.assertEqual(ppr.shape, (3, 2))
+        self.assertAlmostEqual(ppr[1, 0], ppr[2, 0])
+        self.assertGreater(ppr[2, 1], ppr[1, 1])
+        katz = pybstream.katz_centrality(g, normalized=False)
+        self.assertAlmostEqual(katz[0], 1.2 / 0.98, places=4)
+
+    def test_Graph_numeric_labels(self):
+        """Tests the numeric label mode of Graph."""
+        g = pybstream.Graph()
+        g.set_numeric_labels(True)
+        g.add_edge("4", "1")
+        self.assertTrue(g.numeric_labels())
+        self.assertEqual(g.num_vertices(), 5)
+        self.assertEqual(g.vertex("4"), 4)
+        self.assertEqual(g.label(1), "1")
+
+    def test_Graph_louvain(self):
+        """Tests the community detection of Graph."""
+        g = pybstream.Graph()
+        for clique in ["ABCD", "EFGH"]:
+            for i in range(4):
+                for j in range(i + 1, 4):
+                    g.add_edge(clique[i], clique[j])
+        g.add_edge("D", "E")
+        membership, q = pybstream.louvain(g)
+        self.assertListEqual(list(membership), [0, 0, 0, 0, 1, 1, 1, 1])
+        self.assertAlmostEqual(q, 12.0 / 13.0 - 0.5)
+        self.assertAlmostEqual(pybstream.modularity(g, list(membership)), q)
+
+    def test_Graph_spectral(self):
+        """Tests the Laplacian eigenpairs of Graph."""
+        g = pybstream.Graph()
+        g.add_edge("A", "B")
+        g.add_edge("B", "C")
+        g.add_edge("C", "D")
+        laplacian = pybstream.laplacian(g)
+        self.assertEqual(laplacian.format, "csc")
+        self.assertEqual(laplacian.nnz, 10)
+        self.assertListEqual(list(laplacian.toarray()[1]), [-1.0, 2.0, -1.0, 0.0])
+        self.assertAlmostEqual(pybstream.normalized_laplacian(g).toarray()[0, 1], -0.5 ** 0.5)
+        self.assertAlmostEqual(pybstream.algebraic_connectivity(g), 2.0 - 2.0 ** 0.5)
+        values, vectors = pybstream.eigenpairs(g, 2, pybstream.spectral_matrix.laplacian,
+                                               pybstream.spectrum_end.largest)
+        self.assertAlmostEqual(values[0], 2.0 + 2.0 ** 0.5)
+        self.assertEqual(vectors.shape, (4, 2))
+        x = pybstream.spectral_embedding(g, 1)
+        self.assertLess(x[0, 0] * x[3, 0], 0.0)
+
 if __name__ == '__main__':
     unittest.main()
\ No newline at end of file
@@ -1,3 +1,7 @@
+import gzip
+import lzma
+import os
+import tempfile
 import unittest
 import pybstream
 
@@ -49,6 +53,152 @@ class TestLinkStream(unittest.TestCase):
         self.assertEqual(g.num_vertices(), 3)
         self.assertEqual(g.num_edges(), 1.5)
 
+    def test_LinkStream_set_operations(self):
+        """Test union, intersection and difference of LinkStream"""
+        g1 = pybstream.LinkStream(0, 10)
+        g1.add_edge_w_time("A", "B", 0, 4)
+        g1.add_edge_w_time("B", "C", 2, 8)
+        g2 = pybstream.LinkStream(0, 10)
+        g2.add_edge_w_time("B", "A", 2, 6)
+        g2.add_edge_w_time("C", "D", 1, 3)
+
+        u = pybstream.union(g1, g2)
+        self.assertEqual(u.num_vertices(), 4)
+        self.assertEqual(u.num_edges(), 1.4)
+        i = pybstream.intersection(g1, g2)
+        self.assertEqual(i.num_edges(), 0.2)
+        d = pybstream.difference(g1, g2)
+        self.assertEqual(d.num_edges(), 0.8)
+        s = pybstream.symmetric_difference(g1, g2)
+        self.assertEqual(s.num_edges(), 1.2)
+
+    def test_LinkStream_aggregate(self):
+        """Test aggregation of LinkStream"""
+        g = pybstream.LinkStream(0, 10)
+        g.add_edge_w_time("A", "B", 1, 4)
+        g.add_edge_w_time("A", "B", 5, 9)
+        g.add_edge_w_time("B", "C", 0, 10)
+        (origin, num_buckets, bucket, source, target, weight) = pybstream.aggregate_tensor(g, 5)
+        self.assertEqual((origin, num_buckets), (0, 2))
+        self.assertEqual(list(bucket), [0, 0, 1, 1])
+        self.assertEqual(list(weight), [3, 5, 4, 5])
+        (origin, num_buckets, buckets, matrices) = pybstream.aggregate(g, 5)
+        self.assertEqual(list(buckets), [0, 1])
+        self.assertEqual(matrices[1][0, 1], 4)
+
+    def test_LinkStream_temporal_centrality(self):
+        """Test fastest paths and temporal centrality of LinkStream"""
+        g = pybstream.LinkStream(0, 10)
+        g.add_edge_w_time("A", "B", 1, 2)
+        g.add_edge_w_time("B", "C", 5, 6)
+        self.assertEqual(list(pybstream.fastest_path_duration(g, "A")), [0, 0, 4])
+        bc = pybstream.temporal_betweenness(g, normalized=False)
+        self.assertEqual(list(bc), [0.0, 1.0, 0.0])
+
+    def test_LinkStream_copy(self):
+        """Test that a copy of a LinkStream is independent of the original"""
+        g = pybstream.LinkStream(0, 10)
+        g.add_edge_w_time("A", "B", 1, 2)
+        h = pybstream.LinkStream(g)
+        h.add_edge_w_time("A", "B", 4, 6)
+        h.add_edge_w_time("B", "C", 5, 6)
+        self.assertAlmostEqual(g.degree("A"), 0.1)
+        self.assertAlmostEqual(h.degree("A"), 0.3)
+        self.assertFalse(g.has_edge("B", "C"))
+
+    def test_LinkStream_temporal_motifs(self):
+        """Test the temporal motif counts of LinkStream"""
+        g = pybstream.LinkStream(0, 10)
+        g.add_edge_w_time("A", "B", 1, 2)
+        g.add_edge_w_time("A", "B", 3, 4)
+        g.add_edge_w_time("A", "C", 5, 6)
+        g.add_edge_w_time("C", "B", 7, 8)
+        counts = pybstream.temporal_motifs(g, 10)
+        self.assertEqual(counts.shape, (3, 3))
+        self.assertEqual(counts[0, 1], 2)
+        self.assertEqual(counts[1, 2], 2)
+        self.assertEqual(counts.sum(), 4)
+
+    def test_LinkStream_contact_statistics(self):
+        """Test the contact and inter-contact statistics of LinkStream"""
+        g = pybstream.LinkStream(0, 10)
+        g.add_edge_w_time("A", "B", 0, 1)
+        g.add_edge_w_time("A", "B", 3, 4)
+        g.add_edge_w_time("A", "B", 7, 8)
+        bin_edges, durations, gaps, edge_stats, vertex_stats = pybstream.contact_statistics(g)
+        self.assertListEqual(list(bin_edges), [1.0, 2.0, 4.0])
+        self.assertListEqual(list(durations), [3, 0])
+        self.assertListEqual(list(gaps), [0, 2])
+        self.assertEqual(edge_stats.shape, (1, 6))
+        self.assertAlmostEqual(edge_stats[0, 2], 2.5)
+        self.assertAlmostEqual(edge_stats[0, 4], -2.0 / 3.0)
+        self.assertAlmostEqual(vertex_stats[0, 4], -2.0 / 3.0)
+
+    def test_LinkStream_arrow(self):
+        """Test the Arrow import and export of LinkStream"""
+        g = pybstream.LinkStream(0, 10)
+        g.add_edge_w_time("A", "B", 1, 2)
+        g.add_edge_w_time("A", "B", 4, 6)
+        g.add_edge_w_time("B", "C", 5, 6)
+        h = pybstream.LinkStream.from_arrow(g.to_arrow())
+        self.assertEqual(h.num_vertices(), 3)
+        self.assertEqual(h.definition(), (1, 6))
+        self.assertTrue(h.has_edge("B", "C"))
+        try:
+            import pyarrow
+        except ImportError:
+            return
+        table = pyarrow.table(g.to_arrow())
+        self.assertEqual(table.num_rows, 3)
+        self.assertListEqual(table.column("begin").to_pylist(), [1, 4, 5])
+        h = pybstream.LinkStream.from_arrow(table)
+        self.assertTrue(h.has_edge("A", "B"))
+        self.assertEqual(h.definition(), (1, 6))
+
+    def test_LinkStream_coarsen(self):
+        """Test the time quantization and gap merging of LinkStream"""
+        second = 10 ** 9
+        g = pybstream.LinkStream(0, 1000 * second)
+        g.add_edge_w_time("A", "B", second + 5, 2 * second)
+        g.add_edge_w_time("A", "B", 2 * second + 300, 3 * second)
+        g.add_edge_w_time("A", "B", 10 * second, 11 * second)
+        before, after, reclaimed = g.coarsen(second, max_gap=8)
+        self.assertEqual((before, after), (3, 1))
+        self.assertGreater(reclaimed, 0)
+        self.assertEqual(g.definition(), (0, 1000))
+        self.assertEqual(g.edge_tinterval_length("A", "B"), 10)
+
+    def test_LinkStream_read_compressed_csv(self):
+        """Test the reading of gzip and xz compressed csv files"""
+        rows = "".join("A;B;{};{}\n".format(10 * i, 10 * i + 5) for i in range(1000))
+        with tempfile.TemporaryDirectory() as tmp:
+            for name, module in (("edges.csv.gz", gzip), ("edges.csv.xz", lzma)):
+                path = os.path.join(tmp, name)
+                with module.open(path, "wt") as f:
+                    f.write(rows)
+                g = pybstream.LinkStream()
+                g.read_csv(path, ';')
+                self.assertEqual(g.definition(), (0, 9995))
+                self.assertEqual(g.edge_tinterval_length("A", "B"), 5000)
+
+    def test_LinkStream_read_csv_options(self):
+        """Test the column mapping and the filters of read_csv"""
+        second = 10 ** 9
+        rows = ["begin,end,src,dst",
+                "{},{},a,b".format(10 * second, 20 * second),
+                "{},{},b,c".format(30 * second, 31 * second),
+                "{},{},c,d".format(40 * second, 90 * second)]
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "edges.csv")
+            with open(path, "w") as f:
+                f.write("\n".join(rows))
+            g = pybstream.LinkStream()
+            g.read_csv(path, source=2, target=3, begin=0, end=1, header=True, time_unit=second,
+                       window_begin=15, window_end=60, min_duration=2, deny=["a"])
+            self.assertEqual(g.num_vertices(), 2)
+            self.assertEqual(g.definition(), (40, 60))
+            self.assertEqual(g.edge_tinterval_length("c", "d"), 20)
+
 
 if __name__ == '__main__':
     unittest.main()
\ No newline at end of file
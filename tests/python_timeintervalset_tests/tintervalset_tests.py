@@ -54,5 +54,42 @@ class TestTIntervalSet(unittest.TestCase):
             self.assertEqual(elem.lower(), result_lower[i])
             i += 1
 
+    def test_FlatTIntervalSet_operations(self):
+        """Test set operations of FlatTimeIntervalSet"""
+        t1 = pybstream.FlatTimeIntervalSet(0, 10)
+        t1.append(0, 2)
+        t1.append(3, 9)
+        t2 = pybstream.FlatTimeIntervalSet(0, 10)
+        t2.append(1, 5)
+        t3 = pybstream.FlatTimeIntervalSet(0, 10)
+        t3.append(9, 10)
+        self.assertTrue(t1.intersects(t2))
+        self.assertEqual(t1.intersection(t2).length(), 3)
+        self.assertEqual(len(t1.intersection(t3)), 0)
+        self.assertEqual(list(t1.union(t2)), [(0, 9)])
+        self.assertEqual(list(t1.difference(t2)), [(0, 1), (5, 9)])
+        self.assertTrue(t1.contains(4, 8))
+        self.assertFalse(t1.contains(1, 4))
+
+    def test_CompressedTIntervalSet(self):
+        """Test the compressed time interval set against FlatTimeIntervalSet"""
+        second = 1000000000
+        start = 1600000000 * second
+        f1 = pybstream.FlatTimeIntervalSet(0, 2 * start)
+        f2 = pybstream.FlatTimeIntervalSet(0, 2 * start)
+        for i in range(500):
+            f1.append(start + 10 * i * second, start + (10 * i + 1 + i % 7) * second)
+            f2.append(start + (35 * i + 3) * second, start + (35 * i + 5) * second)
+        c1 = pybstream.CompressedTimeIntervalSet(f1)
+        c2 = pybstream.CompressedTimeIntervalSet(f2)
+        self.assertEqual(len(c1), len(f1))
+        self.assertEqual(c1.length(), f1.length())
+        self.assertEqual(list(c1), list(f1))
+        self.assertTrue(c1.contains(start, start + second))
+        self.assertFalse(c1.contains(start, start + 2 * second))
+        self.assertTrue(c1.intersects(c2))
+        self.assertEqual(list(c1.intersection(c2)), list(f1.intersection(f2)))
+        self.assertLess(c1.memory_usage(), len(f1) * 16)
+
 if __name__ == '__main__':
     unittest.main()
\ No newline at end of file
@@ -11,6 +11,8 @@
 
 
 #include "TimeIntervalSet.hpp"
+#include "FlatTimeIntervalSet.hpp"
+#include "CompressedTimeIntervalSet.hpp"
 
 #define BOOST_TEST_MODULE TImeIntervalSet_tests
 
@@ -154,4 +156,131 @@ BOOST_AUTO_TEST_CASE(test_TimeInterval_intersection)
     auto t3 = t1.intersection(t2);
     BOOST_CHECK(t3.length() == 3);
     //std::cout << t3 << std::endl;
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(FlatTimeIntervalSet_append)
+{
+    FlatTimeIntervalSet tsi(0, 20);
+    tsi.append(6, 8);
+    tsi.append(1, 3);
+    tsi.append(10, 12);
+    BOOST_CHECK(tsi.size() == 3);
+    BOOST_CHECK(tsi.length() == 6);
+
+    // touching and overlapping intervals are merged like in TimeIntervalSet
+    tsi.append(3, 4);
+    tsi.append(7, 11);
+    BOOST_CHECK(tsi.size() == 2);
+    BOOST_CHECK(tsi.lower(0) == 1 && tsi.upper(0) == 4);
+    BOOST_CHECK(tsi.lower(1) == 6 && tsi.upper(1) == 12);
+    BOOST_CHECK(tsi.append(15, 25) == false);
+
+    TimeIntervalSet ref(0, 20);
+    ref.append(6, 8);
+    ref.append(1, 3);
+    ref.append(10, 12);
+    ref.append(3, 4);
+    ref.append(7, 11);
+    BOOST_CHECK(FlatTimeIntervalSet(ref) == tsi);
+    BOOST_CHECK(tsi.to_time_interval_set().length() == ref.length());
+}
+
+BOOST_AUTO_TEST_CASE(FlatTimeIntervalSet_contains)
+{
+    FlatTimeIntervalSet tsi;
+    tsi.append(1, 3);
+    tsi.append(5, 15);
+    tsi.append(20, 30);
+    BOOST_CHECK(tsi.contains(7, 10));
+    BOOST_CHECK(tsi.contains(7, 19) == false);
+    BOOST_CHECK(tsi.contains(0, 1) == false);
+
+    std::size_t hint = 0;
+    BOOST_CHECK(tsi.contains(1, 2, hint));
+    BOOST_CHECK(tsi.contains(6, 8, hint));
+    BOOST_CHECK(hint == 1);
+    BOOST_CHECK(tsi.contains(25, 30, hint));
+    BOOST_CHECK(hint == 2);
+    BOOST_CHECK(tsi.contains(2, 3, hint));
+}
+
+BOOST_AUTO_TEST_CASE(FlatTimeIntervalSet_set_operations)
+{
+    FlatTimeIntervalSet t1(0, 10), t2(0, 10), t3(0, 10);
+    t1.append(0, 2);
+    t1.append(3, 9);
+    t2.append(1, 5);
+    t3.append(9, 10);
+
+    BOOST_CHECK(t1.intersects(t2));
+    auto inter = t1.intersection(t2);
+    BOOST_CHECK(inter.size() == 2);
+    BOOST_CHECK(inter.length() == 3);
+
+    // disjoint sets give an empty intersection instead of an exception
+    BOOST_CHECK(t1.intersects(t3) == false);
+    BOOST_CHECK(t1.intersection(t3).empty());
+
+    auto uni = t1.set_union(t2);
+    BOOST_CHECK(uni.size() == 1);
+    BOOST_CHECK(uni.lower(0) == 0 && uni.upper(0) == 9);
+    BOOST_CHECK(t1.set_union(t3).size() == 2);
+
+    auto diff = t1.difference(t2);
+    BOOST_CHECK(diff.size() == 2);
+    BOOST_CHECK(diff.lower(0) == 0 && diff.upper(0) == 1);
+    BOOST_CHECK(diff.lower(1) == 5 && diff.upper(1) == 9);
+    BOOST_CHECK(t2.difference(t1).length() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(CompressedTimeIntervalSet_append)
+{
+    CompressedTimeIntervalSet tsi(0, 100);
+    BOOST_CHECK(tsi.append(1, 5));
+    BOOST_CHECK(tsi.append(5, 8));  // touching the last interval
+    BOOST_CHECK(tsi.append(10, 20));
+    BOOST_CHECK(tsi.append(9, 12)); // overlapping the last interval
+    BOOST_CHECK(tsi.append(50, 200) == false);
+    BOOST_CHECK(tsi.append(2, 3) == false);
+    BOOST_CHECK(tsi.size() == 2);
+    BOOST_CHECK(tsi.length() == 18);
+    BOOST_CHECK(tsi.contains(2, 8));
+    BOOST_CHECK(tsi.contains(8, 9) == false);
+
+    auto fis = tsi.to_flat_time_interval_set();
+    BOOST_CHECK(fis.lower(0) == 1 && fis.upper(0) == 8);
+    BOOST_CHECK(fis.lower(1) == 9 && fis.upper(1) == 20);
+}
+
+BOOST_AUTO_TEST_CASE(CompressedTimeIntervalSet_nanoseconds)
+{
+    // nanosecond timestamps of a one second resolution, spanning several blocks
+    const time_t second = 1000000000, start = 1600000000 * second;
+    FlatTimeIntervalSet f1(0, 2 * start), f2(0, 2 * start);
+    for (time_t i = 0; i < 1000; ++i) {
+        f1.append(start + (10 * i) * second, start + (10 * i + 1 + i % 7) * second);
+        f2.append(start + (35 * i + 3) * second, start + (35 * i + 5) * second);
+    }
+    CompressedTimeIntervalSet c1(f1), c2(f2);
+
+    BOOST_CHECK(c1.size() == f1.size());
+    BOOST_CHECK(c1.length() == f1.length());
+    BOOST_CHECK(c1.to_flat_time_interval_set() == f1);
+    BOOST_CHECK(c1.memory_usage() * 4 < f1.size() * 2 * sizeof(time_t));
+    BOOST_CHECK(c1 == CompressedTimeIntervalSet(f1));
+    BOOST_CHECK(c1 != c2);
+
+    for (time_t t = start - second; t < start + 10010 * second; t += second / 2)
+        BOOST_CHECK_EQUAL(c1.contains(t, t + second), f1.contains(t, t + second));
+
+    BOOST_CHECK(c1.intersects(c2) == f1.intersects(f2));
+    auto inter = c1.intersection(c2);
+    BOOST_CHECK(inter.to_flat_time_interval_set() == f1.intersection(f2));
+    BOOST_CHECK(inter.length() == f1.intersection(f2).length());
+
+    // disjoint sets give an empty intersection
+    CompressedTimeIntervalSet c3(0, 2 * start);
+    c3.append(start + 10000 * second, start + 10001 * second);
+    BOOST_CHECK(c1.intersects(c3) == false);
+    BOOST_CHECK(c1.intersection(c3).empty());
+}